@@ -0,0 +1,361 @@
+// bench_attendance_queries.cpp  –  FaceGuard Pro  (host build only)
+// Generates a synthetic SD tree – /db/users.txt plus one /atd/l_YYYY-MM-DD.csv
+// per day going back from today – and times the Bridge attendance queries
+// the portal calls against it:
+//
+//   getLogsJSON      today, all 8 dept/status/search filter combinations
+//   streamLogsJSON   today, unfiltered, into a counting sink (/api/logs)
+//   getLogsRange     7 / 30 / 90 days
+//   getStatsJSON
+//   logAttendance    duplicate check-in of a user already logged today
+//   downloadAttendanceCSV   today
+//   streamCSVExport  today and the last 30 days (/api/download_csv)
+//
+// For each query it reports p50/p99 latency, bytes read from storage and
+// peak heap per call.  getLogsJSON rows are checked against the generator's
+// own count so silent ArduinoJson truncation shows up as "rows<expected".
+//
+//   fg_bench_queries [--users 500] [--days 90] [--mix 70:20:10] [--rate 0.9]
+//                    [--iters 20] [--seed 1] [--root DIR] [--keep] [--csv]
+//
+// --mix is the Present:Late:Absent weight of the rows written each day and
+// --rate the fraction of users with a row on a given day.  --root reuses an
+// existing SD tree (e.g. a copy of a production card) instead of generating
+// one.  --csv prints machine-readable rows for comparing runs.
+
+#include "Arduino.h"
+#include "global.h"
+#include "sd_card.h"
+#include "storage_posix.h"
+
+#include "bench_util.h"
+
+#include <functional>
+#include <random>
+#include <sys/stat.h>
+#include <vector>
+
+static const char *kDepts[] = { "Engineering", "Science", "Arts", "Business", "Medicine" };
+static const int   kNumDepts = 5;
+
+struct CorpusConfig {
+    int      users;
+    int      days;
+    int      mix[3];      // Present, Late, Absent weights
+    double   rate;
+    uint32_t seed;
+};
+
+// One row of today's log, kept so filter results can be verified.
+struct TodayRow {
+    int  user;
+    int  dept;
+    int  status;          // 0 Present, 1 Late, 2 Absent
+};
+
+static const char *kStatus[] = { "Present", "Late", "Absent" };
+
+static std::string dateDaysAgo(int daysAgo) {
+    time_t then = time(nullptr) - (time_t)daysAgo * 86400;
+    struct tm ti;
+    localtime_r(&then, &ti);
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%04d-%02d-%02d", ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday);
+    return buf;
+}
+
+static void userName(int u, char *out, size_t n) { snprintf(out, n, "User%05d", u); }
+static void userId(int u, char *out, size_t n)   { snprintf(out, n, "STU-%05d", u); }
+
+static bool writeFile(const std::string &path, const std::string &data) {
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) { perror(path.c_str()); return false; }
+    bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+    fclose(f);
+    return ok;
+}
+
+// Builds the SD tree under root.  Returns today's rows for verification.
+static std::vector<TodayRow> generateCorpus(const std::string &root, const CorpusConfig &c,
+                                            uint64_t &bytesOut) {
+    mkdir((root + "/db").c_str(), 0755);
+    mkdir((root + "/atd").c_str(), 0755);
+    mkdir((root + "/cfg").c_str(), 0755);
+
+    std::mt19937 rng(c.seed);
+    char id[16], name[16], line[160];
+    bytesOut = 0;
+
+    // users.txt in the layout saveUserToDB() writes
+    std::string users = "[";
+    for (int u = 0; u < c.users; u++) {
+        userId(u, id, sizeof(id));
+        userName(u, name, sizeof(name));
+        snprintf(line, sizeof(line),
+                 "%s{\"id\":\"%s\",\"name\":\"%s\",\"dept\":\"%s\",\"role\":\"Student\","
+                 "\"regDate\":\"%s\",\"faces\":5}",
+                 u ? "," : "", id, name, kDepts[u % kNumDepts], dateDaysAgo(c.days).c_str());
+        users += line;
+    }
+    users += "]";
+    writeFile(root + "/db/users.txt", users);
+    bytesOut += users.size();
+
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::discrete_distribution<int>        pickStatus({ (double)c.mix[0], (double)c.mix[1],
+                                                        (double)c.mix[2] });
+    std::uniform_int_distribution<int>     minute(0, 39);
+    std::vector<TodayRow> today;
+
+    for (int d = c.days - 1; d >= 0; d--) {
+        std::string date = dateDaysAgo(d);
+        std::string csv  = "UID,Name,Department,Date,Time,Status,Confidence\r\n";
+        csv.reserve((size_t)c.users * 64);
+        for (int u = 0; u < c.users; u++) {
+            if (coin(rng) >= c.rate) continue;
+            int st = pickStatus(rng);
+            int hh = (st == 0) ? 7 : (st == 1) ? 8 : 10;
+            int mm = minute(rng) + (st == 1 ? 15 : 0);
+            userId(u, id, sizeof(id));
+            userName(u, name, sizeof(name));
+            snprintf(line, sizeof(line), "%s,%s,%s,%s,%02d:%02d,%s,%d%%\n",
+                     id, name, kDepts[u % kNumDepts], date.c_str(), hh, mm,
+                     kStatus[st], 80 + (int)(rng() % 20));
+            csv += line;
+            if (d == 0) today.push_back({ u, u % kNumDepts, st });
+        }
+        writeFile(root + "/atd/l_" + date + ".csv", csv);
+        bytesOut += csv.size();
+    }
+    return today;
+}
+
+// ─── Measurement ─────────────────────────────────────────────────────────────
+struct Result {
+    std::string name;
+    uint64_t    p50, p99;
+    uint64_t    bytesRead;   // per call
+    uint32_t    opens;       // per call
+    size_t      peakHeap;    // per call, above the live heap at entry
+    size_t      outBytes;
+    std::string note;
+};
+
+static Result measure(const std::string &name, int iters, const std::function<String()> &fn) {
+    Result r;
+    r.name = name;
+    bench::Samples s;
+    size_t peak = 0;
+    String out;
+
+    fn();   // warm-up: fills the users cache and the OS page cache
+    posixStorageResetStats();
+    for (int i = 0; i < iters; i++) {
+        out = String();
+        size_t base = bench::heapLive();
+        bench::heapResetPeak();
+        uint64_t t0 = bench::nowUs();
+        out = fn();
+        s.add(bench::nowUs() - t0);
+        size_t pk = bench::heapPeak() - base;
+        if (pk > peak) peak = pk;
+    }
+    PosixStorageStats st = posixStorageStats();
+    r.p50       = s.percentile(50);
+    r.p99       = s.percentile(99);
+    r.bytesRead = st.bytesRead / (uint64_t)iters;
+    r.opens     = st.fileOpens / (uint32_t)iters;
+    r.peakHeap  = peak;
+    r.outBytes  = out.length();
+    return r;
+}
+
+// Rows in a getLogsJSON result: one '{' per record (values contain no braces).
+static int countRows(const String &json) {
+    int n = 0;
+    for (char ch : json) if (ch == '{') n++;
+    return n;
+}
+
+// Sink for the streamed queries: counts what would have been sent.
+struct Streamed {
+    size_t bytes;
+    int    rows;
+};
+
+static bool countSink(void *ctx, const char *data, size_t len) {
+    Streamed &s = *(Streamed *)ctx;
+    s.bytes += len;
+    for (size_t i = 0; i < len; i++) if (data[i] == '{') s.rows++;
+    return true;
+}
+
+static bool parseMix(const std::string &s, int mix[3]) {
+    return sscanf(s.c_str(), "%d:%d:%d", &mix[0], &mix[1], &mix[2]) == 3 &&
+           mix[0] >= 0 && mix[1] >= 0 && mix[2] >= 0 && (mix[0] + mix[1] + mix[2]) > 0;
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    if (a.has("help") || a.has("h")) {
+        fprintf(stderr,
+            "usage: fg_bench_queries [--users N] [--days N] [--mix P:L:A] [--rate F]\n"
+            "                        [--iters N] [--seed N] [--root DIR] [--keep] [--csv]\n");
+        return 2;
+    }
+
+    CorpusConfig cfg;
+    cfg.users = (int)a.num("users", 500);
+    cfg.days  = (int)a.num("days", 90);
+    cfg.rate  = a.real("rate", 0.9);
+    cfg.seed  = (uint32_t)a.num("seed", 1);
+    int iters = (int)a.num("iters", 20);
+    bool csv  = a.has("csv");
+    if (!parseMix(a.str("mix", "70:20:10"), cfg.mix)) {
+        fprintf(stderr, "fg_bench_queries: --mix expects P:L:A weights, e.g. 70:20:10\n");
+        return 2;
+    }
+    if (cfg.users < 1 || cfg.users > 10000 || cfg.days < 1 || cfg.days > 365 || iters < 1) {
+        fprintf(stderr, "fg_bench_queries: --users 1..10000, --days 1..365, --iters >= 1\n");
+        return 2;
+    }
+
+    Serial.setMuted(true);
+    ntpSynced = true;   // dates come from the host wall clock
+
+    // ── Corpus ───────────────────────────────────────────────────────────────
+    std::string root = a.str("root", "");
+    bool generated   = root.empty();
+    std::vector<TodayRow> today;
+    uint64_t corpusBytes = 0;
+    if (generated) {
+        root = bench::makeTempDir("fg_bench_");
+        uint64_t t0 = bench::nowUs();
+        today = generateCorpus(root, cfg, corpusBytes);
+        fprintf(stderr, "corpus: %d users x %d days, %.1f MB in %s (%.1f s)\n",
+                cfg.users, cfg.days, corpusBytes / 1048576.0, root.c_str(),
+                (bench::nowUs() - t0) / 1e6);
+    }
+
+    posixStorageSetRoot(root.c_str());
+    Bridge::initSD();
+    if (!Bridge::sdIsOk()) {
+        fprintf(stderr, "fg_bench_queries: cannot use '%s' as SD root\n", root.c_str());
+        return 1;
+    }
+    Bridge::loadSettings(gSettings);
+
+    // ── Queries ──────────────────────────────────────────────────────────────
+    const String date   = Bridge::getCurrentDateStr();
+    const String dept   = kDepts[1];
+    const String status = "Late";
+    const String search = "user0001";   // User00010..User00019
+
+    std::vector<Result> results;
+    for (int mask = 0; mask < 8; mask++) {
+        String fd = (mask & 1) ? dept   : String();
+        String fs = (mask & 2) ? status : String();
+        String fq = (mask & 4) ? search : String();
+        std::string label = "logs";
+        if (mask == 0) label += " (none)";
+        if (mask & 1)  label += " +dept";
+        if (mask & 2)  label += " +status";
+        if (mask & 4)  label += " +search";
+
+        String last;
+        Result r = measure(label, iters, [&]() {
+            last = Bridge::getLogsJSON(date, fd, fs, fq);
+            return last;
+        });
+        if (generated) {
+            int expected = 0;
+            for (const TodayRow &t : today) {
+                if ((mask & 1) && t.dept != 1) continue;
+                if ((mask & 2) && t.status != 1) continue;
+                if ((mask & 4) && !(t.user >= 10 && t.user <= 19)) continue;
+                expected++;
+            }
+            int got = countRows(last);
+            char note[64];
+            snprintf(note, sizeof(note), "rows %d/%d%s", got, expected,
+                     got < expected ? " TRUNCATED" : "");
+            r.note = note;
+        }
+        results.push_back(r);
+    }
+
+    // /api/logs on the device: the unfiltered query streamed through a fixed
+    // buffer instead of built into one String.
+    Streamed streamed = {};
+    Result   sr = measure("logs stream (none)", iters, [&]() {
+        streamed = Streamed();
+        Bridge::streamLogsJSON(date.c_str(), "", "", "", countSink, &streamed);
+        return String();
+    });
+    sr.outBytes = streamed.bytes;
+    if (generated) sr.note = "rows " + std::to_string(streamed.rows) + "/" +
+                             std::to_string(today.size());
+    results.push_back(sr);
+
+    const int ranges[] = { 7, 30, 90 };
+    for (int d : ranges) {
+        results.push_back(measure("range " + std::to_string(d), iters,
+                                  [d]() { return Bridge::getLogsRange(d); }));
+    }
+    results.push_back(measure("stats", iters, []() { return Bridge::getStatsJSON(); }));
+    if (!today.empty()) {
+        // Recognition of someone already logged today: the duplicate path of
+        // logAttendance, which runs on every match during the morning rush.
+        char id[16], name[16];
+        userId(today.back().user, id, sizeof(id));
+        userName(today.back().user, name, sizeof(name));
+        AttendanceRecord rec = AttendanceRecord::fromFace(id, name, kDepts[today.back().dept], 0.87f);
+        results.push_back(measure("checkin duplicate", iters, [&rec]() {
+            Bridge::logAttendance(rec);
+            return String();
+        }));
+    }
+    results.push_back(measure("csv today", iters,
+                              [&]() { return Bridge::downloadAttendanceCSV(date); }));
+
+    // /api/download_csv on the device: day files streamed a block at a time,
+    // one request for a whole month.
+    const int csvDays[] = { 1, 30 };
+    for (int d : csvDays) {
+        std::string from = dateDaysAgo(d - 1);
+        Streamed    st   = {};
+        int32_t     size = 0;
+        Result      r    = measure(d == 1 ? "csv stream today"
+                                          : "csv stream " + std::to_string(d) + " days",
+                                   iters, [&]() {
+            st   = Streamed();
+            size = Bridge::csvExportSize(from.c_str(), date.c_str());
+            Bridge::streamCSVExport(from.c_str(), date.c_str(), 0, (uint32_t)size, countSink,
+                                    &st);
+            return String();
+        });
+        r.outBytes = st.bytes;
+        if (st.bytes != (size_t)size) r.note = "SHORT of " + std::to_string(size);
+        results.push_back(r);
+    }
+
+    // ── Report ───────────────────────────────────────────────────────────────
+    if (csv) {
+        printf("query,users,days,p50_us,p99_us,bytes_read,opens,peak_heap,out_bytes,note\n");
+        for (const Result &r : results)
+            printf("%s,%d,%d,%llu,%llu,%llu,%u,%zu,%zu,%s\n", r.name.c_str(), cfg.users, cfg.days,
+                   (unsigned long long)r.p50, (unsigned long long)r.p99,
+                   (unsigned long long)r.bytesRead, r.opens, r.peakHeap, r.outBytes,
+                   r.note.c_str());
+    } else {
+        printf("%-28s %10s %10s %12s %6s %11s %10s  %s\n",
+               "query", "p50 ms", "p99 ms", "read B", "opens", "peak heap", "out B", "");
+        for (const Result &r : results)
+            printf("%-28s %10.3f %10.3f %12llu %6u %11zu %10zu  %s\n", r.name.c_str(),
+                   r.p50 / 1000.0, r.p99 / 1000.0, (unsigned long long)r.bytesRead, r.opens,
+                   r.peakHeap, r.outBytes, r.note.c_str());
+    }
+
+    if (generated && !a.has("keep")) bench::rmTree(root);
+    return 0;
+}
@@ -0,0 +1,262 @@
+// bench_broadcast.cpp  –  FaceGuard Pro  (host build only)
+// Several MJPEG viewers at once: the old per-connection stream loop (each
+// viewer captures, renders and blocks on its own socket) versus the
+// broadcaster (stream_broadcast.h: one render per frame, non-blocking
+// latest-frame-wins fan-out).
+//
+//   fg_bench_broadcast [--seconds 5] [--fps 25] [--bytes 12000]
+//                      [--render 60] [--fast 2] [--slow 2] [--slow-kbps 60]
+//                      [--overlay 1] [--stalled 0] [--target 300]
+//
+// Viewers are socketpairs with small buffers: fast ones read as quickly as
+// they can, slow ones are throttled to --slow-kbps.  --render is the
+// simulated annotate + re-encode cost per frame, on one simulated core
+// shared by every render (the stream runs on CPU 1).  --overlay makes every
+// other fast viewer an overlay viewer; --stalled viewers never read (the
+// broadcaster drops them after BROADCAST_STALL_MS – run for longer to see it).
+// --target is each broadcaster viewer's send-time target (0: controller off);
+// the simulated re-encode shrinks with the quality the controller asks for.  Reported per viewer: frames/s
+// received, frame age on arrival (capture → last byte) and, for the
+// broadcaster, parts skipped; plus total renders per second.
+
+#include "Arduino.h"
+#include "capture_broker.h"
+#include "stream_broadcast.h"
+#include "file_frame_source.h"
+
+#include "bench_util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// ─── Simulated device ────────────────────────────────────────────────────────
+static std::mutex            _core;         // CPU 1
+static uint32_t              _renderMs = 60;
+static std::atomic<uint32_t> _renders{0};
+
+static void renderWork() {
+    std::lock_guard<std::mutex> g(_core);
+    std::this_thread::sleep_for(std::chrono::milliseconds(_renderMs));
+    _renders++;
+}
+
+// Broadcaster hook: plain viewers get a "re-encoded" copy (size ∝ quality,
+// 90 = the camera frame's size), overlay viewers the camera JPEG and a faces
+// header.
+static bool simRender(Broadcast::Part &p, const Broadcast::Want &want) {
+    renderWork();
+    if (want.plain) {
+        size_t len = p.plainLen * want.quality / 90;
+        p.encoded = (uint8_t *)malloc(len);
+        if (!p.encoded) return false;
+        memcpy(p.encoded, p.plain, len);
+        p.plain    = p.encoded;
+        p.plainLen = len;
+        p.quality  = want.quality;
+    }
+    if (want.overlay)
+        snprintf(p.faces, sizeof(p.faces), "{\"seq\":%u,\"faces\":[]}", (unsigned)p.frame->seq);
+    return true;
+}
+
+// ─── Viewers ─────────────────────────────────────────────────────────────────
+struct Viewer {
+    std::string           name;
+    bool                  overlay = false;
+    uint32_t              kbps    = 0;      // 0: unthrottled
+    bool                  stalled = false;  // never reads
+    int                   fd[2]   = { -1, -1 };   // [0] server side, [1] client side
+    std::atomic<bool>     stop{false};
+    std::atomic<uint32_t> frames{0};
+    bench::Samples        age;              // ms, reader thread only
+    std::thread           reader, server;   // server: old per-connection loop only
+};
+
+static uint64_t wallUs() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// Reads the multipart stream, counting complete parts and their age.
+static void readLoop(Viewer *v) {
+    std::vector<uint8_t> buf;
+    uint8_t tmp[4096];
+    size_t  chunk = v->kbps ? v->kbps * 1024 / 100 : sizeof(tmp);   // per 10 ms
+    if (chunk > sizeof(tmp)) chunk = sizeof(tmp);
+    if (!chunk) chunk = 1;
+    if (v->stalled) return;
+    while (!v->stop) {
+        ssize_t r = recv(v->fd[1], tmp, chunk, 0);
+        if (r <= 0) break;
+        buf.insert(buf.end(), tmp, tmp + r);
+        for (;;) {
+            static const uint8_t crlf2[] = { '\r', '\n', '\r', '\n' };
+            auto he = std::search(buf.begin(), buf.end(), crlf2, crlf2 + 4);
+            if (he == buf.end()) break;
+            std::string hdr(buf.begin(), he);
+            size_t bodyAt = (he - buf.begin()) + 4;
+            const char *cl = strstr(hdr.c_str(), "Content-Length: ");
+            if (!cl) { buf.erase(buf.begin(), buf.begin() + bodyAt); continue; }   // HTTP head
+            size_t n = strtoul(cl + 16, nullptr, 10);
+            if (buf.size() < bodyAt + n) break;
+            const char *ts = strstr(hdr.c_str(), "X-Timestamp: ");
+            if (ts) {
+                uint64_t sec = strtoull(ts + 13, nullptr, 10);
+                uint64_t us  = strtoull(strchr(ts, '.') + 1, nullptr, 10);
+                v->age.add((wallUs() - (sec * 1000000 + us)) / 1000);
+            }
+            v->frames++;
+            buf.erase(buf.begin(), buf.begin() + bodyAt + n);
+        }
+        if (v->kbps) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+static void sendAll(int fd, const void *p, size_t n) {
+    const uint8_t *b = (const uint8_t *)p;
+    while (n) {
+        ssize_t r = send(fd, b, n, MSG_NOSIGNAL);
+        if (r <= 0) return;
+        b += r;
+        n -= (size_t)r;
+    }
+}
+
+// The old stream_handler: its own subscription, render and blocking sends.
+static void perConnectionLoop(Viewer *v) {
+    int sub = Capture::subscribe();
+    char head[256];
+    while (!v->stop && sub >= 0) {
+        Capture::FrameRef fr = Capture::next(sub, 1000);
+        if (!fr) continue;
+        renderWork();
+        std::vector<uint8_t> jpg(fr->buf, fr->buf + fr->len);     // "re-encoded"
+        int n = snprintf(head, sizeof(head),
+            "\r\n--" BROADCAST_BOUNDARY "\r\nContent-Type: image/jpeg\r\n"
+            "Content-Length: %u\r\nX-Timestamp: %d.%06d\r\n\r\n",
+            (unsigned)jpg.size(), (int)fr->ts.tv_sec, (int)fr->ts.tv_usec);
+        sendAll(v->fd[0], head, n);
+        sendAll(v->fd[0], jpg.data(), jpg.size());
+    }
+    Capture::unsubscribe(sub);
+}
+
+static std::vector<Viewer *> makeViewers(int fast, int slow, int stalled, uint32_t slowKbps,
+                                         bool overlay) {
+    std::vector<Viewer *> vs;
+    for (int i = 0; i < fast + slow + stalled; i++) {
+        Viewer *v = new Viewer();
+        v->kbps    = i < fast ? 0 : slowKbps;
+        v->stalled = i >= fast + slow;
+        v->overlay = overlay && i < fast && (i & 1);
+        v->name    = std::string(i < fast ? "fast" : v->stalled ? "stalled" : "slow") +
+                     (v->overlay ? " overlay " : " ") + std::to_string(i + 1);
+        socketpair(AF_UNIX, SOCK_STREAM, 0, v->fd);
+        int sz = 5744 / 2;      // the kernel doubles it: ESP32 lwip TCP_SND_BUF
+        setsockopt(v->fd[0], SOL_SOCKET, SO_SNDBUF, &sz, sizeof(sz));
+        setsockopt(v->fd[1], SOL_SOCKET, SO_RCVBUF, &sz, sizeof(sz));
+        vs.push_back(v);
+    }
+    return vs;
+}
+
+static void report(const char *title, std::vector<Viewer *> &vs, double seconds,
+                   const Broadcast::Stats *bs) {
+    printf("%s – %.1f renders/s\n", title, _renders / seconds);
+    printf("  %-18s %9s %10s %10s %9s %9s %9s\n", "viewer", "frames/s", "age p50", "age p99",
+           "skipped", "quality", "interval");
+    for (size_t i = 0; i < vs.size(); i++) {
+        Viewer *v = vs[i];
+        char skipped[16] = "-", quality[16] = "-", interval[16] = "-";
+        if (bs && bs->viewer[i].used) {
+            const Broadcast::ViewerStats &o = bs->viewer[i];
+            snprintf(skipped, sizeof(skipped), "%u", (unsigned)o.skipped);
+            if (o.kind == Broadcast::PLAIN) snprintf(quality, sizeof(quality), "%u", (unsigned)o.quality);
+            snprintf(interval, sizeof(interval), "%u ms", (unsigned)o.intervalMs);
+        }
+        printf("  %-18s %9.1f %7.0f ms %7.0f ms %9s %9s %9s\n", v->name.c_str(), v->frames / seconds,
+               (double)v->age.percentile(50), (double)v->age.percentile(99), skipped, quality,
+               interval);
+    }
+    printf("\n");
+}
+
+static void shutdown(std::vector<Viewer *> &vs) {
+    for (auto *v : vs) {
+        v->stop = true;
+        ::shutdown(v->fd[0], SHUT_RDWR);
+        ::shutdown(v->fd[1], SHUT_RDWR);
+    }
+    for (auto *v : vs) {
+        if (v->reader.joinable()) v->reader.join();
+        if (v->server.joinable()) v->server.join();
+    }
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    double   seconds  = a.real("seconds", 5);
+    _renderMs         = (uint32_t)a.num("render", 60);
+    int      fast     = (int)a.num("fast", 2);
+    int      slow     = (int)a.num("slow", 2);
+    int      stalled  = (int)a.num("stalled", 0);
+    uint32_t slowKbps = (uint32_t)a.num("slow-kbps", 60);
+    bool     overlay  = a.num("overlay", 1) != 0;
+    uint32_t target   = (uint32_t)a.num("target", BROADCAST_TARGET_MS);
+    size_t   bytes    = (size_t)a.num("bytes", 12000);
+    if (fast + slow + stalled > BROADCAST_MAX_VIEWERS) {
+        fprintf(stderr, "at most %d viewers\n", BROADCAST_MAX_VIEWERS);
+        return 1;
+    }
+    Serial.setMuted(true);
+
+    FileFrameSource src((uint32_t)a.num("fps", 25));
+    src.addSynthetic(8, bytes);
+    Capture::begin(&src);
+
+    printf("%d fast + %d slow (%u KB/s) + %d stalled viewer(s), %zu-byte frames at %ld fps, "
+           "render %u ms; target %u ms; %.0f s per run\n\n",
+           fast, slow, (unsigned)slowKbps, stalled, bytes, a.num("fps", 25), (unsigned)_renderMs, (unsigned)target, seconds);
+
+    // ── Before: one stream loop per connection ──────────────────────────────
+    {
+        std::vector<Viewer *> vs = makeViewers(fast, slow, stalled, slowKbps, false);
+        _renders = 0;
+        for (auto *v : vs) {
+            v->reader = std::thread(readLoop, v);
+            v->server = std::thread(perConnectionLoop, v);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds((int64_t)(seconds * 1000)));
+        report("per-connection loops", vs, seconds, nullptr);
+        shutdown(vs);
+    }
+
+    // ── After: broadcaster ──────────────────────────────────────────────────
+    Broadcast::begin(simRender);
+    {
+        std::vector<Viewer *> vs = makeViewers(fast, slow, stalled, slowKbps, overlay);
+        _renders = 0;
+        for (auto *v : vs) {
+            Broadcast::addViewer(v->fd[0], v->overlay ? Broadcast::OVERLAY : Broadcast::PLAIN,
+                                 "HTTP/1.1 200 OK\r\n\r\n", target);
+            v->reader = std::thread(readLoop, v);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds((int64_t)(seconds * 1000)));
+        Broadcast::Stats bs = Broadcast::stats();
+        report("broadcaster", vs, seconds, &bs);
+        printf("  %u part(s) rendered, avg %.1f ms; %u viewer(s) dropped for stalling\n",
+               (unsigned)bs.produced, bs.avgRenderUs / 1000.0, (unsigned)bs.stalled);
+    }
+    fflush(stdout);
+    _Exit(0);   // broker and broadcaster tasks run forever
+}
@@ -0,0 +1,159 @@
+// bench_capture.cpp  –  FaceGuard Pro  (host build only)
+// Frame delivery to several camera consumers: each consumer grabbing from
+// the camera itself (the pre-broker firmware) versus the capture broker's
+// shared, latest-frame-wins mailbox.
+//
+//   fg_bench_capture [--dir <jpegs>] [--fps 25] [--seconds 4]
+//                    [--work 150,15,400] [--bytes 12000] [--fb-count 2]
+//
+// --work lists one consumer per entry: the ms it spends on each frame
+// (default: recognition at 150 ms, a fast stream viewer at 15 ms and a
+// viewer on bad Wi-Fi at 400 ms).  Frames come from the JPEGs in --dir, or
+// synthetic --bytes frames.  In the direct phase a consumer holds its
+// framebuffer while it works and only --fb-count may be out at once, as
+// with the driver's DMA buffers.  Reported per consumer and phase: frames
+// received, frame rate, and frame age when picked up (capture → consumer).
+
+#include "Arduino.h"
+#include "capture_broker.h"
+#include "file_frame_source.h"
+
+#include "bench_util.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct Consumer {
+    uint32_t       workMs;
+    uint32_t       frames = 0;
+    uint32_t       skipped = 0;
+    bench::Samples age;        // µs between capture and pickup
+};
+
+static std::vector<Consumer> parseWork(const std::string &s) {
+    std::vector<Consumer> v;
+    size_t i = 0;
+    while (i < s.size()) {
+        size_t j = s.find(',', i);
+        if (j == std::string::npos) j = s.size();
+        Consumer c;
+        c.workMs = (uint32_t)atoi(s.substr(i, j - i).c_str());
+        v.push_back(c);
+        i = j + 1;
+    }
+    return v;
+}
+
+static void busy(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Before: every consumer calls the camera itself, so each frame goes to
+// whichever consumer asked first and the camera rate is shared out.
+static void runDirect(FileFrameSource &src, std::vector<Consumer> &cs, uint32_t seconds,
+                      int fbCount) {
+    std::mutex              cam;
+    std::condition_variable freed;
+    int                     out = 0;      // framebuffers held by consumers
+    std::atomic<bool>       stop{false};
+    std::vector<std::thread> ts;
+    for (Consumer &c : cs) {
+        ts.emplace_back([&, pc = &c] {
+            while (!stop) {
+                Capture::FrameSource::Grab g;
+                uint64_t t;
+                {
+                    std::unique_lock<std::mutex> l(cam);
+                    freed.wait(l, [&] { return out < fbCount || stop; });
+                    if (stop || !src.grab(g)) continue;
+                    out++;
+                    t = bench::nowUs();
+                }
+                pc->age.add(bench::nowUs() - t);
+                pc->frames++;
+                busy(pc->workMs);
+                {
+                    std::lock_guard<std::mutex> l(cam);
+                    src.release(g);
+                    out--;
+                }
+                freed.notify_all();
+            }
+        });
+    }
+    busy(seconds * 1000);
+    stop = true;
+    freed.notify_all();
+    for (auto &t : ts) t.join();
+}
+
+// After: the broker grabs once per frame and every consumer gets the newest.
+static void runBroker(std::vector<Consumer> &cs, uint32_t seconds) {
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> ts;
+    for (Consumer &c : cs) {
+        ts.emplace_back([&, pc = &c] {
+            int sub = Capture::subscribe();
+            if (sub < 0) return;
+            while (!stop) {
+                Capture::FrameRef f = Capture::next(sub, 200);
+                if (!f) continue;
+                pc->age.add((uint64_t)(millis() - f->ms) * 1000);
+                pc->frames++;
+                busy(pc->workMs);
+            }
+            pc->skipped = Capture::stats().skipped[sub];
+            Capture::unsubscribe(sub);
+        });
+    }
+    busy(seconds * 1000);
+    stop = true;
+    for (auto &t : ts) t.join();
+}
+
+static void report(const char *phase, const std::vector<Consumer> &cs, uint32_t seconds) {
+    printf("\n%s\n", phase);
+    printf("  %-10s %8s %8s %9s %11s %11s\n", "work ms", "frames", "fps", "skipped", "age p50 ms", "age p99 ms");
+    for (const Consumer &c : cs) {
+        printf("  %-10u %8u %8.1f %9u %11.1f %11.1f\n", (unsigned)c.workMs, (unsigned)c.frames,
+               c.frames / (double)seconds, (unsigned)c.skipped,
+               c.age.count() ? c.age.percentile(50) / 1000.0 : 0.0,
+               c.age.count() ? c.age.percentile(99) / 1000.0 : 0.0);
+    }
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    uint32_t    fps     = (uint32_t)a.num("fps", 25);
+    uint32_t    seconds = (uint32_t)a.num("seconds", 4);
+    std::string dir     = a.str("dir", "");
+    std::string work    = a.str("work", "150,15,400");
+    Serial.setMuted(true);
+
+    FileFrameSource src(fps);
+    if (!dir.empty() && src.loadDir(dir.c_str()) == 0) {
+        fprintf(stderr, "fg_bench_capture: no JPEG frames in %s\n", dir.c_str());
+        return 1;
+    }
+    if (src.frames() == 0) src.addSynthetic(16, (size_t)a.num("bytes", 12000));
+
+    printf("Source: %zu frame(s) %s, %u fps, %u s per phase\n", src.frames(),
+           dir.empty() ? "(synthetic)" : dir.c_str(), (unsigned)fps, (unsigned)seconds);
+
+    std::vector<Consumer> direct = parseWork(work);
+    runDirect(src, direct, seconds, (int)a.num("fb-count", 2));
+    report("Each consumer grabs from the camera (before)", direct, seconds);
+
+    std::vector<Consumer> brokered = parseWork(work);
+    Capture::begin(&src);
+    runBroker(brokered, seconds);
+    report("Capture broker, latest-frame-wins (after)", brokered, seconds);
+
+    Capture::Stats st = Capture::stats();
+    printf("\nBroker: %u frames captured (%.1f fps), %u grab failures, %u alloc failures, "
+           "max copy %u us\n", (unsigned)st.captured, st.captured / (double)seconds,
+           (unsigned)st.grabFailed, (unsigned)st.allocFailed, (unsigned)st.maxCopyUs);
+    return 0;
+}
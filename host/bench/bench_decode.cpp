@@ -0,0 +1,158 @@
+// bench_decode.cpp  –  FaceGuard Pro  (host build only)
+// Cost of turning a camera JPEG into what recognition needs: the old
+// full-size fmt2rgb888-style decode versus FrameDecode's DCT-scaled
+// detection image plus a full-resolution decode of the face region only.
+//
+//   fg_bench_decode [--dir <jpegs>] [--iters 50] [--frames 8]
+//                   [--width 320] [--height 240] [--quality 80]
+//
+// Frames are the JPEGs in --dir (e.g. frames saved from /stream), or
+// synthetic --width × --height frames.  The face region is a centred box a
+// third of the frame wide, padded like the firmware pads O-net boxes.
+// Reported per path: p50 / p99 decode time and the RGB buffer allocated.
+// Region pixels are checked against the full decode (exit code 1 on a
+// mismatch).
+
+#include "Arduino.h"
+#include "frame_decode.h"
+#include "file_frame_source.h"
+
+#include "bench_util.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <jpeglib.h>
+
+// Smooth gradients plus a bright ellipse: compresses like a camera frame.
+static std::vector<uint8_t> synthJpeg(int w, int h, int quality, uint32_t seed) {
+    std::vector<uint8_t> rgb((size_t)w * h * 3);
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++) {
+            float dx = (x - w / 2.0f) / (w / 6.0f), dy = (y - h / 2.0f) / (h / 4.0f);
+            bool  face = dx * dx + dy * dy < 1.0f;
+            uint8_t *p = &rgb[((size_t)y * w + x) * 3];
+            uint32_t n = (x * 7919u + y * 104729u + seed * 31u) % 23u;
+            p[0] = (uint8_t)(face ? 200 + n : (x * 255 / w + n));
+            p[1] = (uint8_t)(face ? 160 + n : (y * 255 / h + n));
+            p[2] = (uint8_t)(face ? 130 + n : ((x + y + seed * 13) & 0xFF));
+        }
+
+    jpeg_compress_struct c;
+    jpeg_error_mgr       e;
+    c.err = jpeg_std_error(&e);
+    jpeg_create_compress(&c);
+    unsigned char *out = nullptr;
+    unsigned long  outLen = 0;
+    jpeg_mem_dest(&c, &out, &outLen);
+    c.image_width      = w;
+    c.image_height     = h;
+    c.input_components = 3;
+    c.in_color_space   = JCS_RGB;
+    jpeg_set_defaults(&c);
+    jpeg_set_quality(&c, quality, TRUE);
+    jpeg_start_compress(&c, TRUE);
+    while (c.next_scanline < c.image_height) {
+        JSAMPROW row = &rgb[(size_t)c.next_scanline * w * 3];
+        jpeg_write_scanlines(&c, &row, 1);
+    }
+    jpeg_finish_compress(&c);
+    jpeg_destroy_compress(&c);
+    std::vector<uint8_t> v(out, out + outLen);
+    free(out);
+    return v;
+}
+
+struct Path {
+    const char    *name;
+    bench::Samples us;
+    size_t         bytes = 0;
+};
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    int         iters = (int)a.num("iters", 50);
+    std::string dir   = a.str("dir", "");
+    Serial.setMuted(true);
+
+    std::vector<std::vector<uint8_t>> frames;
+    if (!dir.empty()) {
+        FileFrameSource src(0);
+        for (size_t i = 0, n = src.loadDir(dir.c_str()); i < n; i++) frames.push_back(src.frame(i));
+        if (frames.empty()) {
+            fprintf(stderr, "fg_bench_decode: no JPEG frames in %s\n", dir.c_str());
+            return 1;
+        }
+    } else {
+        int n = (int)a.num("frames", 8);
+        for (int i = 0; i < n; i++)
+            frames.push_back(synthJpeg((int)a.num("width", 320), (int)a.num("height", 240),
+                                       (int)a.num("quality", 80), (uint32_t)i));
+    }
+
+    uint16_t fw = 0, fh = 0;
+    jpegDimensions(frames[0].data(), frames[0].size(), &fw, &fh);
+    // Face box as O-net would report it, padded by faceRegion().
+    box_t       box  = { { fw / 3.0f, fh / 4.0f, fw * 2 / 3.0f, fh * 3 / 4.0f } };
+    landmark_t  lm   = {};
+    fptp_t      sc   = 1;
+    box_array_t one  = { &sc, &box, &lm, 1 };
+    int rx, ry, rw, rh;
+    FrameDecode::faceRegion(&one, 1, fw, fh, &rx, &ry, &rw, &rh);
+
+    printf("%zu frame(s) %ux%u, avg %zu B, face region %dx%d at (%d,%d), %d iterations\n",
+           frames.size(), fw, fh, frames[0].size(), rw, rh, rx, ry, iters);
+
+    Path full  = { "full decode (fmt2rgb888)" };
+    Path half  = { "scaled 1/2" };
+    Path quart = { "scaled 1/4" };
+    Path reg   = { "face region, full res" };
+    Path combo = { "1/2 + face region" };
+    int  mismatches = 0;
+
+    for (int it = 0; it < iters; it++) {
+        for (const auto &f : frames) {
+            uint64_t t0 = bench::nowUs();
+            dl_matrix3du_t *m0 = FrameDecode::decodeScaled(f.data(), f.size(), 0);
+            uint64_t t1 = bench::nowUs();
+            dl_matrix3du_t *m1 = FrameDecode::decodeScaled(f.data(), f.size(), 1);
+            uint64_t t2 = bench::nowUs();
+            dl_matrix3du_t *m2 = FrameDecode::decodeScaled(f.data(), f.size(), 2);
+            uint64_t t3 = bench::nowUs();
+            dl_matrix3du_t *mr = FrameDecode::decodeRegion(f.data(), f.size(), rx, ry, rw, rh);
+            uint64_t t4 = bench::nowUs();
+            if (!m0 || !m1 || !m2 || !mr) {
+                fprintf(stderr, "fg_bench_decode: decode failed\n");
+                return 1;
+            }
+            full.us.add(t1 - t0);   full.bytes  = (size_t)m0->w * m0->h * 3;
+            half.us.add(t2 - t1);   half.bytes  = (size_t)m1->w * m1->h * 3;
+            quart.us.add(t3 - t2);  quart.bytes = (size_t)m2->w * m2->h * 3;
+            reg.us.add(t4 - t3);    reg.bytes   = (size_t)mr->w * mr->h * 3;
+            combo.us.add((t2 - t1) + (t4 - t3));
+            combo.bytes = half.bytes + reg.bytes;
+
+            if (it == 0)
+                for (int y = 0; y < rh; y++)
+                    if (memcmp(mr->item + (size_t)y * rw * 3,
+                               m0->item + ((size_t)(ry + y) * m0->w + rx) * 3, (size_t)rw * 3))
+                        mismatches++;
+            dl_matrix3du_free(m0); dl_matrix3du_free(m1);
+            dl_matrix3du_free(m2); dl_matrix3du_free(mr);
+        }
+    }
+
+    printf("\n  %-26s %10s %10s %12s\n", "path", "p50 us", "p99 us", "RGB bytes");
+    for (Path *p : { &full, &half, &quart, &reg, &combo })
+        printf("  %-26s %10llu %10llu %12zu\n", p->name,
+               (unsigned long long)p->us.percentile(50), (unsigned long long)p->us.percentile(99),
+               p->bytes);
+    printf("\nEmpty frame (detection only): %.1fx faster, %.0f%% less RGB memory\n",
+           full.us.percentile(50) / (double)half.us.percentile(50),
+           100.0 * (1.0 - half.bytes / (double)full.bytes));
+    printf("Frame with a face (1/2 + region): %.1fx faster, %.0f%% less RGB memory\n",
+           full.us.percentile(50) / (double)combo.us.percentile(50),
+           100.0 * (1.0 - combo.bytes / (double)full.bytes));
+    if (mismatches) printf("FAIL: %d region row(s) differ from the full decode\n", mismatches);
+    return mismatches ? 1 : 0;
+}
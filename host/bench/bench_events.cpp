@@ -0,0 +1,139 @@
+// bench_events.cpp  –  FaceGuard Pro  (host build only)
+// Check-ins reaching open portals: the old refresh (every portal re-reads
+// /api/stats and /api/logs every --poll ms) versus the event hub
+// (event_hub.h: one publish per check-in, pushed to every /api/events
+// client).
+//
+//   fg_bench_events [--seconds 5] [--rate 20] [--fast 2] [--slow 1]
+//                   [--slow-bps 400] [--poll 15000]
+//
+// Check-ins are published at --rate per second.  Clients are socketpairs
+// with ESP32-sized buffers: fast ones read as quickly as they can, slow
+// ones are throttled to --slow-bps (a browser tab in the background, a bad
+// link).  Reported: publish() cost, per client the check-ins received,
+// resyncs and delivery delay, and for comparison the delay a portal polling
+// every --poll ms sees (next poll after the check-in, random phase).
+
+#include "Arduino.h"
+#include "event_hub.h"
+
+#include "bench_util.h"
+
+#include <atomic>
+#include <random>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+struct Client {
+    std::string      name;
+    int              fd[2];             // [0] hub side, [1] browser side
+    uint32_t         bps = 0;           // 0: read as fast as possible
+    std::thread      reader;
+    std::atomic<bool> stop{false};
+    uint32_t         events = 0, resyncs = 0;
+    size_t           bytes = 0;
+    bench::Samples   delay;             // µs
+};
+
+// Reads the stream and times every check-in from the "t" it carries.
+static void readLoop(Client *c) {
+    std::string pending;
+    char        buf[512];
+    while (!c->stop) {
+        size_t  want = c->bps ? std::min<size_t>(sizeof(buf), c->bps / 10) : sizeof(buf);
+        ssize_t n    = read(c->fd[1], buf, want);
+        if (n <= 0) break;
+        c->bytes += (size_t)n;
+        pending.append(buf, (size_t)n);
+        size_t end;
+        while ((end = pending.find("\n\n")) != std::string::npos) {
+            std::string ev = pending.substr(0, end);
+            pending.erase(0, end + 2);
+            if (ev.find("event: resync") != std::string::npos) c->resyncs++;
+            size_t t = ev.find("{\"t\":");
+            if (ev.find("event: checkin") != std::string::npos && t != std::string::npos) {
+                c->events++;
+                c->delay.add(bench::nowUs() - strtoull(ev.c_str() + t + 5, nullptr, 10));
+            }
+        }
+        if (c->bps) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    double   seconds = a.real("seconds", 5);
+    double   rate    = a.real("rate", 20);
+    int      fast    = (int)a.num("fast", 2);
+    int      slow    = (int)a.num("slow", 1);
+    uint32_t slowBps = (uint32_t)a.num("slow-bps", 400);
+    uint32_t pollMs  = (uint32_t)a.num("poll", 15000);
+    Serial.setMuted(true);
+    if (fast + slow > EVENTS_MAX_CLIENTS) {
+        printf("at most %d clients\n", EVENTS_MAX_CLIENTS);
+        return 1;
+    }
+    Events::begin();
+
+    std::vector<Client *> cs;
+    for (int i = 0; i < fast + slow; i++) {
+        Client *c = new Client();
+        c->bps  = i < fast ? 0 : slowBps;
+        c->name = std::string(i < fast ? "fast " : "slow ") + std::to_string(i + 1);
+        socketpair(AF_UNIX, SOCK_STREAM, 0, c->fd);
+        int sz = 5744 / 2;      // the kernel doubles it: ESP32 lwip TCP_SND_BUF
+        setsockopt(c->fd[0], SOL_SOCKET, SO_SNDBUF, &sz, sizeof(sz));
+        setsockopt(c->fd[1], SOL_SOCKET, SO_RCVBUF, &sz, sizeof(sz));
+        Events::addClient(c->fd[0], "HTTP/1.1 200 OK\r\n\r\nretry: 3000\n\n");
+        c->reader = std::thread(readLoop, c);
+        cs.push_back(c);
+    }
+
+    // Publisher: what the journal's check-in hook does, at a fixed rate.
+    bench::Samples publish, polled;
+    std::mt19937   rng(1);
+    std::uniform_real_distribution<double> phase(0, pollMs * 1000.0);
+    uint64_t start = bench::nowUs(), end = start + (uint64_t)(seconds * 1e6);
+    uint32_t published = 0;
+    while (bench::nowUs() < end) {
+        uint64_t t0 = bench::nowUs();
+        Events::publish("checkin",
+            "{\"t\":%llu,\"uid\":\"E%04u\",\"name\":\"User %u\",\"dept\":\"Engineering\","
+            "\"time\":\"08:%02u\",\"status\":\"Present\",\"confidence\":\"91%%\"}",
+            (unsigned long long)t0, (unsigned)published, (unsigned)published,
+            (unsigned)(published % 60));
+        publish.add(bench::nowUs() - t0);
+        polled.add((uint64_t)phase(rng));
+        published++;
+        uint64_t next = start + (uint64_t)(published * 1e6 / rate);
+        uint64_t now  = bench::nowUs();
+        if (next > now) std::this_thread::sleep_for(std::chrono::microseconds(next - now));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));   // let fast clients drain
+
+    printf("%u check-ins at %.0f/s over %.0f s; publish() p50 %.1f µs, p99 %.1f µs\n\n",
+           (unsigned)published, rate, seconds, (double)publish.percentile(50),
+           (double)publish.percentile(99));
+    printf("  %-18s %9s %9s %10s %10s %9s\n", "client", "received", "resyncs", "delay p50",
+           "delay p99", "KB");
+    printf("  %-18s %9s %9s %7.0f ms %7.0f ms %9s\n", ("poll every " +
+           std::to_string(pollMs / 1000) + " s").c_str(), "-", "-",
+           polled.percentile(50) / 1000.0, polled.percentile(99) / 1000.0, "-");
+    for (auto *c : cs) {
+        printf("  %-18s %9u %9u %7.1f ms %7.1f ms %9.1f\n", c->name.c_str(), (unsigned)c->events,
+               (unsigned)c->resyncs, c->delay.percentile(50) / 1000.0,
+               c->delay.percentile(99) / 1000.0, c->bytes / 1024.0);
+    }
+
+    Events::Stats st = Events::stats();
+    printf("\n  hub: %u published, %u truncated, %u clients stalled; buffered per client "
+           "at most %u B + the socket's\n", (unsigned)st.published, (unsigned)st.truncated,
+           (unsigned)st.stalled, (unsigned)EVENTS_CLIENT_BUF);
+    fflush(stdout);
+    _Exit(0);   // sender task and readers run forever
+}
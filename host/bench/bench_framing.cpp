@@ -0,0 +1,167 @@
+// bench_framing.cpp  –  FaceGuard Pro  (host build only)
+// Cost of putting one MJPEG part on a TCP socket, three ways:
+//
+//    chunked   the original stream_handler: boundary, part header and JPEG
+//              as three httpd_resp_send_chunk() calls, each of which is
+//              itself three writes (size line, data, CRLF)
+//    2 writes  header, then JPEG (the broadcaster before mjpeg_part.h)
+//    gather    Mjpeg::write(): header and JPEG in one sendmsg()
+//
+//   fg_bench_framing [--parts 3000] [--bytes 12000] [--mss 1436] [--nodelay 0]
+//
+// Parts go over a loopback TCP connection whose MSS is clamped to --mss (the
+// ESP32's Wi-Fi MSS by default); --nodelay 1 turns Nagle off on the sender.
+// Reported per method: socket writes and TCP data segments per part, bytes
+// on the wire per part, and sender CPU time per part.
+
+#include "Arduino.h"
+#include "mjpeg_part.h"
+
+#include "bench_util.h"
+
+#include <arpa/inet.h>
+#include <linux/tcp.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+static uint32_t _writes = 0;
+
+static void sendAll(int fd, const void *p, size_t n) {
+    const uint8_t *b = (const uint8_t *)p;
+    while (n) {
+        ssize_t r = send(fd, b, n, MSG_NOSIGNAL);
+        _writes++;
+        if (r <= 0) return;
+        b += r;
+        n -= (size_t)r;
+    }
+}
+
+// httpd_resp_send_chunk(): one chunked-encoding frame, three writes.
+static void sendChunk(int fd, const void *p, size_t n) {
+    char sz[12];
+    int  l = snprintf(sz, sizeof(sz), "%x\r\n", (unsigned)n);
+    sendAll(fd, sz, l);
+    sendAll(fd, p, n);
+    sendAll(fd, "\r\n", 2);
+}
+
+enum Method { CHUNKED, TWO_WRITES, GATHER };
+
+static void sendPart(Method m, int fd, const char *head, size_t headLen,
+                     const std::vector<uint8_t> &jpg) {
+    switch (m) {
+    case CHUNKED: {
+        // The old handler sent the boundary as its own chunk.
+        static const char boundary[] = "\r\n--" MJPEG_BOUNDARY "\r\n";
+        size_t bl = sizeof(boundary) - 1;
+        sendChunk(fd, boundary, bl);
+        sendChunk(fd, head + bl, headLen - bl);
+        sendChunk(fd, jpg.data(), jpg.size());
+        break;
+    }
+    case TWO_WRITES:
+        sendAll(fd, head, headLen);
+        sendAll(fd, jpg.data(), jpg.size());
+        break;
+    case GATHER: {
+        Mjpeg::Wire w = { head, headLen, jpg.data(), jpg.size(), 0 };
+        while (!w.done()) {
+            _writes++;
+            if (Mjpeg::write(fd, w, MSG_NOSIGNAL) < 0) return;
+        }
+        break;
+    }
+    }
+}
+
+static uint32_t dataSegsOut(int fd) {
+    struct tcp_info ti;
+    socklen_t len = sizeof(ti);
+    memset(&ti, 0, sizeof(ti));
+    getsockopt(fd, IPPROTO_TCP, TCP_INFO, &ti, &len);
+    return ti.tcpi_data_segs_out;
+}
+
+static uint64_t threadCpuUs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// A connected pair over loopback: [0] sender, [1] receiver.
+static bool connectPair(int fds[2], int mss, bool nodelay) {
+    int ls = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in a;
+    memset(&a, 0, sizeof(a));
+    a.sin_family      = AF_INET;
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t al = sizeof(a);
+    if (ls < 0 || bind(ls, (struct sockaddr *)&a, sizeof(a)) < 0 || listen(ls, 1) < 0 ||
+        getsockname(ls, (struct sockaddr *)&a, &al) < 0) return false;
+    fds[0] = socket(AF_INET, SOCK_STREAM, 0);
+    setsockopt(fds[0], IPPROTO_TCP, TCP_MAXSEG, &mss, sizeof(mss));
+    int nd = nodelay ? 1 : 0;
+    setsockopt(fds[0], IPPROTO_TCP, TCP_NODELAY, &nd, sizeof(nd));
+    if (connect(fds[0], (struct sockaddr *)&a, sizeof(a)) < 0) return false;
+    fds[1] = accept(ls, nullptr, nullptr);
+    close(ls);
+    return fds[1] >= 0;
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    int    parts   = (int)a.num("parts", 3000);
+    size_t bytes   = (size_t)a.num("bytes", 12000);
+    int    mss     = (int)a.num("mss", 1436);
+    bool   nodelay = a.num("nodelay", 0) != 0;
+    Serial.setMuted(true);
+
+    std::vector<uint8_t> jpg(bytes);
+    for (size_t i = 0; i < bytes; i++) jpg[i] = (uint8_t)(i * 31);
+
+    // A representative header: what the broadcaster sends a plain viewer.
+    char  head[512];
+    struct timeval ts = { 1700000000, 123456 };
+    size_t headLen = Mjpeg::formatHead(head, sizeof(head), bytes, ts,
+        "X-Stream: quality=75;interval=150;send=240;target=300;latency=410;kbps=38\r\n");
+
+    printf("%d parts of %zu + %zu bytes, MSS %d, Nagle %s\n\n", parts, headLen, bytes, mss,
+           nodelay ? "off" : "on");
+    printf("  %-10s %12s %14s %14s %12s %10s\n", "method", "writes/part", "segments/part",
+           "wire B/part", "CPU us/part", "parts/s");
+
+    static const char *names[] = { "chunked", "2 writes", "gather" };
+    for (Method m : { CHUNKED, TWO_WRITES, GATHER }) {
+        int fds[2];
+        if (!connectPair(fds, mss, nodelay)) { perror("loopback"); return 1; }
+        uint64_t received = 0;
+        std::thread reader([&] {
+            uint8_t buf[16384];
+            ssize_t r;
+            while ((r = recv(fds[1], buf, sizeof(buf), 0)) > 0) received += (uint64_t)r;
+        });
+
+        _writes = 0;
+        uint32_t seg0 = dataSegsOut(fds[0]);
+        uint64_t t0 = bench::nowUs(), c0 = threadCpuUs();
+        for (int i = 0; i < parts; i++) sendPart(m, fds[0], head, headLen, jpg);
+        uint64_t cpu = threadCpuUs() - c0, wall = bench::nowUs() - t0;
+        uint32_t segs = dataSegsOut(fds[0]) - seg0;
+        shutdown(fds[0], SHUT_WR);
+        reader.join();
+        close(fds[0]);
+        close(fds[1]);
+
+        printf("  %-10s %12.2f %14.2f %14.0f %12.2f %10.0f\n", names[m], (double)_writes / parts,
+               (double)segs / parts, (double)received / parts, (double)cpu / parts,
+               parts * 1e6 / (wall ? wall : 1));
+    }
+    return 0;
+}
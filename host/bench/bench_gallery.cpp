@@ -0,0 +1,290 @@
+// bench_gallery.cpp  –  FaceGuard Pro  (host build only)
+// Face matching cost: esp-face's linked-list scan (recognize_face_with_name
+// over face_id_name_list) versus the contiguous FaceGallery kernel, and the
+// FLOAT32 gallery versus INT8 (int8 scan + top-K float re-rank).
+//
+//   fg_bench_gallery [--faces 10,100,1000,5000] [--queries 200]
+//                    [--noise 0.6] [--topk 8] [--seed 1]
+//
+// For each gallery size N, N random identities are enrolled in every
+// structure; each query is a noisy copy of a random identity (or, one in
+// four, a stranger nobody enrolled).  Reported per N: p50/p99 per-query
+// latency of each path, speed-up, heap held by each gallery, and how often
+// each path disagrees with the exact answer.  The list and FLOAT32 must
+// agree exactly and INT8 with re-rank must agree with FLOAT32 (exit code 1
+// otherwise); INT8 without re-rank is shown for reference.  INT8 re-rank
+// fetches come from memory here – on the device each is a FACE.BIN read.
+// FACE.BIN / FACE.Q8 round trips at the largest N are checked at the end.
+
+#include "Arduino.h"
+#include "global.h"
+#include "sd_card.h"
+#include "storage_posix.h"
+#include "face_gallery.h"
+
+#include "bench_util.h"
+
+#include <memory>
+#include <random>
+#include <sstream>
+
+static void randomVec(std::mt19937 &rng, float *v) {
+    std::normal_distribution<float> d(0.0f, 1.0f);
+    for (int k = 0; k < FACE_ID_SIZE; k++) v[k] = d(rng);
+}
+
+// Appends a node the way enroll_face_with_name leaves a finished enrolment.
+static void listAppend(face_id_name_list *l, const char *name, const float *vec) {
+    face_id_node *n = (face_id_node *)calloc(1, sizeof(face_id_node));
+    n->id_vec = dl_matrix3d_alloc(1, 1, 1, FACE_ID_SIZE);
+    memcpy(n->id_vec->item, vec, FACE_ID_SIZE * sizeof(float));
+    strncpy(n->id_name, name, ENROLL_NAME_LEN - 1);
+    if (l->tail) l->tail->next = n; else l->head = n;
+    l->tail = n;
+    l->count++;   // uint8 in esp-face – wraps past 255, unused here
+}
+
+static void listFree(face_id_name_list *l) {
+    face_id_node *p = l->head;
+    while (p) {
+        face_id_node *next = p->next;
+        dl_matrix3d_free(p->id_vec);
+        free(p);
+        p = next;
+    }
+    l->head = l->tail = nullptr;
+    l->count = 0;
+}
+
+// INT8 re-rank source: the exact vectors, as FACE.BIN would hold them.
+static const float *g_ids     = nullptr;
+static uint64_t     g_fetches = 0;
+
+static bool fetchRow(uint32_t row, float *vec) {
+    memcpy(vec, g_ids + (size_t)row * FACE_ID_SIZE, FACE_ID_SIZE * sizeof(float));
+    g_fetches++;
+    return true;
+}
+
+struct Result {
+    int            faces;
+    bench::Samples list, gallery, q8, q8only;
+    size_t         listHeap = 0, galleryHeap = 0, q8Heap = 0;
+    int            matched = 0, mismatches = 0;
+    int            q8Diff = 0, q8onlyDiff = 0;
+    uint64_t       fetches = 0;
+};
+
+static size_t fillGallery(FaceGallery &g, const std::vector<float> &ids, int faces) {
+    char   name[ENROLL_NAME_LEN];
+    size_t h0 = bench::heapLive();
+    g.reserve((uint32_t)faces);
+    for (int i = 0; i < faces; i++) {
+        snprintf(name, sizeof(name), "U%05d", i);
+        g.add(name, &ids[(size_t)i * FACE_ID_SIZE]);
+    }
+    return bench::heapLive() - h0;
+}
+
+// Times one match and counts a disagreement with the reference decision.
+static void timeMatch(FaceGallery &g, const float *q, int refRow, bench::Samples &s, int &diff) {
+    uint64_t t0  = bench::nowUs();
+    int      row = g.match(q, FACE_REC_THRESHOLD);
+    s.add(bench::nowUs() - t0);
+    if (row != refRow) diff++;
+}
+
+static void runSize(Result &r, int queries, float noise, uint32_t seed, int topK,
+                    FaceGallery &g) {
+    std::mt19937 rng(seed);
+    std::vector<float> ids((size_t)r.faces * FACE_ID_SIZE);
+    for (int i = 0; i < r.faces; i++) randomVec(rng, &ids[(size_t)i * FACE_ID_SIZE]);
+
+    char name[ENROLL_NAME_LEN];
+    face_id_name_list list = {};
+
+    size_t h0 = bench::heapLive();
+    for (int i = 0; i < r.faces; i++) {
+        snprintf(name, sizeof(name), "U%05d", i);
+        listAppend(&list, name, &ids[(size_t)i * FACE_ID_SIZE]);
+    }
+    r.listHeap = bench::heapLive() - h0;
+
+    r.galleryHeap = fillGallery(g, ids, r.faces);
+
+    g_ids = ids.data();
+    FaceGallery q8, q8only;
+    q8.setMode(FaceGallery::INT8, fetchRow, topK);
+    q8only.setMode(FaceGallery::INT8, nullptr, topK);
+    r.q8Heap = fillGallery(q8, ids, r.faces);
+    fillGallery(q8only, ids, r.faces);
+
+    dl_matrix3d_t *q = dl_matrix3d_alloc(1, 1, 1, FACE_ID_SIZE);
+    std::normal_distribution<float>    nd(0.0f, noise);
+    std::uniform_int_distribution<int> pick(0, r.faces - 1);
+    char gname[ENROLL_NAME_LEN];
+    for (int i = 0; i < queries; i++) {
+        if (i % 4 == 3) {
+            randomVec(rng, q->item);
+        } else {
+            const float *src = &ids[(size_t)pick(rng) * FACE_ID_SIZE];
+            for (int k = 0; k < FACE_ID_SIZE; k++) q->item[k] = src[k] + nd(rng);
+        }
+
+        uint64_t t0 = bench::nowUs();
+        face_id_node *hit = recognize_face_with_name(&list, q);
+        uint64_t t1 = bench::nowUs();
+        FaceGallery::Match m;
+        int row = g.match(q->item, FACE_REC_THRESHOLD, &m);
+        memcpy(gname, m.name, ENROLL_NAME_LEN);
+        uint64_t t2 = bench::nowUs();
+        r.list.add(t1 - t0);
+        r.gallery.add(t2 - t1);
+
+        bool same = hit ? (row >= 0 && strncmp(hit->id_name, gname, ENROLL_NAME_LEN) == 0)
+                        : (row < 0);
+        if (!same) r.mismatches++;
+        if (row >= 0) r.matched++;
+
+        uint64_t f0 = g_fetches;
+        timeMatch(q8, q->item, row, r.q8, r.q8Diff);
+        r.fetches += g_fetches - f0;
+        timeMatch(q8only, q->item, row, r.q8only, r.q8onlyDiff);
+    }
+    dl_matrix3d_free(q);
+    listFree(&list);
+}
+
+// Loads FACE.BIN into two INT8 galleries – the first builds FACE.Q8, the
+// second must come from it – and checks both hold identical rows.
+static bool roundTripQ8(double &buildMs, double &loadMs) {
+    FaceGallery a, b;
+    a.setMode(FaceGallery::INT8);
+    b.setMode(FaceGallery::INT8);
+    uint64_t t0 = bench::nowUs();
+    bool ok = Bridge::loadFaceGallery(a, "/FACE.BIN");
+    uint64_t t1 = bench::nowUs();
+    ok = ok && Bridge::loadFaceGallery(b, "/FACE.BIN");
+    uint64_t t2 = bench::nowUs();
+    buildMs = (t1 - t0) / 1000.0;
+    loadMs  = (t2 - t1) / 1000.0;
+
+    ok = ok && a.count() == b.count();
+    static int8_t qa[FACE_ID_SIZE], qb[FACE_ID_SIZE];
+    char  na[ENROLL_NAME_LEN], nb[ENROLL_NAME_LEN];
+    float sa, sb, ra, rb;
+    for (uint32_t i = 0; ok && i < a.count(); i++) {
+        ok = a.exportQuantized(i, na, &sa, &ra, qa) && b.exportQuantized(i, nb, &sb, &rb, qb) &&
+             strncmp(na, nb, ENROLL_NAME_LEN) == 0 && sa == sb && ra == rb &&
+             memcmp(qa, qb, FACE_ID_SIZE) == 0;
+    }
+    return ok;
+}
+
+// Saves the gallery, reloads it into a second one, and checks every row
+// comes back (same name, same vector within float rounding); then the INT8
+// boot path through FACE.Q8.
+static bool roundTrip(FaceGallery &g, double &saveMs, double &loadMs,
+                      double &q8BuildMs, double &q8LoadMs) {
+    std::string root = bench::makeTempDir("fg_gallery_");
+    posixStorageSetRoot(root.c_str());
+    Bridge::initSD();
+    bool ok = Bridge::sdIsOk();
+
+    uint64_t t0 = bench::nowUs();
+    ok = ok && Bridge::saveFaceGallery(g, "/FACE.BIN");
+    uint64_t t1 = bench::nowUs();
+    FaceGallery back;
+    ok = ok && Bridge::loadFaceGallery(back, "/FACE.BIN");
+    uint64_t t2 = bench::nowUs();
+    saveMs = (t1 - t0) / 1000.0;
+    loadMs = (t2 - t1) / 1000.0;
+
+    ok = ok && back.count() == g.count();
+    static float a[FACE_ID_SIZE], b[FACE_ID_SIZE];
+    char na[ENROLL_NAME_LEN], nb[ENROLL_NAME_LEN];
+    for (uint32_t i = 0; ok && i < g.count(); i++) {
+        ok = g.exportRow(i, na, a) && back.exportRow(i, nb, b) &&
+             strncmp(na, nb, ENROLL_NAME_LEN) == 0;
+        for (int k = 0; ok && k < FACE_ID_SIZE; k++) ok = fabsf(a[k] - b[k]) <= 1e-4f * (1 + fabsf(a[k]));
+    }
+    ok = ok && roundTripQ8(q8BuildMs, q8LoadMs);
+    bench::rmTree(root);
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    if (a.has("help") || a.has("h")) {
+        fprintf(stderr, "usage: fg_bench_gallery [--faces N,N,...] [--queries N]\n"
+                        "                        [--noise F] [--topk N] [--seed N]\n");
+        return 2;
+    }
+    std::string facesArg = a.str("faces", "10,100,1000,5000");
+    int         queries  = (int)a.num("queries", 200);
+    float       noise    = (float)a.real("noise", 0.6);
+    int         topK     = (int)a.num("topk", FACE_GALLERY_TOPK);
+    uint32_t    seed     = (uint32_t)a.num("seed", 1);
+
+    std::vector<int> sizes;
+    std::stringstream ss(facesArg);
+    for (std::string tok; std::getline(ss, tok, ',');) {
+        int n = atoi(tok.c_str());
+        if (n < 1 || n > 65535) {
+            fprintf(stderr, "fg_bench_gallery: --faces values 1..65535\n");
+            return 2;
+        }
+        sizes.push_back(n);
+    }
+    if (sizes.empty() || queries < 1) {
+        fprintf(stderr, "fg_bench_gallery: need --faces and --queries >= 1\n");
+        return 2;
+    }
+
+    Serial.setMuted(true);
+    fprintf(stderr, "%d queries per size (1 in 4 strangers), noise sigma %.2f, threshold %.2f\n",
+            queries, noise, (double)FACE_REC_THRESHOLD);
+
+    std::unique_ptr<FaceGallery> g;
+    std::vector<Result>          results(sizes.size());
+    int totalDiff = 0;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        Result &r = results[i];
+        r.faces = sizes[i];
+        g.reset(new FaceGallery());   // fresh, so the heap column is this size only
+        runSize(r, queries, noise, seed + (uint32_t)r.faces, topK, *g);
+        totalDiff += r.mismatches + r.q8Diff;
+    }
+
+    printf("linked list vs FLOAT32 gallery\n");
+    printf("%7s %11s %11s %11s %11s %8s %10s %10s %8s %6s\n", "faces",
+           "list p50us", "list p99us", "gal p50us", "gal p99us", "speedup",
+           "list KB", "gal KB", "matched", "diff");
+    for (Result &r : results) {
+        double lp = (double)r.list.percentile(50), gp = (double)r.gallery.percentile(50);
+        printf("%7d %11.1f %11.1f %11.1f %11.1f %7.1fx %10.1f %10.1f %8d %6d\n", r.faces,
+               lp, (double)r.list.percentile(99), gp, (double)r.gallery.percentile(99),
+               gp > 0 ? lp / gp : 0.0, r.listHeap / 1024.0, r.galleryHeap / 1024.0,
+               r.matched, r.mismatches);
+    }
+
+    printf("\nFLOAT32 vs INT8 (top-%d re-rank)\n", topK);
+    printf("%7s %11s %11s %11s %8s %10s %10s %8s %6s %10s\n", "faces",
+           "f32 p50us", "i8 p50us", "i8 p99us", "speedup", "f32 KB", "i8 KB",
+           "fetch/q", "diff", "no-rerank");
+    for (Result &r : results) {
+        double fp = (double)r.gallery.percentile(50), qp = (double)r.q8.percentile(50);
+        printf("%7d %11.1f %11.1f %11.1f %7.1fx %10.1f %10.1f %8.2f %6d %10d\n", r.faces,
+               fp, qp, (double)r.q8.percentile(99), qp > 0 ? fp / qp : 0.0,
+               r.galleryHeap / 1024.0, r.q8Heap / 1024.0,
+               (double)r.fetches / queries, r.q8Diff, r.q8onlyDiff);
+    }
+
+    double saveMs = 0, loadMs = 0, q8BuildMs = 0, q8LoadMs = 0;
+    bool   rt = roundTrip(*g, saveMs, loadMs, q8BuildMs, q8LoadMs);
+    printf("\nFACE.BIN round trip (%u faces): save %.1f ms, load %.1f ms; "
+           "INT8 boot: %.1f ms building FACE.Q8, %.1f ms from FACE.Q8 – %s\n",
+           (unsigned)g->count(), saveMs, loadMs, q8BuildMs, q8LoadMs, rt ? "ok" : "MISMATCH");
+
+    return (totalDiff == 0 && rt) ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+// bench_journal.cpp  –  FaceGuard Pro  (host build only)
+// Recognition-side cost of logging a check-in: synchronous
+// Bridge::logAttendance versus Journal::post (write-behind queue + writer
+// thread), on a card with simulated open/close latency.
+//
+//   fg_bench_journal [--records 200] [--gap-us 20000] [--open-us 15000]
+//                    [--close-us 25000] [--flush-ms 500]
+//
+// Each phase logs --records distinct UIDs, one every --gap-us (the door
+// rush: a new face every few tens of ms).  Reported per phase: caller-side
+// p50/p99/max latency and total wall time; for the journal also batches,
+// synchronous fallbacks and peak queue depth.  Rows on the card are counted
+// afterwards so a lost record fails the run (exit code 1).
+
+#include "Arduino.h"
+#include "global.h"
+#include "sd_card.h"
+#include "storage_posix.h"
+#include "attendance_journal.h"
+
+#include "bench_util.h"
+
+#include <thread>
+
+static void sleepUntil(uint64_t targetUs) {
+    uint64_t now = bench::nowUs();
+    if (targetUs > now) std::this_thread::sleep_for(std::chrono::microseconds(targetUs - now));
+}
+
+// Rows in today's CSV whose UID starts with prefix.
+static int countRows(const std::string &root, const char *prefix) {
+    std::string path = root + "/atd/l_" + Bridge::getCurrentDateStr().std() + ".csv";
+    FILE *f = fopen(path.c_str(), "r");
+    if (!f) return 0;
+    char line[512];
+    int  n = 0;
+    size_t pl = strlen(prefix);
+    while (fgets(line, sizeof(line), f)) if (strncmp(line, prefix, pl) == 0) n++;
+    fclose(f);
+    return n;
+}
+
+struct Phase {
+    const char    *name;
+    bench::Samples lat;
+    uint64_t       wallUs = 0;
+};
+
+static void run(Phase &p, const char *prefix, int records, uint64_t gapUs, bool journal) {
+    char uid[32], name[32];
+    uint64_t start = bench::nowUs();
+    for (int i = 0; i < records; i++) {
+        sleepUntil(start + (uint64_t)i * gapUs);
+        snprintf(uid,  sizeof(uid),  "%s%05d", prefix, i);
+        snprintf(name, sizeof(name), "Person %s%05d", prefix, i);
+        AttendanceRecord rec = AttendanceRecord::fromFace(uid, name, "Engineering", 0.87f);
+        uint64_t t0 = bench::nowUs();
+        if (journal) Journal::post(rec);
+        else         Bridge::logAttendance(rec);
+        p.lat.add(bench::nowUs() - t0);
+    }
+    if (journal) Journal::flush(60000);
+    p.wallUs = bench::nowUs() - start;
+}
+
+static void report(const Phase &p, int rows, int expected) {
+    printf("%-10s %10.3f %10.3f %10.3f %10.1f   rows %d/%d%s\n", p.name,
+           p.lat.percentile(50) / 1000.0, p.lat.percentile(99) / 1000.0,
+           p.lat.percentile(100) / 1000.0, p.wallUs / 1000.0, rows, expected,
+           rows == expected ? "" : "  MISSING");
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    if (a.has("help") || a.has("h")) {
+        fprintf(stderr, "usage: fg_bench_journal [--records N] [--gap-us N] [--open-us N]\n"
+                        "                        [--close-us N] [--flush-ms N]\n");
+        return 2;
+    }
+    int      records = (int)a.num("records", 200);
+    uint64_t gapUs   = (uint64_t)a.num("gap-us", 20000);
+    uint32_t openUs  = (uint32_t)a.num("open-us", 15000);
+    uint32_t closeUs = (uint32_t)a.num("close-us", 25000);
+    uint32_t flushMs = (uint32_t)a.num("flush-ms", JOURNAL_MAX_FLUSH_MS);
+    if (records < 1 || records > 99999) {
+        fprintf(stderr, "fg_bench_journal: --records 1..99999\n");
+        return 2;
+    }
+
+    Serial.setMuted(true);
+    ntpSynced = true;
+    std::string root = bench::makeTempDir("fg_journal_");
+    posixStorageSetRoot(root.c_str());
+    Bridge::initSD();
+    if (!Bridge::sdIsOk()) { fprintf(stderr, "fg_bench_journal: SD init failed\n"); return 1; }
+    Bridge::loadSettings(gSettings);
+    posixStorageSetLatency(openUs, closeUs);
+
+    fprintf(stderr, "%d check-ins, one every %.1f ms; card open %.1f ms, close %.1f ms\n",
+            records, gapUs / 1000.0, openUs / 1000.0, closeUs / 1000.0);
+
+    Phase sync;    sync.name    = "sync";
+    Phase journal; journal.name = "journal";
+    run(sync, "S", records, gapUs, false);
+    Journal::begin(flushMs);
+    run(journal, "J", records, gapUs, true);
+
+    printf("%-10s %10s %10s %10s %10s\n", "path", "p50 ms", "p99 ms", "max ms", "wall ms");
+    int syncRows = countRows(root, "S");
+    int jrnRows  = countRows(root, "J");
+    report(sync, syncRows, records);
+    report(journal, jrnRows, records);
+
+    Journal::Stats st = Journal::stats();
+    printf("journal: %u batches (avg %.1f rec), %u sync fallbacks, max depth %u, "
+           "slowest batch %u ms\n", st.batches,
+           st.batches ? (double)(st.written + st.duplicates) / st.batches : 0.0,
+           st.syncFallback, st.maxDepth, st.maxBatchMs);
+
+    bench::rmTree(root);
+    return (syncRows == records && jrnRows == records) ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+// bench_longpoll.cpp  –  FaceGuard Pro  (host build only)
+// Following an enrolment from the portal: /api/enroll_status every 400 ms
+// versus the held /api/enroll_status?wait= request (long_poll.h).
+//
+//   fg_bench_longpoll [--enrolments 10] [--samples 5] [--capture-ms 700]
+//                     [--poll 400] [--timeout 10000]
+//
+// A simulated device takes --samples captures per enrolment, --capture-ms
+// apart (±50 %: faces are not always found at once).  The polling client
+// reads the state every --poll ms; the long-poll client parks a request on
+// a socketpair and reads the answer.  Reported: requests per enrolment and
+// the delay from a capture to the portal seeing it.
+
+#include "Arduino.h"
+#include "long_poll.h"
+
+#include "bench_util.h"
+
+#include <atomic>
+#include <random>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+// ─── Simulated device ────────────────────────────────────────────────────────
+static std::atomic<int>      _left{0};
+static std::atomic<bool>     _enrolling{false};
+static std::atomic<uint64_t> _changedUs{0};     // when _left last moved
+
+static bool moved(uint32_t seen) { return !_enrolling || _left != (int)seen; }
+
+static void statusJson(char *out, size_t len) {
+    snprintf(out, len, "{\"enrolling\":%d,\"left\":%d,\"total\":5,\"name\":\"Jane\"}",
+             _enrolling ? 1 : 0, (int)_left);
+}
+
+static void device(int enrolments, int samples, uint32_t captureMs, std::atomic<bool> &done) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> jitter(0.5, 1.5);
+    for (int e = 0; e < enrolments; e++) {
+        _left = samples;
+        _enrolling = true;
+        _changedUs = bench::nowUs();
+        LongPoll::notify();
+        for (int i = 0; i < samples; i++) {
+            std::this_thread::sleep_for(std::chrono::microseconds(
+                (uint64_t)(captureMs * 1000 * jitter(rng))));
+            _left--;
+            if (_left == 0) _enrolling = false;
+            _changedUs = bench::nowUs();
+            LongPoll::notify();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));   // next angle
+    }
+    done = true;
+}
+
+// ─── Clients ─────────────────────────────────────────────────────────────────
+struct Result {
+    uint32_t       requests = 0;
+    bench::Samples delay;       // µs, capture → seen
+};
+
+// Like the portal, a client only follows an enrolment it started: between
+// enrolments it waits for the next one without sending anything.
+static bool waitForEnrolment(std::atomic<bool> &done, int &seen, int samples) {
+    while (!done && !_enrolling) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    seen = samples;
+    return !done;
+}
+
+static void pollClient(uint32_t pollMs, int samples, std::atomic<bool> &done, Result &res) {
+    int seen;
+    while (waitForEnrolment(done, seen, samples)) {
+        for (;;) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(pollMs));
+            res.requests++;
+            bool enrolling = _enrolling;
+            int  left      = enrolling ? (int)_left : 0;
+            if (left != seen) {
+                res.delay.add(bench::nowUs() - _changedUs);
+                seen = left;
+            }
+            if (!enrolling) break;
+        }
+    }
+}
+
+static void longPollClient(uint32_t timeoutMs, int samples, std::atomic<bool> &done,
+                           Result &res) {
+    int  fd[2];
+    socketpair(AF_UNIX, SOCK_STREAM, 0, fd);
+    int  seen;
+    char buf[512];
+    while (waitForEnrolment(done, seen, samples)) {
+        for (;;) {
+            res.requests++;
+            if (LongPoll::park(fd[0], (uint32_t)seen, timeoutMs) < 0) return;
+            ssize_t n = read(fd[1], buf, sizeof(buf) - 1);
+            if (n <= 0) return;
+            buf[n] = '\0';
+            const char *l = strstr(buf, "\"left\":");
+            int  left      = l ? atoi(l + 7) : seen;
+            bool enrolling = strstr(buf, "\"enrolling\":1") != nullptr;
+            if (left != seen) {
+                res.delay.add(bench::nowUs() - _changedUs);
+                seen = left;
+            }
+            if (!enrolling) break;
+        }
+    }
+    close(fd[0]);
+    close(fd[1]);
+}
+
+static void report(const char *title, const Result &r, int enrolments) {
+    printf("  %-22s %13.1f %10.1f ms %10.1f ms\n", title, (double)r.requests / enrolments,
+           r.delay.percentile(50) / 1000.0, r.delay.percentile(99) / 1000.0);
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    int      enrolments = (int)a.num("enrolments", 10);
+    int      samples    = (int)a.num("samples", 5);
+    uint32_t captureMs  = (uint32_t)a.num("capture-ms", 700);
+    uint32_t pollMs     = (uint32_t)a.num("poll", 400);
+    uint32_t timeoutMs  = (uint32_t)a.num("timeout", 10000);
+    Serial.setMuted(true);
+    LongPoll::begin(moved, statusJson, nullptr);
+
+    printf("%d enrolments of %d captures, %u ms apart (±50 %%)\n\n", enrolments, samples,
+           (unsigned)captureMs);
+    printf("  %-22s %13s %13s %13s\n", "", "requests/enrol", "delay p50", "delay p99");
+
+    Result polled, held;
+    {
+        std::atomic<bool> done{false};
+        std::thread dev(device, enrolments, samples, captureMs, std::ref(done));
+        pollClient(pollMs, samples, done, polled);
+        dev.join();
+    }
+    report(("poll every " + std::to_string(pollMs) + " ms").c_str(), polled, enrolments);
+    {
+        std::atomic<bool> done{false};
+        std::thread dev(device, enrolments, samples, captureMs, std::ref(done));
+        longPollClient(timeoutMs, samples, done, held);
+        dev.join();
+    }
+    report("long poll (?wait=)", held, enrolments);
+
+    LongPoll::Stats st = LongPoll::stats();
+    printf("\n  long poll: %u held, %u answered on change, %u timed out, %u failed\n",
+           (unsigned)st.parked, (unsigned)st.changed, (unsigned)st.timedOut,
+           (unsigned)st.failed);
+    fflush(stdout);
+    _Exit(0);   // answering task runs forever
+}
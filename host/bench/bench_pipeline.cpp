@@ -0,0 +1,148 @@
+// bench_pipeline.cpp  –  FaceGuard Pro  (host build only)
+// Recognition throughput and latency: the old single attendance loop
+// (decode → detect → recognise on CPU 0) versus the three-stage pipeline
+// (recognition_pipeline.h) with the firmware's core assignment.
+//
+//   fg_bench_pipeline [--seconds 10] [--fps 25] [--pace 200]
+//                     [--decode 40] [--detect 180] [--embed 150]
+//                     [--faces 100] [--slots 5]
+//
+// Frames come from a simulated camera (FileFrameSource through the capture
+// broker).  Stage work is simulated with the given per-frame ms; a frame
+// holds a face with probability --faces %.  The ESP32's two cores are
+// modelled as two locks – simulated work holds its core's lock – so stages
+// sharing a core also share its time.  --pace is ATTEMPT_COOLDOWN.
+// Reported: frames through detection and recognitions per second,
+// end-to-end latency (frame picked → recognised) and, for the pipeline,
+// each stage's busy share and queue depth, and FramePool slot use (the
+// simulated stages allocate the firmware's matrix sizes from job.arena).
+
+#include "Arduino.h"
+#include "capture_broker.h"
+#include "recognition_pipeline.h"
+#include "file_frame_source.h"
+
+#include "bench_util.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdlib.h>
+#include <thread>
+
+// ─── Simulated device ────────────────────────────────────────────────────────
+static std::mutex       _core[2];
+static int              _coreOf[Pipeline::STAGE_COUNT];
+static uint32_t         _workMs[Pipeline::STAGE_COUNT];
+static uint32_t         _facePct = 100;
+static uint32_t         _paceMs  = 200;
+static int              _sub     = -1;
+static uint32_t         _lastMs  = 0;
+static std::atomic<uint32_t> _detected{0}, _recognised{0};
+static bench::Samples   _latency;          // written by the last stage only
+static std::mutex       _latencyMtx;
+
+static void work(Pipeline::Stage s) {
+    std::lock_guard<std::mutex> g(_core[_coreOf[s]]);
+    std::this_thread::sleep_for(std::chrono::milliseconds(_workMs[s]));
+}
+
+static bool simDecode(Pipeline::Job &job) {
+    uint32_t now = millis();
+    if (now - _lastMs < _paceMs) { delay(5); return false; }
+    _lastMs = now;
+    job.frame = Capture::next(_sub, 1000);
+    if (!job.frame) return false;
+    work(Pipeline::DECODE);
+    job.im = job.arena.matrix(160, 120, 3);      // QVGA at 1/2, as the firmware
+    return job.im != nullptr;
+}
+
+static bool simDetect(Pipeline::Job &job) {
+    work(Pipeline::DETECT);
+    _detected++;
+    // Deterministic per frame: the same frames have faces in both runs.
+    if ((job.frame->seq * 2654435761u >> 16) % 100 >= _facePct) return false;
+    job.faceIm = job.arena.matrix(120, 120, 3);  // padded face region
+    return job.faceIm != nullptr;
+}
+
+static void simRecognise(Pipeline::Job &job) {
+    if (!job.arena.matrix(56, 56, 3)) return;    // aligned face
+    work(Pipeline::RECOGNISE);
+    _recognised++;
+    std::lock_guard<std::mutex> g(_latencyMtx);
+    _latency.add(micros() - job.startUs);
+}
+
+static void simRelease(Pipeline::Job &) {}
+
+static void report(const char *name, double seconds) {
+    std::lock_guard<std::mutex> g(_latencyMtx);
+    printf("  %-22s %8.2f %8.2f %10.0f %10.0f\n", name, _detected / seconds, _recognised / seconds,
+           _latency.percentile(50) / 1000.0, _latency.percentile(99) / 1000.0);
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    double   seconds = a.real("seconds", 10);
+    _paceMs  = (uint32_t)a.num("pace", 200);
+    _facePct = (uint32_t)a.num("faces", 100);
+    _workMs[Pipeline::DECODE]    = (uint32_t)a.num("decode", 40);
+    _workMs[Pipeline::DETECT]    = (uint32_t)a.num("detect", 180);
+    _workMs[Pipeline::RECOGNISE] = (uint32_t)a.num("embed", 150);
+    Serial.setMuted(true);
+
+    FileFrameSource src((uint32_t)a.num("fps", 25));
+    src.addSynthetic(8, 12000);
+    Capture::begin(&src);
+    _sub = Capture::subscribe();
+    FramePool::begin((int)a.num("slots", FRAME_POOL_SLOTS));
+
+    printf("stage work: decode %u ms, detect %u ms, embed %u ms; faces in %u%% of frames; "
+           "pace %u ms; %.0f s per run\n\n",
+           _workMs[0], _workMs[1], _workMs[2], _facePct, _paceMs, seconds);
+    printf("  %-22s %8s %8s %10s %10s\n", "", "frames/s", "recog/s", "p50 ms", "p99 ms");
+
+    // ── Before: one loop on CPU 0 (one frame in flight) ─────────────────────
+    for (auto &c : _coreOf) c = 0;
+    {
+        uint64_t end = bench::nowUs() + (uint64_t)(seconds * 1e6);
+        while (bench::nowUs() < end) {
+            Pipeline::Job job = {};
+            job.startUs = micros();
+            if (simDecode(job) && simDetect(job)) simRecognise(job);
+            job.frame.reset();
+            FramePool::release(job.arena);
+        }
+    }
+    report("sequential (CPU 0)", seconds);
+
+    // ── After: pipeline, decode + recognise on CPU 1, detect on CPU 0 ───────
+    _detected = _recognised = 0;
+    { std::lock_guard<std::mutex> g(_latencyMtx); _latency = bench::Samples(); }
+    const int cores[Pipeline::STAGE_COUNT] = { 1, 0, 1 };
+    for (int s = 0; s < Pipeline::STAGE_COUNT; s++) _coreOf[s] = cores[s];
+    static const Pipeline::Stages stages = { simDecode, simDetect, simRecognise, simRelease };
+    Pipeline::begin(stages, cores);
+    std::this_thread::sleep_for(std::chrono::milliseconds((int64_t)(seconds * 1000)));
+    report("pipeline (1 / 0 / 1)", seconds);
+
+    Pipeline::Stats st = Pipeline::stats();
+    static const char *names[] = { "decode", "detect", "recognise" };
+    printf("\n  %-10s %6s %8s %8s %8s %7s %10s\n",
+           "stage", "done", "dropped", "avg ms", "max ms", "busy", "queue max");
+    for (int s = 0; s < Pipeline::STAGE_COUNT; s++) {
+        const Pipeline::StageStats &o = st.stage[s];
+        printf("  %-10s %6u %8u %8.1f %8.1f %6u%% %10u\n", names[s], (unsigned)o.done,
+               (unsigned)o.dropped, o.avgUs / 1000.0, o.maxUs / 1000.0, (unsigned)o.busyPct,
+               (unsigned)o.queuedMax);
+    }
+    FramePool::Stats ps = FramePool::stats();
+    printf("\n  frame pool: %u slot(s) of %u KB, peak %u in use, peak %u KB of a slot; "
+           "%u frames, %u found no slot, %u heap fallback(s)\n",
+           (unsigned)ps.slots, (unsigned)(ps.slotBytes / 1024), (unsigned)ps.peakInUse,
+           (unsigned)(ps.peakBytes / 1024), (unsigned)ps.acquired, (unsigned)ps.exhausted,
+           (unsigned)ps.fallbacks);
+    fflush(stdout);
+    _Exit(0);   // stage tasks and the broker run forever
+}
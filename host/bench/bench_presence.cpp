@@ -0,0 +1,179 @@
+// bench_presence.cpp  –  FaceGuard Pro  (host build only)
+// PresenceGate on synthetic 40×30 luma sequences (a QVGA frame at 1/8
+// scale), one scenario at a time:
+//
+//   empty      static scene, sensor noise only
+//   lighting   empty scene, lights switched on, then auto-exposure drift
+//   walkby     someone crosses the frame
+//   standing   someone walks up, stands (slight sway), walks away
+//   parked     an object is left in view
+//
+//   fg_bench_presence [--fps 5] [--noise 4] [--dir <jpegs>]
+//
+// --fps is the attendance pipeline's frame rate (ATTEMPT_COOLDOWN 200 ms → 5).
+// Per scenario: share of frames that would have run face_detect while the
+// scene was empty and while a person was in view, and the update() cost.
+// With --dir, decodeLuma() is also timed on those JPEGs.  Exit code 1 if
+// the gate misses a present person on more than 10% of frames, or runs
+// detection on more than 10% of an empty scene's frames (beyond the hold
+// and absorb windows after a change).
+
+#include "Arduino.h"
+#include "presence_gate.h"
+#include "frame_decode.h"
+#include "file_frame_source.h"
+
+#include "bench_util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const int W = 40, H = 30;
+
+struct Scene {
+    const char *name;
+    float       seconds;
+    // Fills luma for time t (s); returns true if a person is in view.
+    bool (*render)(float t, uint8_t *luma, int noise);
+};
+
+static uint32_t _rng = 12345;
+static int noiseAt(int amp) {
+    _rng = _rng * 1103515245u + 12345u;
+    return amp ? (int)((_rng >> 16) % (2 * amp + 1)) - amp : 0;
+}
+
+static void background(uint8_t *l, int offset, int noise) {
+    for (int y = 0; y < H; y++)
+        for (int x = 0; x < W; x++) {
+            int v = 60 + x * 2 + (y > 20 ? 40 : 0) + offset + noiseAt(noise);   // wall + floor
+            l[y * W + x] = (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+        }
+}
+
+// Head-and-shoulders blob, cx / cy in thumbnail pixels.
+static void person(uint8_t *l, float cx, float cy) {
+    for (int y = 0; y < H; y++)
+        for (int x = 0; x < W; x++) {
+            float dx = x - cx, dy = y - cy;
+            bool head = dx * dx / 9 + dy * dy / 16 < 1;
+            bool body = y > cy + 4 && dx > -7 && dx < 7;
+            if (head)      l[y * W + x] = 190;
+            else if (body) l[y * W + x] = 35;
+        }
+}
+
+static bool sceneEmpty(float, uint8_t *l, int noise) {
+    background(l, 0, noise);
+    return false;
+}
+
+static bool sceneLighting(float t, uint8_t *l, int noise) {
+    int off = t < 20 ? 0 : (t < 40 ? 45 : 45 - (int)((t - 40) * 1.5f));   // step, then AE pulls back
+    background(l, off, noise);
+    return false;
+}
+
+static bool sceneWalkby(float t, uint8_t *l, int noise) {
+    background(l, 0, noise);
+    if (t < 20 || t > 26) return false;
+    person(l, -6 + (t - 20) * 9, 12);      // 52 px in 6 s
+    return true;
+}
+
+static bool sceneStanding(float t, uint8_t *l, int noise) {
+    background(l, 0, noise);
+    if (t < 10 || t > 34) return false;
+    float x = t < 14 ? -6 + (t - 10) * 6.5f             // walk in
+            : t < 30 ? 20 + ((int)(t * 2) % 3) * 0.7f    // stand, slight sway
+            : 20 + (t - 30) * 6.5f;                      // walk out
+    person(l, x, 12);
+    return true;
+}
+
+// A trolley parked in view at t = 10 s: should be absorbed, not gate forever.
+static bool sceneParked(float t, uint8_t *l, int noise) {
+    background(l, 0, noise);
+    if (t >= 10)
+        for (int y = 16; y < 28; y++)
+            for (int x = 4; x < 14; x++) l[y * W + x] = 20;
+    return false;
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    double      fps   = a.real("fps", 5);
+    int         noise = (int)a.num("noise", 4);
+    std::string dir   = a.str("dir", "");
+    Serial.setMuted(true);
+
+    const Scene scenes[] = {
+        { "empty",    60, sceneEmpty    },
+        { "lighting", 60, sceneLighting },
+        { "walkby",   60, sceneWalkby   },
+        { "standing", 60, sceneStanding },
+        { "parked",   60, sceneParked   },
+    };
+
+    printf("%dx%d luma, %.1f fps, noise ±%d\n\n", W, H, fps, noise);
+    printf("  %-10s %7s %9s %9s %11s %11s %8s %8s\n", "scene", "frames", "skipped",
+           "absorbed", "run:empty", "run:person", "p50 us", "p99 us");
+
+    bool fail = false;
+    uint8_t luma[W * H];
+    for (const Scene &sc : scenes) {
+        PresenceGate  gate;
+        bench::Samples us;
+        int emptyN = 0, emptyRun = 0, presN = 0, presRun = 0;
+        int frames = (int)(sc.seconds * fps);
+        for (int i = 0; i < frames; i++) {
+            float t   = i / (float)fps;
+            bool  who = sc.render(t, luma, noise);
+            uint64_t t0 = bench::nowUs();
+            bool  run = gate.update(luma, W, H, (uint32_t)(t * 1000));
+            us.add(bench::nowUs() - t0);
+            if (i == 0) continue;                     // first frame always runs
+            (who ? presN : emptyN)++;
+            if (run) (who ? presRun : emptyRun)++;
+        }
+        // Frames run after a change are expected: the hold window, and up to
+        // PRESENCE_STILL_MS of motionless foreground before it is absorbed.
+        PresenceGate::Stats s = gate.stats();
+        float fpEmpty = emptyN ? 100.0f * emptyRun / emptyN : 0;
+        float hit     = presN  ? 100.0f * presRun  / presN  : 100;
+        float allowed = 10 + 100.0f * ((PRESENCE_HOLD_MS + PRESENCE_STILL_MS) / 1000.0f * fps)
+                                     / (emptyN ? emptyN : 1);
+        printf("  %-10s %7u %9u %9u %10.1f%% %10.1f%% %8llu %8llu\n", sc.name,
+               (unsigned)s.frames, (unsigned)s.skipped, (unsigned)s.absorbed, fpEmpty, hit,
+               (unsigned long long)us.percentile(50), (unsigned long long)us.percentile(99));
+        if (fpEmpty > allowed || hit < 90) fail = true;
+    }
+
+    if (!dir.empty()) {
+        FileFrameSource src(0);
+        size_t n = src.loadDir(dir.c_str());
+        bench::Samples dl, ds;
+        int lw = 0, lh = 0;
+        static uint8_t buf[PRESENCE_MAX_W * PRESENCE_MAX_H];
+        for (int it = 0; it < 20; it++)
+            for (size_t i = 0; i < n; i++) {
+                const auto &f = src.frame(i);
+                uint64_t t0 = bench::nowUs();
+                FrameDecode::decodeLuma(f.data(), f.size(), 3, buf, PRESENCE_MAX_W, PRESENCE_MAX_H, &lw, &lh);
+                uint64_t t1 = bench::nowUs();
+                dl_matrix3du_t *m = FrameDecode::decodeScaled(f.data(), f.size(), FRAME_DETECT_SHIFT);
+                uint64_t t2 = bench::nowUs();
+                if (m) dl_matrix3du_free(m);
+                dl.add(t1 - t0);
+                ds.add(t2 - t1);
+            }
+        if (n)
+            printf("\n%zu JPEG(s): decodeLuma %dx%d p50 %llu us, detection decode p50 %llu us\n",
+                   n, lw, lh, (unsigned long long)dl.percentile(50),
+                   (unsigned long long)ds.percentile(50));
+    }
+
+    if (fail) printf("\nFAIL: gate outside the 10%% false-run / 90%% hit bounds\n");
+    return fail ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+// bench_snapshot.cpp  –  FaceGuard Pro  (host build only)
+// Many pollers wanting a periodic thumbnail (a wall display of door
+// cameras): each poll taking a frame of its own from the capture broker –
+// what opening /stream for one picture amounts to – versus the snapshot
+// cache (snapshot_cache.h).
+//
+//   fg_bench_snapshot [--pollers 20] [--period 1000] [--max-age 1000]
+//                     [--attendance 1] [--seconds 5] [--fps 25]
+//
+// Each poller asks for a frame every --period ms (starts spread over one
+// period).  --attendance 1 keeps a recognition-like subscriber running, so
+// the camera is live; with 0 the camera idles between polls.  Reported:
+// polls served and failed, frames the camera captured per second, poll
+// latency, and the age of the frame each poll got.
+
+#include "Arduino.h"
+#include "capture_broker.h"
+#include "snapshot_cache.h"
+#include "file_frame_source.h"
+
+#include "bench_util.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static std::mutex     _mtx;
+static bench::Samples _latency, _age;       // µs, ms
+static std::atomic<uint32_t> _served{0}, _failed{0};
+
+// Before: subscribe, wait for the next frame, unsubscribe.
+static Capture::FrameRef ownFrame(uint32_t) {
+    int sub = Capture::subscribe();
+    if (sub < 0) return Capture::FrameRef();
+    Capture::FrameRef f = Capture::next(sub, SNAPSHOT_WAIT_MS);
+    Capture::unsubscribe(sub);
+    return f;
+}
+
+static void run(const char *title, Capture::FrameRef (*poll)(uint32_t), int pollers,
+                uint32_t periodMs, uint32_t maxAgeMs, double seconds) {
+    _served = _failed = 0;
+    { std::lock_guard<std::mutex> g(_mtx); _latency = bench::Samples(); _age = bench::Samples(); }
+    uint32_t captured0 = Capture::stats().captured;
+    uint64_t end = bench::nowUs() + (uint64_t)(seconds * 1e6);
+
+    std::vector<std::thread> ts;
+    for (int i = 0; i < pollers; i++) {
+        ts.emplace_back([=] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(periodMs * i / pollers));
+            while (bench::nowUs() < end) {
+                uint64_t t0 = bench::nowUs();
+                Capture::FrameRef f = poll(maxAgeMs);
+                uint64_t us = bench::nowUs() - t0;
+                if (!f) _failed++;
+                else {
+                    _served++;
+                    std::lock_guard<std::mutex> g(_mtx);
+                    _latency.add(us);
+                    _age.add(millis() - f->ms);
+                }
+                f.reset();
+                uint64_t next = t0 + (uint64_t)periodMs * 1000;
+                uint64_t now  = bench::nowUs();
+                if (next > now) std::this_thread::sleep_for(std::chrono::microseconds(next - now));
+            }
+        });
+    }
+    for (auto &t : ts) t.join();
+
+    std::lock_guard<std::mutex> g(_mtx);
+    printf("  %-22s %7u %7u %12.1f %9.1f %9.1f %9.0f %9.0f\n", title, (unsigned)_served,
+           (unsigned)_failed, (Capture::stats().captured - captured0) / seconds,
+           _latency.percentile(50) / 1000.0, _latency.percentile(99) / 1000.0,
+           (double)_age.percentile(50), (double)_age.percentile(99));
+}
+
+int main(int argc, char **argv) {
+    bench::Args a(argc, argv);
+    int      pollers    = (int)a.num("pollers", 20);
+    uint32_t period     = (uint32_t)a.num("period", 1000);
+    uint32_t maxAge     = (uint32_t)a.num("max-age", SNAPSHOT_MAX_AGE_MS);
+    bool     attendance = a.num("attendance", 1) != 0;
+    double   seconds    = a.real("seconds", 5);
+    Serial.setMuted(true);
+
+    FileFrameSource src((uint32_t)a.num("fps", 25));
+    src.addSynthetic(8, 12000);
+    Capture::begin(&src);
+    Snapshot::begin();
+
+    std::atomic<bool> stop{false};
+    std::thread atd;
+    if (attendance) {
+        atd = std::thread([&] {
+            int sub = Capture::subscribe();
+            while (!stop) Capture::next(sub, 200);
+            Capture::unsubscribe(sub);
+        });
+    }
+
+    printf("%d pollers every %u ms, max age %u ms, attendance subscriber %s; %.0f s per run\n\n",
+           pollers, (unsigned)period, (unsigned)maxAge, attendance ? "on" : "off", seconds);
+    printf("  %-22s %7s %7s %12s %9s %9s %9s %9s\n", "", "served", "failed", "camera fps",
+           "p50 ms", "p99 ms", "age p50", "age p99");
+    run("own frame per poll", ownFrame, pollers, period, maxAge, seconds);
+    run("snapshot cache", Snapshot::get, pollers, period, maxAge, seconds);
+
+    Snapshot::Stats st = Snapshot::stats();
+    printf("\n  snapshot cache: %u from a captured frame, %u refreshes, %u shared a refresh, "
+           "%u failed\n", (unsigned)st.cached, (unsigned)st.refreshed, (unsigned)st.shared,
+           (unsigned)st.failed);
+    stop = true;
+    if (atd.joinable()) atd.join();
+    fflush(stdout);
+    _Exit(0);   // broker task runs forever
+}
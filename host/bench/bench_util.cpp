@@ -0,0 +1,120 @@
+// bench_util.cpp  –  FaceGuard Pro  (host benchmarks)
+
+#include "bench_util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ftw.h>
+#include <unistd.h>
+
+namespace bench {
+
+uint64_t nowUs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t Samples::percentile(double p) const {
+    if (_v.empty()) return 0;
+    std::sort(_v.begin(), _v.end());
+    size_t idx = (size_t)((p / 100.0) * (double)(_v.size() - 1) + 0.5);
+    return _v[std::min(idx, _v.size() - 1)];
+}
+
+double Samples::mean() const {
+    if (_v.empty()) return 0;
+    double s = 0;
+    for (uint64_t x : _v) s += (double)x;
+    return s / (double)_v.size();
+}
+
+Args::Args(int argc, char **argv) : _argc(argc), _argv(argv) {}
+
+const char *Args::find(const char *name) const {
+    for (int i = 1; i < _argc; i++) {
+        if (_argv[i][0] == '-' && _argv[i][1] == '-' && strcmp(_argv[i] + 2, name) == 0)
+            return (i + 1 < _argc) ? _argv[i + 1] : "";
+    }
+    return nullptr;
+}
+
+bool        Args::has(const char *name) const { return find(name) != nullptr; }
+long        Args::num(const char *name, long def) const { const char *v = find(name); return (v && *v) ? atol(v) : def; }
+double      Args::real(const char *name, double def) const { const char *v = find(name); return (v && *v) ? atof(v) : def; }
+std::string Args::str(const char *name, const char *def) const { const char *v = find(name); return (v && *v) ? v : def; }
+
+std::string makeTempDir(const char *prefix) {
+    const char *tmp = getenv("TMPDIR");
+    std::string tpl = std::string(tmp && *tmp ? tmp : "/tmp") + "/" + prefix + "XXXXXX";
+    std::vector<char> buf(tpl.begin(), tpl.end());
+    buf.push_back('\0');
+    if (!mkdtemp(buf.data())) { perror("mkdtemp"); exit(1); }
+    return std::string(buf.data());
+}
+
+static int rmEntry(const char *path, const struct stat *, int, struct FTW *) {
+    return remove(path);
+}
+
+void rmTree(const std::string &path) {
+    nftw(path.c_str(), rmEntry, 16, FTW_DEPTH | FTW_PHYS);
+}
+
+} // namespace bench
+
+// ─── malloc interposition ────────────────────────────────────────────────────
+// glibc exports __libc_* entry points, so the executable can define malloc &
+// friends and still reach the real allocator.  malloc_usable_size() gives the
+// size to account on free without a side table.
+extern "C" {
+void *__libc_malloc(size_t);
+void *__libc_calloc(size_t, size_t);
+void *__libc_realloc(void *, size_t);
+void *__libc_memalign(size_t, size_t);
+void  __libc_free(void *);
+}
+
+static std::atomic<size_t> _live{0};
+static std::atomic<size_t> _peak{0};
+
+static inline void _track(void *p) {
+    if (!p) return;
+    size_t now = _live.fetch_add(malloc_usable_size(p)) + malloc_usable_size(p);
+    size_t pk  = _peak.load();
+    while (now > pk && !_peak.compare_exchange_weak(pk, now)) {}
+}
+static inline void _untrack(void *p) {
+    if (p) _live.fetch_sub(malloc_usable_size(p));
+}
+
+extern "C" {
+void *malloc(size_t n)            { void *p = __libc_malloc(n);    _track(p); return p; }
+void *calloc(size_t c, size_t n)  { void *p = __libc_calloc(c, n); _track(p); return p; }
+void  free(void *p)               { _untrack(p); __libc_free(p); }
+void *realloc(void *old, size_t n) {
+    _untrack(old);
+    void *p = __libc_realloc(old, n);
+    if (p) _track(p);
+    else if (old && n) _track(old);   // realloc failed: old block still live
+    return p;
+}
+void *memalign(size_t a, size_t n)      { void *p = __libc_memalign(a, n); _track(p); return p; }
+void *aligned_alloc(size_t a, size_t n) { return memalign(a, n); }
+int   posix_memalign(void **out, size_t a, size_t n) {
+    void *p = memalign(a, n);
+    if (!p) return 12;   // ENOMEM
+    *out = p;
+    return 0;
+}
+}
+
+namespace bench {
+size_t heapLive()      { return _live.load(); }
+size_t heapPeak()      { return _peak.load(); }
+void   heapResetPeak() { _peak.store(_live.load()); }
+}
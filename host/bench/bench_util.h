@@ -0,0 +1,57 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  host/bench/bench_util.h
+//  Shared helpers for the host benchmarks: a monotonic clock, latency
+//  samples with percentiles, and a heap tracker that interposes malloc so a
+//  benchmark can report the peak heap an operation needed.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Microseconds on a monotonic clock.
+uint64_t nowUs();
+
+// Collects per-iteration latencies (µs) for one operation.
+class Samples {
+public:
+    void     add(uint64_t us) { _v.push_back(us); }
+    size_t   count() const    { return _v.size(); }
+    uint64_t percentile(double p) const;   // p in [0, 100]
+    double   mean() const;
+private:
+    mutable std::vector<uint64_t> _v;
+};
+
+// ── Heap tracking (bench_util.cpp interposes malloc/calloc/realloc/free) ────
+size_t heapLive();          // bytes currently allocated
+size_t heapPeak();          // high-water mark since the last heapResetPeak()
+void   heapResetPeak();     // peak := live
+
+// Simple argv parser: --name value / --flag
+class Args {
+public:
+    Args(int argc, char **argv);
+    bool        has(const char *name) const;
+    long        num(const char *name, long def) const;
+    double      real(const char *name, double def) const;
+    std::string str(const char *name, const char *def) const;
+private:
+    const char *find(const char *name) const;
+    int    _argc;
+    char **_argv;
+};
+
+// Fresh empty directory under $TMPDIR; removed by rmTree().
+std::string makeTempDir(const char *prefix);
+void        rmTree(const std::string &path);
+
+} // namespace bench
+
+#endif // BENCH_UTIL_H
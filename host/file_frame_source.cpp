@@ -0,0 +1,99 @@
+// file_frame_source.cpp  –  FaceGuard Pro  (host build only)
+// JPEG-directory frame source for the capture broker.
+
+#include "file_frame_source.h"
+
+#include <Arduino.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+bool jpegDimensions(const uint8_t *buf, size_t len, uint16_t *w, uint16_t *h) {
+    if (len < 4 || buf[0] != 0xFF || buf[1] != 0xD8) return false;
+    size_t i = 2;
+    while (i + 9 < len) {
+        if (buf[i] != 0xFF) { i++; continue; }
+        uint8_t marker = buf[i + 1];
+        if (marker == 0xD8 || marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) { i += 2; continue; }
+        size_t seg = ((size_t)buf[i + 2] << 8) | buf[i + 3];
+        // SOF0..SOF15 except DHT (C4), JPG (C8) and DAC (CC)
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            *h = (uint16_t)((buf[i + 5] << 8) | buf[i + 6]);
+            *w = (uint16_t)((buf[i + 7] << 8) | buf[i + 8]);
+            return true;
+        }
+        if (marker == 0xDA) return false;   // scan data before any SOF
+        i += 2 + seg;
+    }
+    return false;
+}
+
+static bool _isJpeg(const char *name) {
+    const char *dot = strrchr(name, '.');
+    return dot && (strcasecmp(dot, ".jpg") == 0 || strcasecmp(dot, ".jpeg") == 0);
+}
+
+size_t FileFrameSource::loadDir(const char *dir) {
+    DIR *d = opendir(dir);
+    if (!d) return 0;
+    std::vector<std::string> names;
+    while (struct dirent *e = readdir(d))
+        if (_isJpeg(e->d_name)) names.push_back(e->d_name);
+    closedir(d);
+    std::sort(names.begin(), names.end());
+
+    for (const std::string &n : names) {
+        std::string path = std::string(dir) + "/" + n;
+        FILE *f = fopen(path.c_str(), "rb");
+        if (!f) continue;
+        Item it;
+        it.name = n;
+        fseek(f, 0, SEEK_END);
+        long sz = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        it.data.resize(sz > 0 ? (size_t)sz : 0);
+        size_t got = it.data.empty() ? 0 : fread(it.data.data(), 1, it.data.size(), f);
+        fclose(f);
+        if (got != it.data.size() || !jpegDimensions(it.data.data(), got, &it.width, &it.height)) {
+            fprintf(stderr, "file_frame_source: skipping %s (not a readable JPEG)\n", n.c_str());
+            continue;
+        }
+        _frames.push_back(std::move(it));
+    }
+    return _frames.size();
+}
+
+void FileFrameSource::addSynthetic(size_t count, size_t bytes, uint16_t w, uint16_t h) {
+    for (size_t i = 0; i < count; i++) {
+        Item it;
+        it.name   = "synthetic";
+        it.width  = w;
+        it.height = h;
+        it.data.resize(bytes);
+        for (size_t b = 0; b < bytes; b++) it.data[b] = (uint8_t)(b * 31 + i);
+        _frames.push_back(std::move(it));
+    }
+}
+
+bool FileFrameSource::grab(Grab &g) {
+    if (_frames.empty()) return false;
+    if (_fps) {
+        // Fixed cadence like the sensor: wait for the next frame slot.
+        uint64_t now = micros();
+        if (_nextUs > now)
+            std::this_thread::sleep_for(std::chrono::microseconds(_nextUs - now));
+        _nextUs = std::max<uint64_t>(_nextUs, now) + 1000000ull / _fps;
+    }
+    const Item &it = _frames[_grabs++ % _frames.size()];
+    g.buf    = it.data.data();
+    g.len    = it.data.size();
+    g.width  = it.width;
+    g.height = it.height;
+    g.format = CAPTURE_FORMAT_JPEG;
+    g.handle = nullptr;
+    return true;
+}
@@ -0,0 +1,54 @@
+#ifndef FILE_FRAME_SOURCE_H
+#define FILE_FRAME_SOURCE_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  file_frame_source.h  (host build only)
+//  Camera stand-in for Capture::begin(): plays the JPEG files of a directory
+//  in name order, looping, at a fixed frame rate (the OV2640 paces grabs by
+//  VSYNC the same way).  Files are read into memory up front so disk I/O
+//  stays out of throughput numbers.  Without a directory it plays synthetic
+//  frames of a given size.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "capture_broker.h"
+
+class FileFrameSource : public Capture::FrameSource {
+public:
+    // fps 0 = as fast as the broker asks.
+    explicit FileFrameSource(uint32_t fps = 25) : _fps(fps) {}
+
+    // Loads every *.jpg / *.jpeg in dir.  Returns the number of frames.
+    size_t loadDir(const char *dir);
+
+    // Adds `count` synthetic w×h frames of `bytes` each (not decodable).
+    void   addSynthetic(size_t count, size_t bytes, uint16_t w = 320, uint16_t h = 240);
+
+    size_t frames() const { return _frames.size(); }
+    const std::vector<uint8_t> &frame(size_t i) const { return _frames[i].data; }
+    const std::string          &name(size_t i)  const { return _frames[i].name; }
+
+    bool grab(Grab &g) override;
+    void release(Grab &g) override {}
+
+    uint64_t grabs() const { return _grabs; }
+
+private:
+    struct Item {
+        std::string          name;
+        std::vector<uint8_t> data;
+        uint16_t             width;
+        uint16_t             height;
+    };
+    std::vector<Item> _frames;
+    uint32_t          _fps;
+    uint64_t          _grabs  = 0;
+    uint64_t          _nextUs = 0;
+};
+
+// Width / height from a JPEG's SOF marker; false if none is found.
+bool jpegDimensions(const uint8_t *buf, size_t len, uint16_t *w, uint16_t *h);
+
+#endif // FILE_FRAME_SOURCE_H
@@ -0,0 +1,10 @@
+// host_globals.cpp  –  FaceGuard Pro  (host build only)
+// Definitions for the globals declared in global.h that the device build
+// provides from main.cpp / app_httpd.cpp, neither of which is compiled here.
+
+#include "global.h"
+
+bool               ntpSynced = false;
+AttendanceSettings gSettings;
+face_id_name_list  id_list   = {};
+FaceGallery        faceGallery;
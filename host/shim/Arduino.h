@@ -0,0 +1,136 @@
+#ifndef HOST_ARDUINO_SHIM_H
+#define HOST_ARDUINO_SHIM_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  host/shim/Arduino.h
+//  Just enough of the ESP32 Arduino core for the portable firmware sources
+//  (sd_card.cpp and friends) to compile and run on Linux: String, Serial,
+//  millis/delay, and the ESP32 time helpers configTime / getLocalTime.
+//  Not a general-purpose Arduino emulation — extend it only as far as the
+//  firmware sources actually need.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <string>
+
+// ─── String ──────────────────────────────────────────────────────────────────
+class String {
+public:
+    String() {}
+    String(const char *s)          : _s(s ? s : "") {}
+    String(const std::string &s)   : _s(s) {}
+    explicit String(char c)        : _s(1, c) {}
+    explicit String(int v)         : _s(std::to_string(v)) {}
+    explicit String(unsigned v)    : _s(std::to_string(v)) {}
+    explicit String(long v)        : _s(std::to_string(v)) {}
+    explicit String(unsigned long v) : _s(std::to_string(v)) {}
+    explicit String(double v, unsigned decimals = 2) {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+        _s = buf;
+    }
+
+    unsigned int length() const { return (unsigned int)_s.size(); }
+    const char  *c_str()  const { return _s.c_str(); }
+    bool         reserve(unsigned int n) { _s.reserve(n); return true; }
+
+    char  operator[](unsigned int i) const { return i < _s.size() ? _s[i] : 0; }
+    char &operator[](unsigned int i)       { return _s[i]; }
+    char       *begin()       { return &_s[0]; }
+    char       *end()         { return &_s[0] + _s.size(); }
+    const char *begin() const { return _s.data(); }
+    const char *end()   const { return _s.data() + _s.size(); }
+
+    String &operator+=(const String &o) { _s += o._s; return *this; }
+    String &operator+=(const char *o)   { if (o) _s += o; return *this; }
+    String &operator+=(char c)          { _s += c; return *this; }
+    String &operator+=(int v)           { _s += std::to_string(v); return *this; }
+    bool concat(const char *o, unsigned int n) { _s.append(o, n); return true; }
+
+    bool operator==(const String &o) const { return _s == o._s; }
+    bool operator==(const char *o)   const { return _s == (o ? o : ""); }
+    bool operator!=(const String &o) const { return !(*this == o); }
+    bool operator!=(const char *o)   const { return !(*this == o); }
+    bool operator<(const String &o)  const { return _s < o._s; }
+
+    int indexOf(char c, unsigned int from = 0) const {
+        size_t p = _s.find(c, from);
+        return p == std::string::npos ? -1 : (int)p;
+    }
+    int indexOf(const char *s, unsigned int from = 0) const {
+        size_t p = _s.find(s, from);
+        return p == std::string::npos ? -1 : (int)p;
+    }
+    int indexOf(const String &s, unsigned int from = 0) const { return indexOf(s.c_str(), from); }
+
+    String substring(unsigned int from) const {
+        return from >= _s.size() ? String() : String(_s.substr(from));
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) { unsigned int t = from; from = to; to = t; }
+        if (from >= _s.size()) return String();
+        if (to > _s.size()) to = (unsigned int)_s.size();
+        return String(_s.substr(from, to - from));
+    }
+
+    bool startsWith(const String &p) const { return _s.compare(0, p._s.size(), p._s) == 0; }
+    bool endsWith(const String &p) const {
+        return _s.size() >= p._s.size() &&
+               _s.compare(_s.size() - p._s.size(), p._s.size(), p._s) == 0;
+    }
+
+    void trim() {
+        size_t b = 0, e = _s.size();
+        while (b < e && isspace((unsigned char)_s[b]))     b++;
+        while (e > b && isspace((unsigned char)_s[e - 1])) e--;
+        _s = _s.substr(b, e - b);
+    }
+    void toLowerCase() { for (auto &c : _s) c = (char)tolower((unsigned char)c); }
+    void toUpperCase() { for (auto &c : _s) c = (char)toupper((unsigned char)c); }
+    long toInt() const { return atol(_s.c_str()); }
+
+    const std::string &std() const { return _s; }
+
+private:
+    std::string _s;
+};
+
+inline String operator+(const String &a, const String &b) { String r(a); r += b; return r; }
+inline String operator+(const String &a, const char *b)   { String r(a); r += b; return r; }
+inline String operator+(const char *a, const String &b)   { String r(a); r += b; return r; }
+inline String operator+(const String &a, char b)          { String r(a); r += b; return r; }
+
+// ─── Serial ──────────────────────────────────────────────────────────────────
+// Writes to stderr.  Host benchmarks mute it so per-record log lines do not
+// dominate the numbers being measured.
+class HostSerial {
+public:
+    void   begin(unsigned long) {}
+    void   setMuted(bool m) { _muted = m; }
+    size_t print(const char *s);
+    size_t print(const String &s)   { return print(s.c_str()); }
+    size_t println(const char *s = "");
+    size_t println(const String &s) { return println(s.c_str()); }
+    size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+private:
+    bool _muted = false;
+};
+extern HostSerial Serial;
+
+// ─── Timing ──────────────────────────────────────────────────────────────────
+unsigned long millis();
+unsigned long micros();
+void          delay(unsigned long ms);
+
+// ─── ESP32 time helpers (esp32-hal-time.c) ───────────────────────────────────
+// The host always has a valid wall clock, so getLocalTime() never fails.
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1,
+                const char *server2 = nullptr, const char *server3 = nullptr);
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+
+#endif // HOST_ARDUINO_SHIM_H
@@ -0,0 +1,425 @@
+#ifndef HOST_ARDUINOJSON_SHIM_H
+#define HOST_ARDUINOJSON_SHIM_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  host/shim/ArduinoJson.h
+//  Host stand-in for the subset of ArduinoJson 6 used by the firmware:
+//  DynamicJsonDocument, JsonArray, JsonObject, member/element proxies with
+//  `operator|` defaults, deserializeJson() and serializeJson() over String
+//  and StorageFile.
+//
+//  Capacity is honoured the way ArduinoJson 6 honours it on the ESP32: every
+//  value costs one 16-byte slot, and strings that ArduinoJson would copy
+//  (String values, everything parsed) cost their length + 1.  Once the budget
+//  is spent, new members/elements are silently dropped and overflowed()
+//  turns true — so host benchmarks see the same truncation the device does.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "Arduino.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace JsonShim {
+
+static const size_t kSlotSize = 16;   // sizeof(VariantSlot) on 32-bit targets
+
+struct Node {
+    enum Type : uint8_t { Null, Bool, Int, Float, Str, Array, Object };
+    Type                               type = Null;
+    bool                               b    = false;
+    long long                          i    = 0;
+    double                             f    = 0;
+    std::string                        s;
+    std::string                        key;       // member name when inside an object
+    std::vector<std::unique_ptr<Node>> children;  // array elements / object members
+
+    void reset() { type = Null; b = false; i = 0; f = 0; s.clear(); children.clear(); }
+    Node *member(const char *k) const {
+        if (type != Object || !k) return nullptr;
+        for (auto &c : children) if (c->key == k) return c.get();
+        return nullptr;
+    }
+};
+
+class Pool {
+public:
+    explicit Pool(size_t cap) : _cap(cap) {}
+    bool alloc(size_t n) {
+        if (_used + n > _cap) { _overflowed = true; return false; }
+        _used += n;
+        return true;
+    }
+    void   clear()            { _used = 0; _overflowed = false; }
+    size_t used() const       { return _used; }
+    size_t capacity() const   { return _cap; }
+    bool   overflowed() const { return _overflowed; }
+private:
+    size_t _cap;
+    size_t _used       = 0;
+    bool   _overflowed = false;
+};
+
+} // namespace JsonShim
+
+class JsonArray;
+class JsonObject;
+
+// ─── JsonVariant: value handle or pending member/element proxy ──────────────
+class JsonVariant {
+public:
+    JsonVariant() {}
+    JsonVariant(JsonShim::Pool *p, JsonShim::Node *n) : _pool(p), _node(n) {}
+    JsonVariant(JsonShim::Pool *p, JsonShim::Node *parent, const char *key)
+        : _pool(p), _parent(parent), _key(key ? key : "") , _isMember(true) {}
+
+    bool isNull() const { JsonShim::Node *n = resolve(); return !n || n->type == JsonShim::Node::Null; }
+
+    // ── Reading ──────────────────────────────────────────────────────────────
+    template <typename T> T as() const { return convert((T *)nullptr); }
+    template <typename T> operator T() const { return as<T>(); }
+
+    template <typename T> T operator|(T def) const {
+        JsonShim::Node *n = resolve();
+        if (!n || !compatible(n, (T *)nullptr)) return def;
+        return as<T>();
+    }
+
+    JsonVariant operator[](const char *key) const { return JsonVariant(_pool, resolve(), key); }
+    JsonVariant operator[](const String &key) const { return (*this)[key.c_str()]; }
+    JsonVariant operator[](size_t idx) const {
+        JsonShim::Node *n = resolve();
+        if (!n || n->type != JsonShim::Node::Array || idx >= n->children.size())
+            return JsonVariant();
+        return JsonVariant(_pool, n->children[idx].get());
+    }
+    JsonVariant operator[](int idx) const { return (*this)[(size_t)idx]; }
+
+    bool containsKey(const char *key) const {
+        JsonShim::Node *n = resolve();
+        return n && n->member(key);
+    }
+
+    // ── Writing ──────────────────────────────────────────────────────────────
+    JsonVariant &operator=(const char *v)         { setStr(v, false); return *this; }
+    JsonVariant &operator=(char *v)               { setStr(v, true);  return *this; }
+    JsonVariant &operator=(const String &v)       { setStr(v.c_str(), true); return *this; }
+    JsonVariant &operator=(bool v)                { if (auto n = slot()) { n->reset(); n->type = JsonShim::Node::Bool; n->b = v; } return *this; }
+    JsonVariant &operator=(int v)                 { return setInt(v); }
+    JsonVariant &operator=(unsigned v)            { return setInt(v); }
+    JsonVariant &operator=(long v)                { return setInt(v); }
+    JsonVariant &operator=(unsigned long v)       { return setInt((long long)v); }
+    JsonVariant &operator=(long long v)           { return setInt(v); }
+    JsonVariant &operator=(unsigned long long v)  { return setInt((long long)v); }
+    JsonVariant &operator=(double v)              { if (auto n = slot()) { n->reset(); n->type = JsonShim::Node::Float; n->f = v; } return *this; }
+    JsonVariant &operator=(float v)               { return (*this = (double)v); }
+    JsonVariant &operator=(const JsonVariant &)   = delete;
+
+    JsonShim::Node *node() const { return resolve(); }
+    JsonShim::Pool *pool() const { return _pool; }
+
+private:
+    JsonShim::Node *resolve() const {
+        if (!_isMember) return _node;
+        return _parent ? _parent->member(_key.c_str()) : nullptr;
+    }
+
+    // Returns the node to write into, creating the member if needed.
+    JsonShim::Node *slot() {
+        JsonShim::Node *n = resolve();
+        if (n || !_isMember || !_parent || !_pool) return n;
+        if (_parent->type == JsonShim::Node::Null) _parent->type = JsonShim::Node::Object;
+        if (_parent->type != JsonShim::Node::Object) return nullptr;
+        if (!_pool->alloc(JsonShim::kSlotSize)) return nullptr;
+        std::unique_ptr<JsonShim::Node> m(new JsonShim::Node());
+        m->key = _key;
+        n = m.get();
+        _parent->children.push_back(std::move(m));
+        return n;
+    }
+
+    void setStr(const char *v, bool copied) {
+        JsonShim::Node *n = slot();
+        if (!n) return;
+        n->reset();
+        if (!v) return;
+        if (copied && !_pool->alloc(strlen(v) + 1)) return;
+        n->type = JsonShim::Node::Str;
+        n->s    = v;
+    }
+
+    JsonVariant &setInt(long long v) {
+        if (auto n = slot()) { n->reset(); n->type = JsonShim::Node::Int; n->i = v; }
+        return *this;
+    }
+
+    static bool compatible(JsonShim::Node *n, const char **) { return n->type == JsonShim::Node::Str; }
+    static bool compatible(JsonShim::Node *n, String *)      { return n->type == JsonShim::Node::Str; }
+    static bool compatible(JsonShim::Node *n, bool *)        { return n->type == JsonShim::Node::Bool; }
+    template <typename T>
+    static bool compatible(JsonShim::Node *n, T *) {
+        return n->type == JsonShim::Node::Int || n->type == JsonShim::Node::Float;
+    }
+
+    const char *convert(const char **) const {
+        JsonShim::Node *n = resolve();
+        return (n && n->type == JsonShim::Node::Str) ? n->s.c_str() : nullptr;
+    }
+    String convert(String *) const {
+        const char *s = convert((const char **)nullptr);
+        return String(s ? s : "");
+    }
+    bool convert(bool *) const {
+        JsonShim::Node *n = resolve();
+        if (!n) return false;
+        if (n->type == JsonShim::Node::Bool) return n->b;
+        if (n->type == JsonShim::Node::Int)  return n->i != 0;
+        return false;
+    }
+    JsonArray  convert(JsonArray *) const;
+    JsonObject convert(JsonObject *) const;
+    template <typename T>
+    T convert(T *) const {
+        static_assert(std::is_arithmetic<T>::value, "unsupported JsonVariant conversion");
+        JsonShim::Node *n = resolve();
+        if (!n) return T();
+        if (n->type == JsonShim::Node::Int)   return (T)n->i;
+        if (n->type == JsonShim::Node::Float) return (T)n->f;
+        if (n->type == JsonShim::Node::Bool)  return (T)n->b;
+        return T();
+    }
+
+    JsonShim::Pool *_pool   = nullptr;
+    JsonShim::Node *_node   = nullptr;
+    JsonShim::Node *_parent = nullptr;
+    std::string     _key;
+    bool            _isMember = false;
+};
+
+// ─── JsonArray / JsonObject ──────────────────────────────────────────────────
+class JsonObject {
+public:
+    JsonObject() {}
+    JsonObject(JsonShim::Pool *p, JsonShim::Node *n) : _pool(p), _node(n) {}
+    bool isNull() const { return !_node; }
+
+    JsonVariant operator[](const char *key) const { return JsonVariant(_pool, _node, key); }
+    JsonVariant operator[](const String &key) const { return (*this)[key.c_str()]; }
+    bool containsKey(const char *key) const { return _node && _node->member(key); }
+    JsonArray  createNestedArray(const char *key) const;
+    JsonObject createNestedObject(const char *key) const;
+    size_t size() const { return _node ? _node->children.size() : 0; }
+
+private:
+    JsonShim::Node *addMember(const char *key, JsonShim::Node::Type t) const;
+    JsonShim::Pool *_pool = nullptr;
+    JsonShim::Node *_node = nullptr;
+};
+
+class JsonArray {
+public:
+    JsonArray() {}
+    JsonArray(JsonShim::Pool *p, JsonShim::Node *n) : _pool(p), _node(n) {}
+    bool isNull() const { return !_node; }
+
+    class iterator {
+    public:
+        iterator(JsonShim::Pool *p, std::vector<std::unique_ptr<JsonShim::Node>>::iterator it)
+            : _p(p), _it(it) {}
+        JsonVariant operator*() const { return JsonVariant(_p, _it->get()); }
+        iterator &operator++() { ++_it; return *this; }
+        bool operator!=(const iterator &o) const { return _it != o._it; }
+    private:
+        JsonShim::Pool *_p;
+        std::vector<std::unique_ptr<JsonShim::Node>>::iterator _it;
+    };
+    iterator begin() const { return _node ? iterator(_pool, _node->children.begin()) : iterator(_pool, _empty().begin()); }
+    iterator end()   const { return _node ? iterator(_pool, _node->children.end())   : iterator(_pool, _empty().end()); }
+
+    size_t size() const { return _node ? _node->children.size() : 0; }
+    JsonVariant operator[](size_t i) const {
+        return (_node && i < _node->children.size()) ? JsonVariant(_pool, _node->children[i].get())
+                                                     : JsonVariant();
+    }
+    JsonVariant operator[](int i) const { return (*this)[(size_t)i]; }
+    void remove(size_t i) const {
+        // Like ArduinoJson 6, removal does not give the slot back to the pool.
+        if (_node && i < _node->children.size()) _node->children.erase(_node->children.begin() + i);
+    }
+    void remove(int i) const { remove((size_t)i); }
+
+    JsonObject createNestedObject() const {
+        JsonShim::Node *n = addElement(JsonShim::Node::Object);
+        return JsonObject(n ? _pool : nullptr, n);
+    }
+    JsonArray createNestedArray() const {
+        JsonShim::Node *n = addElement(JsonShim::Node::Array);
+        return JsonArray(n ? _pool : nullptr, n);
+    }
+    template <typename T> bool add(const T &v) const {
+        JsonShim::Node *n = addElement(JsonShim::Node::Null);
+        if (!n) return false;
+        assign(n, v);
+        return true;
+    }
+
+private:
+    static std::vector<std::unique_ptr<JsonShim::Node>> &_empty() {
+        static std::vector<std::unique_ptr<JsonShim::Node>> e;
+        return e;
+    }
+    JsonShim::Node *addElement(JsonShim::Node::Type t) const {
+        if (!_node || !_pool || !_pool->alloc(JsonShim::kSlotSize)) return nullptr;
+        std::unique_ptr<JsonShim::Node> n(new JsonShim::Node());
+        n->type = t;
+        JsonShim::Node *raw = n.get();
+        _node->children.push_back(std::move(n));
+        return raw;
+    }
+    void assign(JsonShim::Node *n, const char *v) const { n->type = JsonShim::Node::Str; n->s = v ? v : ""; }
+    void assign(JsonShim::Node *n, const String &v) const {
+        if (!_pool->alloc(v.length() + 1)) return;
+        n->type = JsonShim::Node::Str; n->s = v.c_str();
+    }
+    void assign(JsonShim::Node *n, bool v) const { n->type = JsonShim::Node::Bool; n->b = v; }
+    void assign(JsonShim::Node *n, double v) const { n->type = JsonShim::Node::Float; n->f = v; }
+    void assign(JsonShim::Node *n, float v) const { assign(n, (double)v); }
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value>::type
+    assign(JsonShim::Node *n, T v) const { n->type = JsonShim::Node::Int; n->i = (long long)v; }
+    template <size_t N>
+    void assign(JsonShim::Node *n, const char (&v)[N]) const { assign(n, (const char *)v); }
+
+    JsonShim::Pool *_pool = nullptr;
+    JsonShim::Node *_node = nullptr;
+};
+
+inline JsonShim::Node *JsonObject::addMember(const char *key, JsonShim::Node::Type t) const {
+    if (!_node || !_pool || !_pool->alloc(JsonShim::kSlotSize)) return nullptr;
+    std::unique_ptr<JsonShim::Node> n(new JsonShim::Node());
+    n->type = t;
+    n->key  = key ? key : "";
+    JsonShim::Node *raw = n.get();
+    _node->children.push_back(std::move(n));
+    return raw;
+}
+inline JsonArray JsonObject::createNestedArray(const char *key) const {
+    JsonShim::Node *n = addMember(key, JsonShim::Node::Array);
+    return JsonArray(n ? _pool : nullptr, n);
+}
+inline JsonObject JsonObject::createNestedObject(const char *key) const {
+    JsonShim::Node *n = addMember(key, JsonShim::Node::Object);
+    return JsonObject(n ? _pool : nullptr, n);
+}
+
+inline JsonArray JsonVariant::convert(JsonArray *) const {
+    JsonShim::Node *n = resolve();
+    return (n && n->type == JsonShim::Node::Array) ? JsonArray(_pool, n) : JsonArray();
+}
+inline JsonObject JsonVariant::convert(JsonObject *) const {
+    JsonShim::Node *n = resolve();
+    return (n && n->type == JsonShim::Node::Object) ? JsonObject(_pool, n) : JsonObject();
+}
+
+// ─── DynamicJsonDocument ─────────────────────────────────────────────────────
+class DynamicJsonDocument {
+public:
+    explicit DynamicJsonDocument(size_t capacity) : _pool(capacity) {}
+
+    template <typename T> T to() { clear(); return toImpl((T *)nullptr); }
+    template <typename T> T as() { return JsonVariant(&_pool, &_root).as<T>(); }
+
+    JsonVariant operator[](const char *key)   { return JsonVariant(&_pool, &_root, key); }
+    JsonVariant operator[](const String &key) { return (*this)[key.c_str()]; }
+    bool containsKey(const char *key) const   { return _root.member(key) != nullptr; }
+
+    void   clear()              { _root.reset(); _pool.clear(); }
+    size_t memoryUsage() const  { return _pool.used(); }
+    size_t capacity() const     { return _pool.capacity(); }
+    bool   overflowed() const   { return _pool.overflowed(); }
+
+    JsonShim::Node &root()      { return _root; }
+    JsonShim::Pool &pool()      { return _pool; }
+
+private:
+    JsonArray toImpl(JsonArray *) {
+        _root.type = JsonShim::Node::Array;
+        return JsonArray(&_pool, &_root);
+    }
+    JsonObject toImpl(JsonObject *) {
+        _root.type = JsonShim::Node::Object;
+        return JsonObject(&_pool, &_root);
+    }
+
+    JsonShim::Pool _pool;
+    JsonShim::Node _root;
+};
+
+// ─── DeserializationError ────────────────────────────────────────────────────
+class DeserializationError {
+public:
+    enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory, TooDeep };
+    DeserializationError(Code c = Ok) : _code(c) {}
+    Code code() const { return _code; }
+    bool operator==(Code c) const { return _code == c; }
+    bool operator!=(Code c) const { return _code != c; }
+    explicit operator bool() const { return _code != Ok; }
+    const char *c_str() const {
+        static const char *names[] = { "Ok", "EmptyInput", "IncompleteInput",
+                                       "InvalidInput", "NoMemory", "TooDeep" };
+        return names[_code];
+    }
+private:
+    Code _code;
+};
+
+// ─── Parser / serializer (arduinojson_shim.cpp) ──────────────────────────────
+namespace JsonShim {
+
+// Byte source: returns the next byte or -1 at end of input.
+typedef int (*ReadFn)(void *ctx);
+// Byte sink: appends n bytes; returns bytes accepted.
+typedef size_t (*WriteFn)(void *ctx, const char *data, size_t n);
+
+DeserializationError parse(Node &root, Pool &pool, ReadFn rd, void *ctx);
+size_t               write(const Node &root, WriteFn wr, void *ctx);
+
+inline int    readString(void *ctx)  { const char **p = (const char **)ctx;
+                                       return **p ? (unsigned char)*(*p)++ : -1; }
+template <typename F>
+inline int    readFile(void *ctx)    { return ((F *)ctx)->read(); }
+inline size_t writeString(void *ctx, const char *d, size_t n) { ((String *)ctx)->concat(d, n); return n; }
+template <typename F>
+inline size_t writeFile(void *ctx, const char *d, size_t n)   { return ((F *)ctx)->write(d, n); }
+
+} // namespace JsonShim
+
+inline DeserializationError deserializeJson(DynamicJsonDocument &doc, const char *json) {
+    doc.clear();
+    const char *cursor = json ? json : "";
+    return JsonShim::parse(doc.root(), doc.pool(), JsonShim::readString, &cursor);
+}
+inline DeserializationError deserializeJson(DynamicJsonDocument &doc, const String &json) {
+    return deserializeJson(doc, json.c_str());
+}
+inline DeserializationError deserializeJson(DynamicJsonDocument &doc, String &json) {
+    return deserializeJson(doc, json.c_str());
+}
+template <typename File>
+inline DeserializationError deserializeJson(DynamicJsonDocument &doc, File &f) {
+    doc.clear();
+    return JsonShim::parse(doc.root(), doc.pool(), JsonShim::readFile<File>, &f);
+}
+
+inline size_t serializeJson(DynamicJsonDocument &doc, String &out) {
+    out = "";
+    return JsonShim::write(doc.root(), JsonShim::writeString, &out);
+}
+template <typename File>
+inline size_t serializeJson(DynamicJsonDocument &doc, File &f) {
+    return JsonShim::write(doc.root(), JsonShim::writeFile<File>, &f);
+}
+
+#endif // HOST_ARDUINOJSON_SHIM_H
@@ -0,0 +1,25 @@
+#ifndef HOST_WIFI_SHIM_H
+#define HOST_WIFI_SHIM_H
+
+// FaceGuard Pro  –  host/shim/WiFi.h
+// The host build has no station interface; getStatusJSON() reports it as
+// disconnected with a 0.0.0.0 address.
+
+#include "Arduino.h"
+
+typedef enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 } wl_status_t;
+
+class IPAddress {
+public:
+    String toString() const { return String("0.0.0.0"); }
+};
+
+class HostWiFi {
+public:
+    wl_status_t status() const { return WL_DISCONNECTED; }
+    IPAddress   localIP() const { return IPAddress(); }
+};
+
+static HostWiFi WiFi;
+
+#endif // HOST_WIFI_SHIM_H
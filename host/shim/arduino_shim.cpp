@@ -0,0 +1,53 @@
+// arduino_shim.cpp  –  FaceGuard Pro  (host build only)
+// Implementation of the host Arduino shim declared in shim/Arduino.h.
+
+#include "Arduino.h"
+
+#include <chrono>
+#include <stdarg.h>
+#include <thread>
+
+HostSerial Serial;
+
+size_t HostSerial::print(const char *s) {
+    if (_muted) return strlen(s);
+    return fputs(s, stderr) < 0 ? 0 : strlen(s);
+}
+
+size_t HostSerial::println(const char *s) {
+    size_t n = print(s);
+    return n + print("\n");
+}
+
+size_t HostSerial::printf(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = _muted ? vsnprintf(nullptr, 0, fmt, ap) : vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    return n < 0 ? 0 : (size_t)n;
+}
+
+static const auto _boot = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - _boot).count();
+}
+
+unsigned long micros() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - _boot).count();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void configTime(long, int, const char *, const char *, const char *) {
+    // Host clock is already set; the GMT offset is taken from the TZ variable.
+}
+
+bool getLocalTime(struct tm *info, uint32_t) {
+    time_t now = time(nullptr);
+    return localtime_r(&now, info) != nullptr;
+}
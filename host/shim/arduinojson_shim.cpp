@@ -0,0 +1,260 @@
+// arduinojson_shim.cpp  –  FaceGuard Pro  (host build only)
+// JSON text <-> JsonShim::Node tree for the host ArduinoJson stand-in.
+
+#include "ArduinoJson.h"
+
+#include <stdlib.h>
+
+namespace JsonShim {
+
+namespace {
+
+static const int kMaxDepth = 10;   // ARDUINOJSON_DEFAULT_NESTING_LIMIT
+
+class Parser {
+public:
+    Parser(Pool &pool, ReadFn rd, void *ctx) : _pool(pool), _rd(rd), _ctx(ctx) { next(); }
+
+    DeserializationError run(Node &root) {
+        skipWs();
+        if (_c < 0) return DeserializationError::EmptyInput;
+        DeserializationError err = value(root, 0);
+        return err;
+    }
+
+private:
+    void next() { _c = _rd(_ctx); }
+    void skipWs() { while (_c == ' ' || _c == '\t' || _c == '\n' || _c == '\r') next(); }
+
+    DeserializationError value(Node &n, int depth) {
+        if (depth > kMaxDepth) return DeserializationError::TooDeep;
+        skipWs();
+        switch (_c) {
+            case -1:  return DeserializationError::IncompleteInput;
+            case '{': return object(n, depth);
+            case '[': return array(n, depth);
+            case '"': {
+                n.type = Node::Str;
+                DeserializationError e = string(n.s);
+                if (e != DeserializationError::Ok) return e;
+                return _pool.alloc(n.s.size() + 1) ? DeserializationError::Ok
+                                                   : DeserializationError::NoMemory;
+            }
+            case 't': n.type = Node::Bool; n.b = true;  return literal("true");
+            case 'f': n.type = Node::Bool; n.b = false; return literal("false");
+            case 'n': n.type = Node::Null;              return literal("null");
+            default:  return number(n);
+        }
+    }
+
+    DeserializationError literal(const char *word) {
+        for (const char *p = word; *p; p++) {
+            if (_c < 0)   return DeserializationError::IncompleteInput;
+            if (_c != *p) return DeserializationError::InvalidInput;
+            next();
+        }
+        return DeserializationError::Ok;
+    }
+
+    DeserializationError number(Node &n) {
+        std::string t;
+        while (_c == '-' || _c == '+' || _c == '.' || _c == 'e' || _c == 'E' ||
+               (_c >= '0' && _c <= '9')) {
+            t += (char)_c;
+            next();
+        }
+        if (t.empty()) return (_c < 0) ? DeserializationError::IncompleteInput
+                                       : DeserializationError::InvalidInput;
+        if (t.find_first_of(".eE") == std::string::npos) {
+            n.type = Node::Int;
+            n.i    = strtoll(t.c_str(), nullptr, 10);
+        } else {
+            n.type = Node::Float;
+            n.f    = strtod(t.c_str(), nullptr);
+        }
+        return DeserializationError::Ok;
+    }
+
+    static void putUtf8(std::string &out, unsigned cp) {
+        if (cp < 0x80)       { out += (char)cp; }
+        else if (cp < 0x800) { out += (char)(0xC0 | (cp >> 6)); out += (char)(0x80 | (cp & 0x3F)); }
+        else                 { out += (char)(0xE0 | (cp >> 12));
+                               out += (char)(0x80 | ((cp >> 6) & 0x3F));
+                               out += (char)(0x80 | (cp & 0x3F)); }
+    }
+
+    DeserializationError string(std::string &out) {
+        next();   // opening quote
+        out.clear();
+        while (true) {
+            if (_c < 0) return DeserializationError::IncompleteInput;
+            if (_c == '"') { next(); return DeserializationError::Ok; }
+            if (_c == '\\') {
+                next();
+                switch (_c) {
+                    case '"':  out += '"';  break;
+                    case '\\': out += '\\'; break;
+                    case '/':  out += '/';  break;
+                    case 'b':  out += '\b'; break;
+                    case 'f':  out += '\f'; break;
+                    case 'n':  out += '\n'; break;
+                    case 'r':  out += '\r'; break;
+                    case 't':  out += '\t'; break;
+                    case 'u': {
+                        unsigned cp = 0;
+                        for (int k = 0; k < 4; k++) {
+                            next();
+                            if (_c < 0 || !isxdigit(_c)) return DeserializationError::InvalidInput;
+                            cp = cp * 16 + (unsigned)(isdigit(_c) ? _c - '0' : (tolower(_c) - 'a' + 10));
+                        }
+                        putUtf8(out, cp);
+                        break;
+                    }
+                    case -1:  return DeserializationError::IncompleteInput;
+                    default:  return DeserializationError::InvalidInput;
+                }
+                next();
+                continue;
+            }
+            out += (char)_c;
+            next();
+        }
+    }
+
+    DeserializationError array(Node &n, int depth) {
+        n.type = Node::Array;
+        next();
+        skipWs();
+        if (_c == ']') { next(); return DeserializationError::Ok; }
+        while (true) {
+            if (!_pool.alloc(kSlotSize)) return DeserializationError::NoMemory;
+            std::unique_ptr<Node> child(new Node());
+            DeserializationError e = value(*child, depth + 1);
+            n.children.push_back(std::move(child));
+            if (e != DeserializationError::Ok) return e;
+            skipWs();
+            if (_c == ',') { next(); continue; }
+            if (_c == ']') { next(); return DeserializationError::Ok; }
+            return (_c < 0) ? DeserializationError::IncompleteInput
+                            : DeserializationError::InvalidInput;
+        }
+    }
+
+    DeserializationError object(Node &n, int depth) {
+        n.type = Node::Object;
+        next();
+        skipWs();
+        if (_c == '}') { next(); return DeserializationError::Ok; }
+        while (true) {
+            skipWs();
+            if (_c != '"') return (_c < 0) ? DeserializationError::IncompleteInput
+                                           : DeserializationError::InvalidInput;
+            std::unique_ptr<Node> child(new Node());
+            DeserializationError e = string(child->key);
+            if (e != DeserializationError::Ok) return e;
+            if (!_pool.alloc(kSlotSize + child->key.size() + 1))
+                return DeserializationError::NoMemory;
+            skipWs();
+            if (_c != ':') return (_c < 0) ? DeserializationError::IncompleteInput
+                                           : DeserializationError::InvalidInput;
+            next();
+            e = value(*child, depth + 1);
+            n.children.push_back(std::move(child));
+            if (e != DeserializationError::Ok) return e;
+            skipWs();
+            if (_c == ',') { next(); continue; }
+            if (_c == '}') { next(); return DeserializationError::Ok; }
+            return (_c < 0) ? DeserializationError::IncompleteInput
+                            : DeserializationError::InvalidInput;
+        }
+    }
+
+    Pool   &_pool;
+    ReadFn  _rd;
+    void   *_ctx;
+    int     _c = -1;
+};
+
+class Writer {
+public:
+    Writer(WriteFn wr, void *ctx) : _wr(wr), _ctx(ctx) {}
+    ~Writer() { flush(); }
+
+    void put(char c) { if (_n == sizeof(_buf)) flush(); _buf[_n++] = c; }
+    void put(const char *s) { while (*s) put(*s++); }
+    size_t flush() {
+        if (_n) { _total += _wr(_ctx, _buf, _n); _n = 0; }
+        return _total;
+    }
+
+    void str(const std::string &s) {
+        put('"');
+        for (unsigned char c : s) {
+            switch (c) {
+                case '"':  put("\\\""); break;
+                case '\\': put("\\\\"); break;
+                case '\b': put("\\b");  break;
+                case '\f': put("\\f");  break;
+                case '\n': put("\\n");  break;
+                case '\r': put("\\r");  break;
+                case '\t': put("\\t");  break;
+                default:
+                    if (c < 0x20) { char u[8]; snprintf(u, sizeof(u), "\\u%04x", c); put(u); }
+                    else put((char)c);
+            }
+        }
+        put('"');
+    }
+
+    void node(const Node &n) {
+        char num[32];
+        switch (n.type) {
+            case Node::Null:  put("null"); break;
+            case Node::Bool:  put(n.b ? "true" : "false"); break;
+            case Node::Int:   snprintf(num, sizeof(num), "%lld", n.i); put(num); break;
+            case Node::Float: snprintf(num, sizeof(num), "%.9g", n.f); put(num); break;
+            case Node::Str:   str(n.s); break;
+            case Node::Array:
+                put('[');
+                for (size_t k = 0; k < n.children.size(); k++) {
+                    if (k) put(',');
+                    node(*n.children[k]);
+                }
+                put(']');
+                break;
+            case Node::Object:
+                put('{');
+                for (size_t k = 0; k < n.children.size(); k++) {
+                    if (k) put(',');
+                    str(n.children[k]->key);
+                    put(':');
+                    node(*n.children[k]);
+                }
+                put('}');
+                break;
+        }
+    }
+
+private:
+    WriteFn _wr;
+    void   *_ctx;
+    char    _buf[256];
+    size_t  _n     = 0;
+    size_t  _total = 0;
+};
+
+} // namespace
+
+DeserializationError parse(Node &root, Pool &pool, ReadFn rd, void *ctx) {
+    root.reset();
+    Parser p(pool, rd, ctx);
+    return p.run(root);
+}
+
+size_t write(const Node &root, WriteFn wr, void *ctx) {
+    Writer w(wr, ctx);
+    w.node(root);
+    return w.flush();
+}
+
+} // namespace JsonShim
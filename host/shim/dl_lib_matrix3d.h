@@ -0,0 +1,40 @@
+#ifndef HOST_DL_LIB_MATRIX3D_H
+#define HOST_DL_LIB_MATRIX3D_H
+
+// FaceGuard Pro  –  host/shim/dl_lib_matrix3d.h
+// Layout-compatible subset of esp-face's dl_lib_matrix3d.h: the matrix types
+// and the allocators the firmware calls directly.  Inference entry points
+// (face_detect, get_face_id, align_face) are declared but not provided.
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef float   fptp_t;
+typedef uint8_t uc_t;
+
+typedef struct {
+    int     w;        // width
+    int     h;        // height
+    int     c;        // channel
+    int     n;        // number of filter, input and output must be 1
+    int     stride;   // step between lines
+    fptp_t *item;     // data
+} dl_matrix3d_t;
+
+typedef struct {
+    int   w;
+    int   h;
+    int   c;
+    int   n;
+    int   stride;
+    uc_t *item;
+} dl_matrix3du_t;
+
+void          *dl_lib_calloc(int cnt, int size, int align);
+void           dl_lib_free(void *d);
+dl_matrix3d_t *dl_matrix3d_alloc(int n, int w, int h, int c);
+void           dl_matrix3d_free(dl_matrix3d_t *m);
+dl_matrix3du_t *dl_matrix3du_alloc(int n, int w, int h, int c);
+void           dl_matrix3du_free(dl_matrix3du_t *m);
+
+#endif // HOST_DL_LIB_MATRIX3D_H
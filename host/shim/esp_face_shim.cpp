@@ -0,0 +1,78 @@
+// esp_face_shim.cpp  –  FaceGuard Pro  (host build only)
+// Allocators and list bookkeeping from esp-face, re-implemented with malloc so
+// FACE.BIN persistence can run on the host, plus the linked-list matcher.
+
+#include "fr_forward.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+void *dl_lib_calloc(int cnt, int size, int align) {
+    (void)align;
+    return calloc((size_t)cnt, (size_t)size);
+}
+
+void dl_lib_free(void *d) { free(d); }
+
+dl_matrix3d_t *dl_matrix3d_alloc(int n, int w, int h, int c) {
+    dl_matrix3d_t *m = (dl_matrix3d_t *)calloc(1, sizeof(dl_matrix3d_t));
+    if (!m) return nullptr;
+    m->item = (fptp_t *)calloc((size_t)n * w * h * c, sizeof(fptp_t));
+    if (!m->item) { free(m); return nullptr; }
+    m->n = n; m->w = w; m->h = h; m->c = c; m->stride = w * c;
+    return m;
+}
+
+void dl_matrix3d_free(dl_matrix3d_t *m) {
+    if (!m) return;
+    free(m->item);
+    free(m);
+}
+
+dl_matrix3du_t *dl_matrix3du_alloc(int n, int w, int h, int c) {
+    dl_matrix3du_t *m = (dl_matrix3du_t *)calloc(1, sizeof(dl_matrix3du_t));
+    if (!m) return nullptr;
+    m->item = (uc_t *)calloc((size_t)n * w * h * c, sizeof(uc_t));
+    if (!m->item) { free(m); return nullptr; }
+    m->n = n; m->w = w; m->h = h; m->c = c; m->stride = w * c;
+    return m;
+}
+
+void dl_matrix3du_free(dl_matrix3du_t *m) {
+    if (!m) return;
+    free(m->item);
+    free(m);
+}
+
+void face_id_name_init(face_id_name_list *l, uint8_t size, uint8_t confirm_times) {
+    l->head = l->tail = nullptr;
+    l->count = 0;
+    l->size = size;
+    l->confirm_times = confirm_times;
+}
+
+// Same arithmetic as esp-face: both norms recomputed on every call and the
+// division done per element.
+fptp_t cos_distance(dl_matrix3d_t *id_1, dl_matrix3d_t *id_2) {
+    int    c  = id_1->c;
+    fptp_t n1 = 0, n2 = 0, dist = 0;
+    for (int i = 0; i < c; i++) {
+        n1 += id_1->item[i] * id_1->item[i];
+        n2 += id_2->item[i] * id_2->item[i];
+    }
+    n1 = sqrtf(n1);
+    n2 = sqrtf(n2);
+    for (int i = 0; i < c; i++) dist += (id_1->item[i] * id_2->item[i]) / (n1 * n2);
+    return dist;
+}
+
+face_id_node *recognize_face_with_name(face_id_name_list *l, dl_matrix3d_t *algined_face) {
+    face_id_node *best    = nullptr;
+    fptp_t        bestSim = -1;
+    for (face_id_node *p = l->head; p; p = p->next) {
+        fptp_t sim = cos_distance(p->id_vec, algined_face);
+        if (sim > FACE_REC_THRESHOLD && sim > bestSim) { bestSim = sim; best = p; }
+    }
+    return best;
+}
@@ -0,0 +1,34 @@
+#ifndef HOST_ESP_JPG_DECODE_H
+#define HOST_ESP_JPG_DECODE_H
+
+// FaceGuard Pro  –  host/shim/esp_jpg_decode.h
+// esp32-camera's JPEG decoder entry point, implemented on libjpeg
+// (jpeg_shim.cpp).  Scaling uses libjpeg's DCT-domain scale_denom, the same
+// technique as TJpgDec's JD_SCALE on the device.  The writer receives one
+// full-width RGB row per call instead of one MCU.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK    0
+#define ESP_FAIL -1
+#endif
+
+typedef enum {
+    JPG_SCALE_NONE,
+    JPG_SCALE_2X,
+    JPG_SCALE_4X,
+    JPG_SCALE_8X,
+    JPG_SCALE_MAX = JPG_SCALE_8X
+} jpg_scale_t;
+
+typedef size_t (*jpg_reader_cb)(void *arg, size_t index, uint8_t *buf, size_t len);
+typedef bool   (*jpg_writer_cb)(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                                uint8_t *data);
+
+esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader,
+                         jpg_writer_cb writer, void *arg);
+
+#endif // HOST_ESP_JPG_DECODE_H
@@ -0,0 +1,39 @@
+#ifndef HOST_FD_FORWARD_H
+#define HOST_FD_FORWARD_H
+
+// FaceGuard Pro  –  host/shim/fd_forward.h
+// Type-level stand-in for esp-face's MTMN detector header.
+
+#include "dl_lib_matrix3d.h"
+
+typedef struct { fptp_t box_p[4]; } box_t;
+typedef struct { fptp_t landmark_p[10]; } landmark_t;
+
+typedef struct tag_box_list {
+    fptp_t     *score;
+    box_t      *box;
+    landmark_t *landmark;
+    int         len;
+} box_array_t;
+
+typedef enum { FAST = 0, NORMAL = 1 } mtmn_resize_type;
+
+typedef struct {
+    float score;
+    float nms;
+    int   candidate_number;
+} threshold_config_t;
+
+typedef struct {
+    mtmn_resize_type   type;
+    int                min_face;
+    float              pyramid;
+    int                pyramid_times;
+    threshold_config_t p_threshold;
+    threshold_config_t r_threshold;
+    threshold_config_t o_threshold;
+} mtmn_config_t;
+
+box_array_t *face_detect(dl_matrix3du_t *image_matrix, mtmn_config_t *config);
+
+#endif // HOST_FD_FORWARD_H
@@ -0,0 +1,40 @@
+#ifndef HOST_FR_FORWARD_H
+#define HOST_FR_FORWARD_H
+
+// FaceGuard Pro  –  host/shim/fr_forward.h
+// Type-level stand-in for esp-face's recognition header: the enrolled-face
+// linked list and the list-walking matcher (cos_distance /
+// recognize_face_with_name are re-implemented so host benchmarks can compare
+// against them).
+
+#include "dl_lib_matrix3d.h"
+#include "fd_forward.h"
+
+#define FACE_WIDTH           56
+#define FACE_HEIGHT          56
+#define FACE_ID_SIZE         512
+#define FACE_REC_THRESHOLD   0.55
+#define ENROLL_NAME_LEN      16
+
+typedef struct tag_face_id_node {
+    struct tag_face_id_node *next;
+    char                     id_name[ENROLL_NAME_LEN];
+    dl_matrix3d_t           *id_vec;
+} face_id_node;
+
+typedef struct {
+    face_id_node *head;
+    face_id_node *tail;
+    uint8_t       count;
+    uint8_t       size;
+    uint8_t       confirm_times;
+} face_id_name_list;
+
+void           face_id_name_init(face_id_name_list *l, uint8_t size, uint8_t confirm_times);
+dl_matrix3d_t *get_face_id(dl_matrix3du_t *aligned_face);
+int8_t         align_face(box_array_t *onet_boxes, dl_matrix3du_t *src, dl_matrix3du_t *dest);
+fptp_t         cos_distance(dl_matrix3d_t *id_1, dl_matrix3d_t *id_2);
+face_id_node  *recognize_face_with_name(face_id_name_list *l, dl_matrix3d_t *algined_face);
+int8_t         enroll_face_with_name(face_id_name_list *l, dl_matrix3d_t *new_id, char *name);
+
+#endif // HOST_FR_FORWARD_H
@@ -0,0 +1,66 @@
+// jpeg_shim.cpp  –  FaceGuard Pro  (host build only)
+// esp_jpg_decode() on libjpeg, with the callback protocol of esp32-camera's
+// version: writer(0, 0, w, h, NULL) to start, RGB blocks top to bottom,
+// writer(w, h, 0, 0, NULL) to finish; a false return from the writer stops
+// decoding with ESP_FAIL.
+
+#include "esp_jpg_decode.h"
+
+#include <stdio.h>
+#include <setjmp.h>
+#include <vector>
+#include <jpeglib.h>
+
+namespace {
+
+struct ErrorMgr {
+    jpeg_error_mgr pub;
+    jmp_buf        jump;
+};
+
+void onError(j_common_ptr c) {
+    longjmp(((ErrorMgr *)c->err)->jump, 1);
+}
+
+} // namespace
+
+esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader,
+                         jpg_writer_cb writer, void *arg) {
+    std::vector<uint8_t> in(len);
+    if (reader(arg, 0, in.data(), len) != len) return ESP_FAIL;
+
+    jpeg_decompress_struct cinfo;
+    ErrorMgr               err;
+    cinfo.err = jpeg_std_error(&err.pub);
+    err.pub.error_exit = onError;
+    std::vector<uint8_t> row;
+    if (setjmp(err.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        return ESP_FAIL;
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, in.data(), (unsigned long)len);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.scale_num       = 1;
+    cinfo.scale_denom     = 1u << scale;
+    jpeg_start_decompress(&cinfo);
+
+    uint16_t w = (uint16_t)cinfo.output_width, h = (uint16_t)cinfo.output_height;
+    esp_err_t res = ESP_OK;
+    if (!writer(arg, 0, 0, w, h, nullptr)) {
+        res = ESP_FAIL;
+    } else {
+        row.resize((size_t)w * 3);
+        while (cinfo.output_scanline < cinfo.output_height) {
+            uint16_t y   = (uint16_t)cinfo.output_scanline;
+            JSAMPROW ptr = row.data();
+            jpeg_read_scanlines(&cinfo, &ptr, 1);
+            if (!writer(arg, 0, y, w, 1, row.data())) { res = ESP_FAIL; break; }
+        }
+        if (res == ESP_OK) writer(arg, w, h, 0, 0, nullptr);
+    }
+    if (res == ESP_OK) jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return res;
+}
@@ -0,0 +1,241 @@
+// storage_posix.cpp  –  FaceGuard Pro  (host build only)
+// POSIX directory-tree backend behind storage_backend.h.
+
+#include "storage_posix.h"
+#include "storage_backend.h"
+#include "Arduino.h"
+
+#include <errno.h>
+#include <mutex>
+#include <thread>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+
+static char              _root[512] = {0};
+static PosixStorageStats _stats     = {};
+
+void posixStorageSetRoot(const char *root) {
+    strncpy(_root, root ? root : "", sizeof(_root) - 1);
+    // Strip a trailing '/' so "<root>" + "/atd/…" never doubles the separator
+    size_t n = strlen(_root);
+    while (n > 1 && _root[n - 1] == '/') _root[--n] = '\0';
+}
+
+const char *posixStorageRoot() {
+    if (_root[0] == '\0') {
+        const char *env = getenv("FACEGUARD_SD_ROOT");
+        posixStorageSetRoot(env && env[0] ? env : "./sdcard");
+    }
+    return _root;
+}
+
+PosixStorageStats posixStorageStats()      { return _stats; }
+void              posixStorageResetStats() { _stats = {}; }
+
+static uint32_t _openUs = 0, _closeUs = 0;
+
+void posixStorageSetLatency(uint32_t openUs, uint32_t closeUs) {
+    _openUs  = openUs;
+    _closeUs = closeUs;
+}
+
+static void simulateLatency(uint32_t us) {
+    if (us) std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// Card path → host path under the root.  False if it does not fit in
+// `size`: the caller fails rather than touch a truncated path.
+static bool hostPath(const char *path, char *out, size_t size) {
+    int n = snprintf(out, size, "%s%s%s", posixStorageRoot(),
+                     (path[0] == '/') ? "" : "/", path);
+    return n >= 0 && (size_t)n < size;
+}
+
+// ─── Lock ────────────────────────────────────────────────────────────────────
+static std::recursive_timed_mutex _lock;
+
+void storageLockInit() {}
+
+bool storageLockTake(uint32_t timeoutMs) {
+    return _lock.try_lock_for(std::chrono::milliseconds(timeoutMs));
+}
+
+void storageLockGive() { _lock.unlock(); }
+
+// ─── PosixFile ───────────────────────────────────────────────────────────────
+bool PosixFile::open(const char *path, int oflag) {
+    close();
+    simulateLatency(_openUs);
+    if (!hostPath(path, _path, sizeof(_path))) return false;
+    const char *slash = strrchr(path, '/');
+    strncpy(_name, slash ? slash + 1 : path, sizeof(_name) - 1);
+
+    struct stat st;
+    if (stat(_path, &st) == 0 && S_ISDIR(st.st_mode)) {
+        _dir = opendir(_path);
+        if (_dir) _stats.fileOpens++;
+        return _dir != nullptr;
+    }
+
+    const char *mode = "rb";
+    int acc = oflag & O_ACCMODE;
+    if (acc != O_RDONLY) {
+        if (oflag & O_APPEND)      mode = (acc == O_RDWR) ? "a+b" : "ab";
+        else if (oflag & O_TRUNC)  mode = (acc == O_RDWR) ? "w+b" : "wb";
+        else if (stat(_path, &st) == 0) mode = "r+b";
+        else if (oflag & O_CREAT)  mode = "w+b";
+        else return false;
+    }
+    _fp = fopen(_path, mode);
+    if (!_fp) return false;
+    _stats.fileOpens++;
+    _writable = (acc != O_RDONLY);
+    _size     = (fstat(fileno(_fp), &st) == 0) ? (uint64_t)st.st_size : 0;
+    return true;
+}
+
+bool PosixFile::openNext(PosixFile *dir, int oflag) {
+    close();
+    if (!dir || !dir->_dir) return false;
+    struct dirent *e;
+    while ((e = readdir(dir->_dir)) != nullptr) {
+        if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0) continue;
+        // Re-express as a card path relative to the root for open()
+        const char *rel = dir->_path + strlen(posixStorageRoot());
+        char child[512];
+        int  n = snprintf(child, sizeof(child), "%s/%s", rel, e->d_name);
+        if (n < 0 || (size_t)n >= sizeof(child)) continue;     // too long to open: skip it
+        return open(child, oflag);
+    }
+    return false;
+}
+
+bool PosixFile::close() {
+    if (_fp && _writable) simulateLatency(_closeUs);
+    if (_fp)  { fclose(_fp);    _fp  = nullptr; }
+    if (_dir) { closedir(_dir); _dir = nullptr; }
+    return true;
+}
+
+int PosixFile::read() {
+    if (!_fp) return -1;
+    int c = fgetc(_fp);
+    if (c >= 0) _stats.bytesRead++;
+    return c;
+}
+
+int PosixFile::read(void *buf, size_t n) {
+    if (!_fp) return -1;
+    size_t got = fread(buf, 1, n, _fp);
+    _stats.bytesRead += got;
+    return (int)got;
+}
+
+int PosixFile::available() {
+    if (!_fp) return 0;
+    uint64_t sz = fileSize(), pos = curPosition();
+    return (pos < sz) ? (int)((sz - pos) > 0x7FFFFFFF ? 0x7FFFFFFF : (sz - pos)) : 0;
+}
+
+uint64_t PosixFile::fileSize() const {
+    if (!_fp) return 0;
+    // Read-only handles keep the size captured at open(): available() is
+    // called once per CSV line and must not cost a flush + fstat each time.
+    if (!_writable) return _size;
+    struct stat st;
+    fflush(_fp);
+    if (fstat(fileno(_fp), &st) != 0) return 0;
+    return (uint64_t)st.st_size;
+}
+
+uint64_t PosixFile::curPosition() const {
+    if (!_fp) return 0;
+    long p = ftell(_fp);
+    return p < 0 ? 0 : (uint64_t)p;
+}
+
+bool PosixFile::seekSet(uint64_t pos) {
+    return _fp && fseek(_fp, (long)pos, SEEK_SET) == 0;
+}
+
+size_t PosixFile::getName(char *name, size_t size) const {
+    if (!size) return 0;
+    strncpy(name, _name, size - 1);
+    name[size - 1] = '\0';
+    return strlen(name);
+}
+
+size_t PosixFile::write(const void *buf, size_t n) {
+    if (!_fp) return 0;
+    size_t put = fwrite(buf, 1, n, _fp);
+    _stats.bytesWritten += put;
+    return put;
+}
+
+size_t PosixFile::print(const char *s)   { return write(s, strlen(s)); }
+size_t PosixFile::print(const String &s) { return write(s.c_str(), s.length()); }
+
+size_t PosixFile::println(const char *s) {
+    size_t n = print(s);
+    return n + write("\r\n", 2);
+}
+
+bool PosixFile::sync() { return _fp && fflush(_fp) == 0; }
+
+// ─── PosixVolume ─────────────────────────────────────────────────────────────
+static bool rootStatvfs(struct statvfs &sv) {
+    return statvfs(posixStorageRoot(), &sv) == 0;
+}
+
+static uint32_t clamp32(uint64_t v) { return v > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)v; }
+
+uint32_t PosixVolume::bytesPerCluster() const {
+    struct statvfs sv;
+    return rootStatvfs(sv) ? clamp32(sv.f_frsize) : 0;
+}
+
+uint32_t PosixVolume::clusterCount() const {
+    struct statvfs sv;
+    return rootStatvfs(sv) ? clamp32(sv.f_blocks) : 0;
+}
+
+uint32_t PosixVolume::freeClusterCount() const {
+    struct statvfs sv;
+    return rootStatvfs(sv) ? clamp32(sv.f_bavail) : 0;
+}
+
+// ─── PosixFs ─────────────────────────────────────────────────────────────────
+bool PosixFs::begin(const char *root) {
+    if (root) posixStorageSetRoot(root);
+    struct stat st;
+    if (stat(posixStorageRoot(), &st) != 0) {
+        if (::mkdir(posixStorageRoot(), 0755) != 0) return false;
+        return true;
+    }
+    return S_ISDIR(st.st_mode);
+}
+
+bool PosixFs::exists(const char *path) const {
+    char p[512];
+    struct stat st;
+    return hostPath(path, p, sizeof(p)) && stat(p, &st) == 0;
+}
+
+bool PosixFs::mkdir(const char *path) {
+    char p[512];
+    if (!hostPath(path, p, sizeof(p))) return false;
+    return ::mkdir(p, 0755) == 0 || errno == EEXIST;
+}
+
+bool PosixFs::remove(const char *path) {
+    char p[512];
+    return hostPath(path, p, sizeof(p)) && ::unlink(p) == 0;
+}
+
+bool PosixFs::rename(const char *from, const char *to) {
+    char a[512], b[512];
+    return hostPath(from, a, sizeof(a)) && hostPath(to, b, sizeof(b)) && ::rename(a, b) == 0;
+}
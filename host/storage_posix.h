@@ -0,0 +1,101 @@
+#ifndef STORAGE_POSIX_H
+#define STORAGE_POSIX_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  storage_posix.h  (host build only)
+//  POSIX stand-in for SdFat32 / File32.  Every absolute card path ("/atd/…")
+//  is resolved below a root directory on the host, so a copy of a real SD card
+//  (or a synthetic corpus) can be mounted by pointing the root at it.
+//
+//  Only the subset of the File32 API that sd_card.cpp uses is provided.
+//  Reads go through stdio so single-byte read() calls hit a buffer, the same
+//  way File32 reads hit SdFat's 512-byte sector cache on the device.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <dirent.h>
+
+class String;
+
+// ── Root directory standing in for the card ──────────────────────────────────
+// Defaults to $FACEGUARD_SD_ROOT, else "./sdcard".
+void        posixStorageSetRoot(const char *root);
+const char *posixStorageRoot();
+
+// ── I/O accounting (for host benchmarks) ─────────────────────────────────────
+struct PosixStorageStats {
+    uint64_t bytesRead;     // bytes handed to callers by read()
+    uint64_t bytesWritten;  // bytes accepted by write()/print()
+    uint32_t fileOpens;     // successful PosixFile::open / openNext calls
+};
+PosixStorageStats posixStorageStats();
+void              posixStorageResetStats();
+
+// ── Simulated card latency (for host benchmarks) ─────────────────────────────
+// Sleeps openUs in every open() and closeUs when a writable handle is closed
+// (FAT directory-entry update + sector flush), roughly what a slow SD card
+// costs per append.  Both default to 0.
+void posixStorageSetLatency(uint32_t openUs, uint32_t closeUs);
+
+class PosixFile {
+public:
+    PosixFile() {}
+    ~PosixFile() { close(); }
+    PosixFile(const PosixFile &) = delete;
+    PosixFile &operator=(const PosixFile &) = delete;
+
+    // oflag uses the <fcntl.h> O_* constants, exactly as SdFat does.
+    bool open(const char *path, int oflag = O_RDONLY);
+    bool openNext(PosixFile *dir, int oflag = O_RDONLY);
+    bool close();
+    bool isOpen() const       { return _fp || _dir; }
+    bool isDirectory() const  { return _dir != nullptr; }
+
+    int      read();
+    int      read(void *buf, size_t n);
+    int      available();
+    uint64_t fileSize() const;
+    uint64_t curPosition() const;
+    bool     seekSet(uint64_t pos);
+    size_t   getName(char *name, size_t size) const;
+
+    size_t write(uint8_t b)                 { return write(&b, 1); }
+    size_t write(const void *buf, size_t n);
+    size_t print(const char *s);
+    size_t print(const String &s);
+    size_t println(const char *s);
+    bool   sync();
+
+private:
+    FILE    *_fp       = nullptr;
+    DIR     *_dir      = nullptr;
+    bool     _writable = false;
+    uint64_t _size     = 0;       // size at open (read-only handles)
+    char     _path[512] = {0};    // host path (root-prefixed)
+    char     _name[256] = {0};    // last path component
+};
+
+// Cluster statistics mapped onto statvfs() of the root directory.
+class PosixVolume {
+public:
+    uint32_t bytesPerCluster() const;
+    uint32_t clusterCount() const;
+    uint32_t freeClusterCount() const;
+};
+
+class PosixFs {
+public:
+    bool begin(const char *root = nullptr);
+    bool exists(const char *path) const;
+    bool mkdir(const char *path);
+    bool remove(const char *path);
+    bool rename(const char *from, const char *to);
+    PosixVolume *vol() { return &_vol; }
+private:
+    PosixVolume _vol;
+};
+
+#endif // STORAGE_POSIX_H
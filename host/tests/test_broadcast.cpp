@@ -0,0 +1,176 @@
+// test_broadcast.cpp  –  FaceGuard Pro  (host build only)
+// The MJPEG broadcaster (stream_broadcast.h) against socketpair viewers:
+// one render per captured frame however many viewers there are, latest-
+// frame-wins skipping for a viewer that cannot keep up, and the send-time
+// controller backing a slow viewer off (interval up, quality down) while a
+// fast one keeps every frame at full quality.
+
+#include "Arduino.h"
+#include "capture_broker.h"
+#include "stream_broadcast.h"
+#include "file_frame_source.h"
+#include "test_check.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+static const uint32_t kFps     = 25;
+static const size_t   kBytes   = 12000;
+static const uint32_t kRunMs   = 4000;
+
+// ─── Simulated render: 20 ms on one shared core ──────────────────────────────
+static std::mutex            _core;
+static std::atomic<uint32_t> _renders{0};
+
+static bool render(Broadcast::Part &p, const Broadcast::Want &want) {
+    {
+        std::lock_guard<std::mutex> g(_core);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        _renders++;
+    }
+    if (want.plain) {
+        size_t len = p.plainLen * want.quality / 90;
+        p.encoded = (uint8_t *)malloc(len);
+        if (!p.encoded) return false;
+        memcpy(p.encoded, p.plain, len);
+        p.plain    = p.encoded;
+        p.plainLen = len;
+        p.quality  = want.quality;
+    }
+    return true;
+}
+
+// ─── Viewers ─────────────────────────────────────────────────────────────────
+struct Viewer {
+    uint32_t              kbps = 0;         // 0: reads as fast as it can
+    uint32_t              targetMs = BROADCAST_TARGET_MS;
+    int                   fd[2] = { -1, -1 };   // [0] broadcaster side, [1] client side
+    int                   id = -1;          // slot in Stats::viewer is id & 0xFF
+    std::atomic<bool>     stop{false};
+    std::atomic<uint32_t> parts{0};
+    std::thread           reader;
+};
+
+// Counts complete multipart parts (Content-Length framed).
+static void readLoop(Viewer *v) {
+    std::vector<uint8_t> buf;
+    uint8_t tmp[4096];
+    size_t  chunk = v->kbps ? std::min<size_t>(v->kbps * 1024 / 100, sizeof(tmp)) : sizeof(tmp);
+    while (!v->stop) {
+        ssize_t r = recv(v->fd[1], tmp, chunk, 0);
+        if (r <= 0) break;
+        buf.insert(buf.end(), tmp, tmp + r);
+        for (;;) {
+            static const uint8_t crlf2[] = { '\r', '\n', '\r', '\n' };
+            auto he = std::search(buf.begin(), buf.end(), crlf2, crlf2 + 4);
+            if (he == buf.end()) break;
+            std::string hdr(buf.begin(), he);
+            size_t bodyAt = (he - buf.begin()) + 4;
+            const char *cl = strstr(hdr.c_str(), "Content-Length: ");
+            if (!cl) { buf.erase(buf.begin(), buf.begin() + bodyAt); continue; }   // HTTP head
+            size_t n = strtoul(cl + 16, nullptr, 10);
+            if (buf.size() < bodyAt + n) break;
+            v->parts++;
+            buf.erase(buf.begin(), buf.begin() + bodyAt + n);
+        }
+        if (v->kbps) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+static Viewer *connect(uint32_t kbps, uint32_t targetMs) {
+    Viewer *v   = new Viewer();
+    v->kbps     = kbps;
+    v->targetMs = targetMs;
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, v->fd) == 0);
+    int sz = 5744 / 2;      // the kernel doubles it: ESP32 lwip TCP_SND_BUF
+    setsockopt(v->fd[0], SOL_SOCKET, SO_SNDBUF, &sz, sizeof(sz));
+    setsockopt(v->fd[1], SOL_SOCKET, SO_RCVBUF, &sz, sizeof(sz));
+    v->id = Broadcast::addViewer(v->fd[0], Broadcast::PLAIN, "HTTP/1.1 200 OK\r\n\r\n", targetMs);
+    CHECK(v->id >= 0);
+    v->reader = std::thread(readLoop, v);
+    return v;
+}
+
+int main() {
+    Serial.setMuted(true);
+    FileFrameSource src(kFps);
+    src.addSynthetic(8, kBytes);
+    CHECK(Capture::begin(&src));
+    CHECK(Broadcast::begin(render));
+
+    Viewer *fast     = connect(0, BROADCAST_TARGET_MS);
+    Viewer *fast2    = connect(0, BROADCAST_TARGET_MS);
+    Viewer *slow     = connect(30, BROADCAST_TARGET_MS);   // 30 KB/s: ~400 ms a full part
+    Viewer *slowNoCt = connect(30, 0);                     // same link, controller off
+    CHECK_EQ(Broadcast::viewers(), 4);
+
+    // Every slot taken: the next viewer is refused, not queued.
+    int spare[2];
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, spare) == 0);
+    CHECK_EQ(Broadcast::addViewer(spare[0], Broadcast::PLAIN, "", 0), -1);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(kRunMs));
+    Broadcast::Stats bs = Broadcast::stats();
+    uint32_t grabs = (uint32_t)src.grabs();
+    const Broadcast::ViewerStats &f  = bs.viewer[fast->id & 0xFF];
+    const Broadcast::ViewerStats &f2 = bs.viewer[fast2->id & 0xFF];
+    const Broadcast::ViewerStats &s  = bs.viewer[slow->id & 0xFF];
+    const Broadcast::ViewerStats &n  = bs.viewer[slowNoCt->id & 0xFF];
+    printf("%u frames captured, %u parts rendered (%u renders)\n", (unsigned)grabs,
+           (unsigned)bs.produced, (unsigned)_renders.load());
+    printf("fast: sent %u skipped %u q %u | slow: sent %u skipped %u q %u every %u ms | "
+           "uncontrolled: sent %u skipped %u q %u\n",
+           (unsigned)f.sent, (unsigned)f.skipped, (unsigned)f.quality, (unsigned)s.sent,
+           (unsigned)s.skipped, (unsigned)s.quality, (unsigned)s.intervalMs, (unsigned)n.sent,
+           (unsigned)n.skipped, (unsigned)n.quality);
+
+    // One render per part, never more parts than frames captured, however
+    // many viewers.
+    CHECK(bs.produced > 0);
+    CHECK(bs.produced <= grabs);
+    CHECK(_renders <= bs.produced + bs.renderFailed);
+    CHECK_EQ(bs.renderFailed, 0);
+    CHECK_EQ(bs.stalled, 0);
+
+    // Fast viewers: nearly every part, full quality, no throttling – the
+    // slow ones do not hold them back.
+    for (const Broadcast::ViewerStats *v : { &f, &f2 }) {
+        CHECK(v->sent >= bs.produced * 3 / 4);
+        CHECK_EQ(v->quality, 90);
+        CHECK_EQ(v->intervalMs, 0);
+        CHECK(v->sent + v->skipped <= bs.produced);
+    }
+    CHECK(fast->parts >= f.sent - 1);
+
+    // Slow viewer: parts replaced while it was busy are skipped, not queued,
+    // and the controller has backed it off.
+    CHECK(s.sent > 0);
+    CHECK(s.skipped > 0);
+    CHECK(s.sent + s.skipped <= bs.produced);
+    CHECK(s.quality < 90);
+    CHECK(s.intervalMs > 0);
+    CHECK(f.sent >= 3 * s.sent);
+
+    // Controller off: same skipping, but frames stay at full quality and
+    // unthrottled.
+    CHECK(n.skipped > 0);
+    CHECK_EQ(n.quality, 90);
+    CHECK_EQ(n.intervalMs, 0);
+
+    // A removed viewer frees its slot.
+    Broadcast::removeViewer(slowNoCt->id);
+    CHECK_EQ(Broadcast::viewers(), 3);
+    CHECK(Broadcast::addViewer(spare[0], Broadcast::PLAIN, "", 0) >= 0);
+
+    int rc = TEST_RESULT();
+    fflush(stdout);
+    _Exit(rc);      // broker and broadcaster tasks run forever
+}
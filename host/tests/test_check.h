@@ -0,0 +1,39 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  host/tests/test_check.h
+//  CHECK() for the host tests.  Unlike assert() it is not compiled out by
+//  NDEBUG (the host build defaults to RelWithDebInfo), and it records the
+//  failure and carries on so one run reports every broken expectation.
+//  A test's main() ends with `return TEST_RESULT();`.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdio.h>
+
+static int _testFailures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            _testFailures++; \
+        } \
+    } while (0)
+
+// As CHECK(a == b) for integers, printing both values on failure.
+#define CHECK_EQ(a, b) \
+    do { \
+        long long _a = (long long)(a), _b = (long long)(b); \
+        if (_a != _b) { \
+            fprintf(stderr, "%s:%d: CHECK failed: %s == %s (%lld vs %lld)\n", \
+                    __FILE__, __LINE__, #a, #b, _a, _b); \
+            _testFailures++; \
+        } \
+    } while (0)
+
+#define TEST_RESULT() \
+    (printf("%s: %d failure(s)\n", _testFailures ? "FAIL" : "OK", _testFailures), \
+     _testFailures ? 1 : 0)
+
+#endif // TEST_CHECK_H
@@ -0,0 +1,277 @@
+// test_feedback.cpp  –  FaceGuard Pro  (host build only)
+// Feedback pattern timing: PatternPlayer on a simulated clock (exact pin
+// timelines, cutting a pattern short, late ticks, millis() wrap-around),
+// Sequencer coalescing (latest post wins, repeats dropped or held off by
+// FEEDBACK_REPEAT_GAP_MS), then the player task on the real clock.
+
+#include "Arduino.h"
+#include "feedback.h"
+#include "test_check.h"
+
+#include <mutex>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+static const Feedback::Pins kPins = { 12, 13, 3 };
+enum : uint8_t { G = 12, R = 13, B = 3 };
+
+struct Edge {
+    uint32_t t;
+    uint8_t  pin;
+    bool     level;
+};
+
+static std::mutex        _mtx;
+static std::vector<Edge> _edges;
+static uint32_t          _now = 0;
+static bool              _realClock = false;
+
+static void sink(uint8_t pin, bool level) {
+    std::lock_guard<std::mutex> g(_mtx);
+    _edges.push_back({ _realClock ? (uint32_t)millis() : _now, pin, level });
+}
+
+// Ticks `p` from its start until it goes idle, jumping the clock straight to
+// each step.  Returns the longest wait tick() asked for.
+static uint32_t playOut(Feedback::PatternPlayer &p) {
+    uint32_t longest = 0;
+    for (;;) {
+        uint32_t wait = p.tick(_now);
+        if (wait == FEEDBACK_IDLE) return longest;
+        if (wait > longest) longest = wait;
+        _now += wait;
+    }
+}
+
+static void checkEdges(const std::vector<Edge> &want, int line) {
+    bool same = _edges.size() == want.size();
+    for (size_t i = 0; same && i < want.size(); i++)
+        same = _edges[i].t == want[i].t && _edges[i].pin == want[i].pin &&
+               _edges[i].level == want[i].level;
+    if (same) return;
+    fprintf(stderr, "line %d: pin timeline differs\n  got: ", line);
+    for (const Edge &e : _edges) fprintf(stderr, " %u:%u%c", (unsigned)e.t, e.pin, e.level ? '+' : '-');
+    fprintf(stderr, "\n  want:");
+    for (const Edge &e : want) fprintf(stderr, " %u:%u%c", (unsigned)e.t, e.pin, e.level ? '+' : '-');
+    fprintf(stderr, "\n");
+    _testFailures++;
+}
+
+// ─── PatternPlayer ───────────────────────────────────────────────────────────
+static void testRecognised() {
+    Feedback::PatternPlayer p(sink, kPins);
+    _edges.clear();
+    _now = 1000;
+    CHECK(p.tick(_now) == FEEDBACK_IDLE);
+    p.start(Feedback::RECOGNISED, _now);
+    CHECK(p.busy());
+    playOut(p);
+    CHECK(!p.busy());
+    checkEdges({ { 1000, G, true }, { 1000, B, true }, { 1120, B, false }, { 1240, B, true },
+                 { 1360, B, false }, { 1560, G, false } }, __LINE__);
+}
+
+static void testNotRecognised() {
+    Feedback::PatternPlayer p(sink, kPins);
+    _edges.clear();
+    _now = 0;
+    p.start(Feedback::NOT_RECOGNISED, _now);
+    playOut(p);
+    checkEdges({ { 0, R, true }, { 0, B, true }, { 600, R, false }, { 600, B, false } }, __LINE__);
+}
+
+// A tick long after its step is due applies every step in between and
+// leaves the outputs where the pattern ends: off.
+static void testLateTick() {
+    Feedback::PatternPlayer p(sink, kPins);
+    _edges.clear();
+    _now = 0;
+    p.start(Feedback::RECOGNISED, _now);
+    _now = 5000;
+    CHECK(p.tick(_now) == FEEDBACK_IDLE);
+    checkEdges({ { 0, G, true }, { 0, B, true }, { 5000, B, false }, { 5000, B, true },
+                 { 5000, B, false }, { 5000, G, false } }, __LINE__);
+}
+
+// start() cuts short what is playing; pins already in the new state are not
+// written again.
+static void testCutShort() {
+    Feedback::PatternPlayer p(sink, kPins);
+    _edges.clear();
+    _now = 0;
+    p.start(Feedback::RECOGNISED, _now);
+    _now = 60;
+    p.start(Feedback::RECOGNISED, _now);          // green + buzzer already on
+    CHECK_EQ(_edges.size(), 2);
+    _now = 130;
+    CHECK_EQ(p.tick(_now), 50);                   // restarted at 60: buzzer off at 180
+    p.start(Feedback::NOT_RECOGNISED, _now);
+    playOut(p);
+    checkEdges({ { 0, G, true }, { 0, B, true }, { 130, G, false }, { 130, R, true },
+                 { 730, R, false }, { 730, B, false } }, __LINE__);
+}
+
+// The schedule survives millis() wrapping mid-pattern.
+static void testWrap() {
+    Feedback::PatternPlayer p(sink, kPins);
+    _edges.clear();
+    _now = 0xFFFFFFFFu - 49;
+    p.start(Feedback::RECOGNISED, _now);
+    CHECK(playOut(p) <= 200);
+    checkEdges({ { 0xFFFFFFCEu, G, true }, { 0xFFFFFFCEu, B, true }, { 70, B, false },
+                 { 190, B, true }, { 310, B, false }, { 510, G, false } }, __LINE__);
+}
+
+// ─── Sequencer ───────────────────────────────────────────────────────────────
+// Posts `p` at `at`, ticking the sequencer through every step before it.
+// want: whether the post is taken (-1: either).
+static void postAt(Feedback::Sequencer &s, uint32_t at, Feedback::Pattern p, int want = 1) {
+    for (;;) {
+        uint32_t wait = s.tick(_now);
+        if (wait == FEEDBACK_IDLE || _now + wait > at) break;
+        _now += wait;
+    }
+    _now = at;
+    bool taken = s.post(p);
+    if (want >= 0) CHECK_EQ(taken, want);
+}
+
+static void runOut(Feedback::Sequencer &s) {
+    for (;;) {
+        uint32_t wait = s.tick(_now);
+        if (wait == FEEDBACK_IDLE) return;
+        _now += wait;
+    }
+}
+
+// A post of the pattern playing is dropped; a different one waits for it
+// and then plays at once (each pattern still ends all-off).
+static void testSequencerDropsRepeat() {
+    Feedback::Sequencer s(sink, kPins);
+    _edges.clear();
+    _now = 0;
+    postAt(s, 0, Feedback::NOT_RECOGNISED);
+    postAt(s, 200, Feedback::NOT_RECOGNISED, 0);
+    postAt(s, 300, Feedback::RECOGNISED);
+    postAt(s, 400, Feedback::NOT_RECOGNISED, 0);
+    runOut(s);
+    checkEdges({ { 0, R, true }, { 0, B, true }, { 600, R, false }, { 600, B, false },
+                 { 600, G, true }, { 600, B, true }, { 720, B, false }, { 840, B, true },
+                 { 960, B, false }, { 1160, G, false } }, __LINE__);
+}
+
+// The same pattern plays again only FEEDBACK_REPEAT_GAP_MS after its end,
+// and a newer post replaces it while it waits.
+static void testSequencerRepeatGap() {
+    Feedback::Sequencer s(sink, kPins);
+    _edges.clear();
+    _now = 0;
+    postAt(s, 0, Feedback::NOT_RECOGNISED);
+    postAt(s, 700, Feedback::NOT_RECOGNISED);
+    runOut(s);
+    checkEdges({ { 0, R, true }, { 0, B, true }, { 600, R, false }, { 600, B, false },
+                 { 1600, R, true }, { 1600, B, true }, { 2200, R, false }, { 2200, B, false } },
+               __LINE__);
+
+    _edges.clear();
+    postAt(s, 2300, Feedback::NOT_RECOGNISED);     // held off until 3200 ...
+    postAt(s, 2400, Feedback::RECOGNISED);         // ... and replaced: plays now
+    runOut(s);
+    CHECK(!_edges.empty() && _edges[0].t == 2400 && _edges[0].pin == G);
+    CHECK_EQ(_edges.size(), 6);
+}
+
+// A stranger posted every 200 ms (the pipeline's pacing) buzzes in bursts
+// with quiet gaps, and a recognised face posted meanwhile plays by the end
+// of the pattern playing.
+static void testSequencerStranger() {
+    Feedback::Sequencer s(sink, kPins);
+    _edges.clear();
+    _now = 0;
+    for (uint32_t t = 0; t < 5000; t += 200) postAt(s, t, Feedback::NOT_RECOGNISED, -1);
+    uint32_t buzzOn = 0, since = 0;
+    for (const Edge &e : _edges) {
+        if (e.pin != B) continue;
+        if (e.level) since = e.t; else buzzOn += e.t - since;
+    }
+    CHECK(buzzOn <= 5000 * 600 / (600 + FEEDBACK_REPEAT_GAP_MS) + 600);
+
+    _edges.clear();
+    postAt(s, 5000, Feedback::RECOGNISED);
+    runOut(s);
+    CHECK(!_edges.empty() && _edges.back().pin == G && !_edges.back().level);
+    uint32_t greenOn = 0;
+    for (const Edge &e : _edges) if (e.pin == G && e.level) greenOn = e.t;
+    CHECK(greenOn >= 5000 && greenOn <= 5000 + 600);
+}
+
+// ─── Player task ─────────────────────────────────────────────────────────────
+static void testTask() {
+    CHECK(!Feedback::post(Feedback::RECOGNISED));   // before begin()
+    {
+        std::lock_guard<std::mutex> g(_mtx);
+        _edges.clear();
+        _realClock = true;
+    }
+    CHECK(Feedback::begin(kPins, sink));
+    CHECK(Feedback::post(Feedback::RECOGNISED));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));   // playing
+    CHECK(Feedback::post(Feedback::NOT_RECOGNISED));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1400));
+
+    std::vector<Edge> got;
+    {
+        std::lock_guard<std::mutex> g(_mtx);
+        got = _edges;
+    }
+    // Two different patterns play back to back, in order, each to the end.
+    static const Edge kOrder[] = { { 0, G, true }, { 0, B, true }, { 0, B, false },
+                                   { 0, B, true }, { 0, B, false }, { 0, G, false },
+                                   { 0, R, true }, { 0, B, true }, { 0, R, false },
+                                   { 0, B, false } };
+    CHECK_EQ(got.size(), sizeof(kOrder) / sizeof(kOrder[0]));
+    for (size_t i = 0; i < got.size() && i < sizeof(kOrder) / sizeof(kOrder[0]); i++) {
+        CHECK_EQ(got[i].pin, kOrder[i].pin);
+        CHECK_EQ(got[i].level, kOrder[i].level);
+    }
+    if (got.size() == 10) {
+        uint32_t rec = got[6].t - got[0].t, miss = got[9].t - got[6].t;
+        CHECK(rec >= 560 && rec < 660);
+        CHECK(miss >= 600 && miss < 700);
+    }
+
+    // A burst of posts plays once: each replaces the one before it, and the
+    // repeat waits FEEDBACK_REPEAT_GAP_MS after the last NOT_RECOGNISED.
+    for (int i = 0; i < 12; i++) CHECK(Feedback::post(Feedback::NOT_RECOGNISED));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));  // gap over, playing
+    CHECK(!Feedback::post(Feedback::NOT_RECOGNISED));              // so dropped
+    std::this_thread::sleep_for(std::chrono::milliseconds(700));
+    {
+        std::lock_guard<std::mutex> g(_mtx);
+        got = _edges;
+    }
+    CHECK_EQ(got.size(), 14);
+    if (got.size() == 14) {
+        CHECK_EQ(got[10].pin, R);
+        CHECK(got[10].level);
+        uint32_t gap = got[10].t - got[9].t;
+        CHECK(gap >= FEEDBACK_REPEAT_GAP_MS && gap < FEEDBACK_REPEAT_GAP_MS + 100);
+    }
+}
+
+int main() {
+    Serial.setMuted(true);
+    testRecognised();
+    testNotRecognised();
+    testLateTick();
+    testCutShort();
+    testWrap();
+    testSequencerDropsRepeat();
+    testSequencerRepeatGap();
+    testSequencerStranger();
+    testTask();
+    int rc = TEST_RESULT();
+    fflush(stdout);
+    _Exit(rc);      // the player task runs forever
+}
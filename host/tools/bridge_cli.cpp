@@ -0,0 +1,70 @@
+// bridge_cli.cpp  –  FaceGuard Pro  (host build only)
+// Runs Bridge API calls against a directory laid out like the SD card, e.g. a
+// copy of a production card:
+//
+//   fg_bridge <sd-root> stats
+//   fg_bridge <sd-root> logs [date] [dept] [status] [search]
+//   fg_bridge <sd-root> range <days>
+//   fg_bridge <sd-root> csv [date]
+//   fg_bridge <sd-root> users
+//   fg_bridge <sd-root> log <uid> <name> [dept]
+//   fg_bridge <sd-root> clear [date]
+//
+// Output goes to stdout; the firmware's Serial log goes to stderr.
+
+#include "Arduino.h"
+#include "global.h"
+#include "sd_card.h"
+#include "storage_posix.h"
+
+static int usage() {
+    fprintf(stderr,
+        "usage: fg_bridge <sd-root> <command> [args]\n"
+        "  stats | status | storage | users | settings\n"
+        "  logs [date] [dept] [status] [search]\n"
+        "  range <days>\n"
+        "  csv [date]\n"
+        "  log <uid> <name> [dept] [similarity]\n"
+        "  clear [date]\n");
+    return 2;
+}
+
+static const char *arg(int argc, char **argv, int i) { return i < argc ? argv[i] : ""; }
+
+int main(int argc, char **argv) {
+    if (argc < 3) return usage();
+
+    posixStorageSetRoot(argv[1]);
+    Bridge::initSD();
+    if (!Bridge::sdIsOk()) {
+        fprintf(stderr, "fg_bridge: cannot use '%s' as SD root\n", argv[1]);
+        return 1;
+    }
+    Bridge::loadSettings(gSettings);
+    ntpSynced = true;   // the host wall clock is authoritative
+
+    String cmd = argv[2];
+    String out;
+    if      (cmd == "stats")    out = Bridge::getStatsJSON();
+    else if (cmd == "status")   out = Bridge::getStatusJSON();
+    else if (cmd == "storage")  out = Bridge::getStorageJSON();
+    else if (cmd == "users")    out = Bridge::getUsersJSON();
+    else if (cmd == "logs")     out = Bridge::getLogsJSON(arg(argc, argv, 3), arg(argc, argv, 4),
+                                                          arg(argc, argv, 5), arg(argc, argv, 6));
+    else if (cmd == "range")    out = Bridge::getLogsRange(atoi(arg(argc, argv, 3)) > 0
+                                                           ? atoi(arg(argc, argv, 3)) : 7);
+    else if (cmd == "csv")      out = Bridge::downloadAttendanceCSV(arg(argc, argv, 3));
+    else if (cmd == "settings") { Bridge::saveSettings(gSettings); out = "OK"; }
+    else if (cmd == "log") {
+        if (argc < 5) return usage();
+        float sim = argc > 6 ? (float)atof(argv[6]) : 1.0f;
+        Bridge::logAttendance(AttendanceRecord::fromFace(argv[3], argv[4], arg(argc, argv, 5), sim));
+        out = "OK";
+    }
+    else if (cmd == "clear")    out = Bridge::clearAttendanceLogs(arg(argc, argv, 3)) ? "OK" : "FAIL";
+    else return usage();
+
+    fwrite(out.c_str(), 1, out.length(), stdout);
+    fputc('\n', stdout);
+    return 0;
+}
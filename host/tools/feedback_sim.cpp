@@ -0,0 +1,115 @@
+// feedback_sim.cpp  –  FaceGuard Pro  (host build only)
+// Plays feedback patterns through Feedback::Sequencer on a simulated clock
+// and prints every post and pin transition, so pattern timing can be
+// checked without hardware:
+//
+//   fg_feedback_sim [<at_ms>:<rec|miss> ...]
+//
+// Each event is posted at its time, as the recognition pipeline would: a
+// newer post replaces one not yet started, a repeat of the pattern playing
+// is dropped, and a pattern plays again only FEEDBACK_REPEAT_GAP_MS after
+// it last ended.  With no arguments a stranger is posted every 500 ms for
+// 3 s, then a recognised face.  Exits 1 if a pin is left on, a pattern is
+// cut short, repeats without the gap, or the last post never plays.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "feedback.h"
+
+static const Feedback::Pins kPins = { 12, 13, 3 };
+
+static uint32_t _now = 0;
+static bool     _level[64];
+static uint32_t _onSince[64];
+static uint32_t _onTotal[64];
+
+// Patterns as they played, recovered from the pins: one starts when an
+// output comes on with all off, and ends when all are off again.
+struct Played { uint32_t start, end; Feedback::Pattern p; };
+static std::vector<Played> _played;
+
+static const char *pinName(uint8_t pin) {
+    return pin == kPins.green ? "green" : pin == kPins.red ? "red" : pin == kPins.buzzer ? "buzzer" : "?";
+}
+
+static bool anyOn() { return _level[kPins.green] || _level[kPins.red] || _level[kPins.buzzer]; }
+
+static void sink(uint8_t pin, bool level) {
+    printf("  t=%5u ms  %-6s %s\n", (unsigned)_now, pinName(pin), level ? "ON" : "off");
+    if (level && !anyOn())
+        _played.push_back({ _now, 0, pin == kPins.red ? Feedback::NOT_RECOGNISED : Feedback::RECOGNISED });
+    if (level && !_level[pin]) _onSince[pin] = _now;
+    if (!level && _level[pin]) _onTotal[pin] += _now - _onSince[pin];
+    _level[pin] = level;
+    if (!anyOn() && !_played.empty()) _played.back().end = _now;
+}
+
+struct Event { uint32_t at; Feedback::Pattern p; };
+
+static const char *patternName(Feedback::Pattern p) {
+    return p == Feedback::RECOGNISED ? "RECOGNISED" : "NOT_RECOGNISED";
+}
+
+int main(int argc, char **argv) {
+    std::vector<Event> events;
+    for (int i = 1; i < argc; i++) {
+        const char *colon = strchr(argv[i], ':');
+        if (!colon) { fprintf(stderr, "usage: fg_feedback_sim [<at_ms>:<rec|miss> ...]\n"); return 2; }
+        Event e = { (uint32_t)atoi(argv[i]),
+                    strcmp(colon + 1, "rec") == 0 ? Feedback::RECOGNISED : Feedback::NOT_RECOGNISED };
+        events.push_back(e);
+    }
+    if (events.empty()) {
+        for (uint32_t t = 0; t < 3000; t += 500) events.push_back({ t, Feedback::NOT_RECOGNISED });
+        events.push_back({ 3000, Feedback::RECOGNISED });
+    }
+
+    // Mirrors the player task: tick, then sleep until the next step or the
+    // next post.
+    Feedback::Sequencer seq(sink, kPins);
+    size_t next = 0;
+    int    dropped = 0;
+    for (;;) {
+        while (next < events.size() && events[next].at <= _now) {
+            bool ok = seq.post(events[next].p);
+            printf("  t=%5u ms  -- post %s%s\n", (unsigned)_now, patternName(events[next].p),
+                   ok ? "" : " (dropped: playing)");
+            dropped += !ok;
+            next++;
+        }
+        uint32_t wait = seq.tick(_now);
+        if (wait == FEEDBACK_IDLE && next == events.size()) break;
+        uint32_t untilPost = next < events.size() ? events[next].at - _now : FEEDBACK_IDLE;
+        _now += wait < untilPost ? wait : untilPost;
+    }
+
+    bool ok = !_played.empty() && _played.back().p == events.back().p;
+    if (!ok) printf("FAIL: the last post (%s) never played\n", patternName(events.back().p));
+    for (uint8_t pin : { kPins.green, kPins.red, kPins.buzzer }) {
+        if (_level[pin]) { printf("FAIL: %s left on\n", pinName(pin)); ok = false; }
+        printf("%-6s on for %u ms\n", pinName(pin), (unsigned)_onTotal[pin]);
+    }
+    static const uint32_t kLen[Feedback::PATTERN_COUNT] = { 560, 600 };
+    for (size_t i = 0; i < _played.size(); i++) {
+        const Played &a = _played[i];
+        if (a.end - a.start != kLen[a.p]) {
+            printf("FAIL: %s at %u ms cut short\n", patternName(a.p), (unsigned)a.start);
+            ok = false;
+        }
+        for (size_t j = i + 1; j < _played.size(); j++) {
+            if (_played[j].p != a.p) continue;
+            if (_played[j].start - a.end < FEEDBACK_REPEAT_GAP_MS) {
+                printf("FAIL: %s repeated at %u ms, %u ms after it ended\n", patternName(a.p),
+                       (unsigned)_played[j].start, (unsigned)(_played[j].start - a.end));
+                ok = false;
+            }
+            break;
+        }
+    }
+    printf("%s: %u post(s), %u pattern(s) played, %d dropped, finished at %u ms\n",
+           ok ? "OK" : "FAIL", (unsigned)events.size(), (unsigned)_played.size(), dropped,
+           (unsigned)_now);
+    return ok ? 0 : 1;
+}
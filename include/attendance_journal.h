@@ -0,0 +1,53 @@
+#ifndef ATTENDANCE_JOURNAL_H
+#define ATTENDANCE_JOURNAL_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  attendance_journal.h
+//  Write-behind path for recognised check-ins.  The recognition loops post an
+//  AttendanceRecord and carry on; a low-priority writer task drains the queue
+//  and appends whole batches with Bridge::logAttendanceBatch (one SD lock and
+//  one open/append/close per batch), so inference no longer waits on SD card
+//  write latency.
+//
+//  A batch is written when JOURNAL_BATCH_MAX records are waiting, when the
+//  oldest record has waited maxFlushMs, or on flush().  post() stamps the
+//  date/time at recognition, so a record written late still gets the right
+//  Present/Late status.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+#include "global.h"
+
+#define JOURNAL_CAPACITY      16     // queued records (power of two, ~270 B each)
+#define JOURNAL_BATCH_MAX      8     // records that trigger an early write
+#define JOURNAL_MAX_FLUSH_MS 500     // default upper bound on write-behind delay
+
+namespace Journal {
+
+    struct Stats {
+        uint32_t posted;       // records accepted by post()
+        uint32_t written;      // records appended to the CSV
+        uint32_t duplicates;   // records dropped as already logged today
+        uint32_t batches;      // logAttendanceBatch calls
+        uint32_t syncFallback; // queue full → written synchronously by post()
+        uint32_t maxDepth;     // deepest queue seen
+        uint32_t maxBatchMs;   // slowest batch write
+    };
+
+    // Starts the writer task.  Call once after Bridge::initSD().
+    bool begin(uint32_t maxFlushMs = JOURNAL_MAX_FLUSH_MS);
+
+    // Queues a check-in (date/time/status stamped now).  Never blocks on SD;
+    // if the queue is full the record is written synchronously instead so no
+    // check-in is ever lost.  Falls back to Bridge::logAttendance before begin().
+    void post(const AttendanceRecord &rec);
+
+    // Blocks until everything posted so far is on the card, or timeoutMs.
+    // Call before factory reset, restart or power-down.
+    bool flush(uint32_t timeoutMs = 3000);
+
+    Stats stats();
+
+} // namespace Journal
+
+#endif // ATTENDANCE_JOURNAL_H
@@ -0,0 +1,88 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  bounded_queue.h
+//  Fixed-capacity lock-free multi-producer / multi-consumer queue
+//  (D. Vyukov's bounded MPMC design).  Each cell carries a sequence number, so
+//  producers and consumers only contend on one atomic index each and never
+//  block: push() on a full queue and pop() on an empty one simply return false.
+//
+//  Storage is inline (no heap), N must be a power of two.  T is copied in and
+//  out, so keep it plain data.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, size_t N>
+class BoundedQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "BoundedQueue capacity must be a power of two");
+
+public:
+    BoundedQueue() {
+        for (size_t i = 0; i < N; i++) _cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+    BoundedQueue(const BoundedQueue &) = delete;
+    BoundedQueue &operator=(const BoundedQueue &) = delete;
+
+    bool push(const T &v) {
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell    &c   = _cells[pos & (N - 1)];
+            size_t   seq = c.seq.load(std::memory_order_acquire);
+            intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+            if (dif == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    c.value = v;
+                    c.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (dif < 0) {
+                return false;                                   // full
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(T &out) {
+        size_t pos = _head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell    &c   = _cells[pos & (N - 1)];
+            size_t   seq = c.seq.load(std::memory_order_acquire);
+            intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+            if (dif == 0) {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = c.value;
+                    c.seq.store(pos + N, std::memory_order_release);
+                    return true;
+                }
+            } else if (dif < 0) {
+                return false;                                   // empty
+            } else {
+                pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Approximate under concurrency; exact when producers/consumers are idle.
+    size_t size() const {
+        size_t t = _tail.load(std::memory_order_relaxed);
+        size_t h = _head.load(std::memory_order_relaxed);
+        return t >= h ? t - h : 0;
+    }
+    static constexpr size_t capacity() { return N; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        T                   value;
+    };
+    Cell                _cells[N];
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _tail{0};
+};
+
+#endif // BOUNDED_QUEUE_H
@@ -0,0 +1,124 @@
+#ifndef CAPTURE_BROKER_H
+#define CAPTURE_BROKER_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  capture_broker.h
+//  One task owns the camera.  It grabs each frame once, copies it out of the
+//  DMA framebuffer into a reference-counted Frame (PSRAM) and hands the
+//  framebuffer straight back to the driver, so the camera never runs out of
+//  buffers however long a consumer holds on to a frame.
+//
+//  Consumers (attendance pipeline, the stream broadcaster, snapshots) read from
+//  a latest-frame-wins mailbox: next() returns the newest frame the
+//  subscriber has not seen yet, skipping any it was too slow for.  A slow
+//  MJPEG viewer therefore costs the recognition loop nothing, and frames
+//  are shared rather than captured per consumer.  With no subscribers the
+//  broker leaves the camera alone.
+//
+//  Frames come from a FrameSource: the OV2640 on the device
+//  (Capture::cameraSource()), or anything else – the host build feeds the
+//  broker from JPEG files (host/file_frame_source.h) to measure throughput.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/time.h>
+#include <atomic>
+
+#define CAPTURE_MAX_SUBSCRIBERS  6      // attendance + stream viewers + snapshot
+#define CAPTURE_IDLE_POLL_MS   500      // broker sleep while nobody subscribes
+
+#if defined(FACEGUARD_HOST)
+  #define CAPTURE_FORMAT_JPEG  4        // pixformat_t PIXFORMAT_JPEG
+#else
+  #include "esp_camera.h"
+  #define CAPTURE_FORMAT_JPEG  PIXFORMAT_JPEG
+#endif
+
+namespace Capture {
+
+    // An immutable captured frame.  Only ever handled through FrameRef.
+    struct Frame {
+        uint8_t         *buf;
+        size_t           len;
+        uint16_t         width;
+        uint16_t         height;
+        uint8_t          format;     // pixformat_t; CAPTURE_FORMAT_JPEG from the camera
+        uint32_t         seq;        // 1, 2, … in capture order
+        uint32_t         ms;         // millis() at capture
+        struct timeval   ts;         // wall clock at capture (X-Timestamp)
+        std::atomic<int> refs;
+    };
+
+    // Shared ownership of a Frame; the last reference frees it.
+    class FrameRef {
+    public:
+        FrameRef() {}
+        explicit FrameRef(Frame *f) : _f(f) {}          // adopts one reference
+        FrameRef(const FrameRef &o) : _f(o._f) { if (_f) _f->refs++; }
+        FrameRef(FrameRef &&o) : _f(o._f) { o._f = nullptr; }
+        FrameRef &operator=(FrameRef o) { Frame *t = _f; _f = o._f; o._f = t; return *this; }
+        ~FrameRef() { reset(); }
+
+        void reset();
+        Frame *get() const { return _f; }
+        Frame *operator->() const { return _f; }
+        explicit operator bool() const { return _f != nullptr; }
+
+    private:
+        Frame *_f = nullptr;
+    };
+
+    class FrameSource {
+    public:
+        struct Grab {
+            const uint8_t *buf;
+            size_t         len;
+            uint16_t       width;
+            uint16_t       height;
+            uint8_t        format;
+            void          *handle;   // source-private (camera_fb_t *)
+        };
+        virtual ~FrameSource() {}
+        // Blocks until the next frame (or failure).  The data must stay valid
+        // until release(); the broker copies it and releases at once.
+        virtual bool grab(Grab &g) = 0;
+        virtual void release(Grab &g) = 0;
+    };
+
+    struct Stats {
+        uint32_t captured;       // frames published
+        uint32_t grabFailed;     // source returned no frame
+        uint32_t allocFailed;    // no memory for the copy (frame dropped)
+        uint32_t subscribers;    // currently subscribed
+        uint32_t maxCopyUs;      // slowest grab-to-publish
+        uint32_t delivered[CAPTURE_MAX_SUBSCRIBERS];   // per subscriber slot
+        uint32_t skipped[CAPTURE_MAX_SUBSCRIBERS];     // newer frame replaced it first
+    };
+
+#if !defined(FACEGUARD_HOST)
+    // esp_camera_fb_get() / esp_camera_fb_return() on the initialised camera.
+    FrameSource *cameraSource();
+#endif
+
+    // Starts the broker task on `core` (-1: any).  Call once, after the
+    // source is ready.
+    bool begin(FrameSource *src, int core = -1);
+
+    // Returns a subscriber id, or -1 if all CAPTURE_MAX_SUBSCRIBERS are taken.
+    int  subscribe();
+    void unsubscribe(int sub);
+
+    // Newest frame `sub` has not seen, waiting up to timeoutMs for one.
+    // Empty on timeout.
+    FrameRef next(int sub, uint32_t timeoutMs);
+
+    // The most recently captured frame without waiting (may be empty, or
+    // one the caller has already seen).
+    FrameRef latest();
+
+    Stats stats();
+
+} // namespace Capture
+
+#endif // CAPTURE_BROKER_H
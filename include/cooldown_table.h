@@ -0,0 +1,73 @@
+#ifndef COOLDOWN_TABLE_H
+#define COOLDOWN_TABLE_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  cooldown_table.h
+//  Per-identity recognition cooldown: remembers when each person was last
+//  logged so only that person is suppressed for the cooldown window, while
+//  everyone else in the queue is recognised at inference speed.
+//
+//  Fixed-size open-addressed table (linear probing, inline storage, no heap).
+//  Keys are 32-bit FNV-1a hashes of the enrolled name rather than gallery
+//  rows, because FaceGallery::remove() moves the last row into the freed slot.
+//  Expired entries are reused in place; nothing is ever deleted, so probe
+//  chains stay intact and a lookup is at most N probes.  When every slot is
+//  live the stalest one is evicted.
+//
+//  Not thread-safe: owned by the pipeline's RECOGNISE stage.  N must be a
+//  power of two.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+
+template <size_t N>
+class CooldownTable {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "CooldownTable size must be a power of two");
+
+public:
+    explicit CooldownTable(uint32_t windowMs) : _window(windowMs) {}
+
+    static uint32_t keyOf(const char *name, size_t maxLen) {
+        uint32_t h = 2166136261u;
+        for (size_t i = 0; i < maxLen && name[i]; i++) {
+            h ^= (uint8_t)name[i];
+            h *= 16777619u;
+        }
+        return h ? h : 1;             // 0 marks an empty slot
+    }
+
+    // True if `key` was stamped less than the window ago.
+    bool active(uint32_t key, uint32_t now) const {
+        for (size_t i = 0, p = key & (N - 1); i < N; i++, p = (p + 1) & (N - 1)) {
+            if (_keys[p] == 0)   return false;
+            if (_keys[p] == key) return now - _stamps[p] < _window;
+        }
+        return false;
+    }
+
+    // Records `key` as seen at `now`.
+    void stamp(uint32_t key, uint32_t now) {
+        size_t reuse = N, oldest = 0;
+        for (size_t i = 0, p = key & (N - 1); i < N; i++, p = (p + 1) & (N - 1)) {
+            if (_keys[p] == key) { _stamps[p] = now; return; }
+            if (_keys[p] == 0) { if (reuse == N) reuse = p; break; }
+            if (reuse == N && now - _stamps[p] >= _window) reuse = p;
+            if (now - _stamps[p] > now - _stamps[oldest]) oldest = p;
+        }
+        size_t slot = reuse != N ? reuse : oldest;
+        _keys[slot]   = key;
+        _stamps[slot] = now;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < N; i++) _keys[i] = 0;
+    }
+
+private:
+    uint32_t _window;
+    uint32_t _keys[N]   = {};
+    uint32_t _stamps[N] = {};
+};
+
+#endif // COOLDOWN_TABLE_H
@@ -0,0 +1,90 @@
+#ifndef EVENT_HUB_H
+#define EVENT_HUB_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  event_hub.h
+//  Server-Sent Events (/api/events): check-ins, enrolment progress, data
+//  changes and device status pushed to the portal as they happen, instead
+//  of the portal re-reading today's CSV every 15–30 s.
+//
+//    publish()  any task formats one event into a RAM ring of the last
+//               EVENTS_RING_LEN events.  It never touches a socket.
+//    sender     one task copies events from the ring into each client's own
+//               EVENTS_CLIENT_BUF buffer and writes it with non-blocking
+//               sends.
+//
+//  A client that falls so far behind that the ring has overwritten its next
+//  event gets a `resync` event and continues from the newest.  So a slow
+//  client costs one fixed buffer, never more, and it never holds up
+//  publishers or other clients.  A client that accepts nothing for
+//  EVENTS_STALL_MS is dropped and the stall handler closes its session.
+//  Reconnecting browsers send Last-Event-ID and are replayed whatever the
+//  ring still holds.
+//
+//  The handler hands its socket over with addClient() and returns, as
+//  /stream does (stream_broadcast.h).
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Arduino.h>
+
+#define EVENTS_MAX_CLIENTS    3         // port 80 sockets are shared with the API
+#define EVENTS_RING_LEN       32        // events kept for replay (power of two)
+#define EVENTS_DATA_MAX       320       // one event's JSON, bytes (a check-in: ~280)
+#define EVENTS_CLIENT_BUF     1024      // per-client send buffer
+#define EVENTS_PING_MS        15000     // comment line on an idle connection
+#define EVENTS_STATUS_MS      10000     // `status` event period
+#define EVENTS_STALL_MS       20000     // no bytes accepted for this long: drop
+#define EVENTS_POLL_MS        50        // sender recheck while a socket is full
+
+namespace Events {
+
+    struct ClientStats {
+        bool     used;
+        uint32_t sent;          // events written completely
+        uint32_t resyncs;       // fell off the ring
+        uint32_t kbytes;
+    };
+
+    struct Stats {
+        uint32_t clients;
+        uint32_t published;
+        uint32_t truncated;     // data longer than EVENTS_DATA_MAX
+        uint32_t stalled;       // clients dropped for not reading
+        ClientStats client[EVENTS_MAX_CLIENTS];
+    };
+
+    // Allocates the ring and starts the sender task.  Events published
+    // before begin() are dropped.
+    bool begin(int core = -1);
+
+    // Called (from the sender, with the hub locked) with the socket of a
+    // client dropped for stalling; the owner should close the session.
+    void setStallHandler(void (*fn)(int fd));
+
+    // Fills `out` with the JSON of the periodic `status` event.  Called on
+    // the sender task every EVENTS_STATUS_MS while a client is connected.
+    void setStatusSource(void (*fn)(char *out, size_t len));
+
+    // Queues event `type` with JSON data built from fmt.  Safe from any
+    // task; never blocks on a socket.  Returns the event id.
+    uint32_t publish(const char *type, const char *fmt, ...)
+        __attribute__((format(printf, 2, 3)));
+
+    // Starts pushing to the connected socket `fd` after writing `prologue`
+    // (the HTTP response head).  lastId is the browser's Last-Event-ID
+    // (0: none – only new events).  Returns a client id, or -1 when all
+    // EVENTS_MAX_CLIENTS are taken.  The hub never closes fd.
+    int  addClient(int fd, const char *prologue, uint32_t lastId = 0);
+
+    // The socket is going away (session closed).  Safe to call with an id
+    // that was already dropped.
+    void removeClient(int id);
+
+    Stats  stats();
+    String toJSON();
+
+} // namespace Events
+
+#endif // EVENT_HUB_H
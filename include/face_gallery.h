@@ -0,0 +1,145 @@
+#ifndef FACE_GALLERY_H
+#define FACE_GALLERY_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  face_gallery.h
+//  Enrolled face embeddings for matching, stored as one contiguous,
+//  16-byte-aligned row-major block (row i = L2-normalised embedding of face i)
+//  plus parallel arrays of the original norms and names.
+//
+//  esp-face keeps enrolled faces in face_id_name_list: a singly linked list of
+//  separately allocated 2 KB vectors, capped at 255 (we initialised it to 10),
+//  and recognize_face_with_name() re-computes both norms and divides per
+//  element for every node.  Here a match is one pass over contiguous memory:
+//  the query is normalised once, each row costs a single dot product, and
+//  cosine similarity == dot product.  (On unit vectors squared L2 distance is
+//  2 − 2·cos, so the same scan ranks by L2 too.)
+//
+//  Two row formats, chosen with setMode() while the gallery is empty:
+//
+//    FLOAT32  2 KB/face.  Exact scores from the scan itself.
+//    INT8     ~530 B/face: each unit row stored as int8 with one float scale
+//             (row ≈ scale·q).  The scan is an integer dot product that
+//             shortlists the top-K rows; the shortlist is then re-scored
+//             exactly from the float vectors fetched through a RowFetch
+//             (FACE.BIN, via a row cache), so the decision matches FLOAT32 while
+//             the in-RAM gallery is a quarter of the size.
+//
+//  id_list is still used as esp-face's enrolment accumulator; a finished
+//  enrolment is moved into the gallery with add() and the list is emptied.
+//
+//  All methods are thread-safe (one internal mutex): the attendance task, the
+//  stream handler and the portal API all touch the gallery.  The RowFetch is
+//  called with that mutex released.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+#include "fr_forward.h"
+#include "os_port.h"
+
+#define FACE_GALLERY_INITIAL_CAP  64     // rows allocated on first add()
+#define FACE_GALLERY_ALIGN        16
+#define FACE_GALLERY_TOPK          8     // INT8: rows re-scored in float
+#define FACE_GALLERY_Q8_MARGIN  0.05f    // INT8: shortlist rows scoring ≥ threshold − margin
+#define FACE_GALLERY_Q8_AGREE   0.98f    // INT8: min cos(fetched row, its int8 row) to re-score
+#define FACE_GALLERY_BATCH_MAX     8     // faces per matchBatch() call
+
+// Σ a[i]·b[i] over n floats (n a multiple of 8) – the scan kernel, exposed
+// for benchmarks.  Eight independent partial sums keep the FPU pipeline full
+// on the ESP32 and let the host compiler emit SIMD without -ffast-math.
+float   faceDot(const float *a, const float *b, int n);
+
+// Σ a[i]·b[i] over int8 rows, accumulated in int32 (512 × 127² fits easily).
+int32_t faceDotQ8(const int8_t *a, const int8_t *b, int n);
+
+class FaceGallery {
+public:
+    enum Mode : uint8_t { FLOAT32, INT8 };
+
+    // Copies the exact (raw, un-normalised) vector of row `row` into vec.
+    // Returns false if it is unavailable; the int8 score is used instead.
+    // A vector that does not match the row's int8 copy (cos below
+    // FACE_GALLERY_Q8_AGREE: rows moved under the fetch) is ignored too.
+    typedef bool (*RowFetch)(uint32_t row, float *vec);
+
+    FaceGallery() {}
+    ~FaceGallery();
+    FaceGallery(const FaceGallery &) = delete;
+    FaceGallery &operator=(const FaceGallery &) = delete;
+
+    // Selects the row format.  Only while empty (call before loading);
+    // returns false otherwise.  fetch is used by INT8 re-ranking and may be
+    // null (int8 scores decide then).
+    bool setMode(Mode m, RowFetch fetch = nullptr, int topK = FACE_GALLERY_TOPK);
+    Mode mode() const { return _mode; }
+
+    // Appends a face; vec is a raw FACE_ID_SIZE embedding (normalised here).
+    // Returns the new row index, or -1 if memory could not be grown.
+    int  add(const char *name, const float *vec);
+
+    // INT8 only: appends a row exactly as exportQuantized() produced it
+    // (loading FACE.Q8).  Returns the row index or -1.
+    int  addQuantized(const char *name, float scale, float norm, const int8_t *q);
+
+    // Removes the first row named `name` by moving the last row into its
+    // slot.  Returns that slot (== count() if the last row itself was
+    // removed) so FACE.BIN can be patched in place, or -1 if not found.
+    int  remove(const char *name);
+
+    void clear();
+    bool reserve(uint32_t rows);
+
+    uint32_t count() const;
+    size_t   bytesPerRow() const;
+
+    // Result of match().  best / second are reported whether or not the
+    // threshold was met, so callers can log and histogram real scores.
+    struct Match {
+        int   row;                     // accepted row, or -1
+        float best;                    // highest cosine similarity (-1: empty gallery)
+        float second;                  // next-best row (-1: fewer than two rows)
+        char  name[ENROLL_NAME_LEN];   // accepted row's name (copied under the lock)
+    };
+
+    // Best match for a raw query embedding.  Returns the row whose cosine
+    // similarity is highest and above `threshold`, else -1.
+    int  match(const float *query, float threshold, Match *out = nullptr);
+
+    // match() for n faces from one frame (n ≤ FACE_GALLERY_BATCH_MAX):
+    // FLOAT32 streams the row block once for all of them instead of n times.
+    // INT8 runs match() per face (each shortlist has its own re-rank).
+    // Returns the number of faces accepted.
+    int  matchBatch(const float *const *queries, int n, float threshold, Match *out);
+
+    // sims[i] = cosine(query, row i) for every row; returns count().
+    // sims must hold count() floats.  INT8: approximate (int8) scores.
+    uint32_t scoreAll(const float *query, float *sims);
+
+    // Copies row i as stored in FACE.BIN: name + raw (un-normalised) vector.
+    // INT8: the dequantised approximation – prefer the card copy.
+    bool exportRow(uint32_t i, char name[ENROLL_NAME_LEN], float *vec);
+
+    // INT8 only: row i as stored in FACE.Q8.
+    bool exportQuantized(uint32_t i, char name[ENROLL_NAME_LEN], float *scale,
+                         float *norm, int8_t *q);
+
+private:
+    bool grow(uint32_t cap);
+    int  appendRow(const char *name, float norm);
+    void matchQ8(const float *query, float threshold, Match &m);
+
+    OsMutex  _mtx;
+    Mode     _mode  = FLOAT32;
+    RowFetch _fetch = nullptr;
+    int      _topK  = FACE_GALLERY_TOPK;
+    float   *_rows  = nullptr;                  // FLOAT32: _cap × FACE_ID_SIZE
+    int8_t  *_qrows = nullptr;                  // INT8:    _cap × FACE_ID_SIZE
+    float   *_qscale = nullptr;                 // INT8:    _cap
+    float   *_norms = nullptr;                  // _cap
+    char   (*_names)[ENROLL_NAME_LEN] = nullptr; // _cap
+    uint32_t _count = 0;
+    uint32_t _cap   = 0;
+    uint32_t _gen   = 0;                        // bumped whenever rows move
+};
+
+#endif // FACE_GALLERY_H
@@ -0,0 +1,109 @@
+#ifndef FEEDBACK_H
+#define FEEDBACK_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  feedback.h
+//  LED / buzzer feedback without blocking the recognition loop.  Callers post
+//  a pattern ID and return at once; a small player task steps through the
+//  pattern's timeline and drives the pins.
+//
+//  Feedback must describe the face in front of the camera now, so nothing
+//  queues up: one pending slot holds the latest post (a newer one replaces
+//  it), a post of the pattern already playing is dropped, and the same
+//  pattern never repeats within FEEDBACK_REPEAT_GAP_MS of its end.  A
+//  stranger at the door, posted every frame, gets one buzz a second or so
+//  rather than a continuous one, and the next person's RECOGNISED waits at
+//  most for the end of the pattern playing.
+//
+//  The timing logic is PatternPlayer (one pattern's timeline) under a
+//  Sequencer (the pending slot and repeat gap): state machines with no
+//  clock or GPIO of their own – tick(now) applies whatever is due and says
+//  how long until the next step.  The firmware feeds them millis() and
+//  digitalWrite(); the host simulator (host/tools/feedback_sim.cpp) and
+//  host/tests/test_feedback.cpp a fake clock and a recording pin sink.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+#include <atomic>
+
+#define FEEDBACK_REPEAT_GAP_MS  1000   // quiet time before a pattern plays again
+#define FEEDBACK_IDLE           0xFFFFFFFFu
+
+namespace Feedback {
+
+    enum Pattern : uint8_t {
+        RECOGNISED,       // green LED on + two short beeps        (560 ms)
+        NOT_RECOGNISED,   // red LED + one long buzz               (600 ms)
+        PATTERN_COUNT
+    };
+
+    typedef void     (*PinWrite)(uint8_t pin, bool level);
+    typedef uint32_t (*Clock)();
+
+    struct Pins {
+        uint8_t green;
+        uint8_t red;
+        uint8_t buzzer;
+    };
+
+    class PatternPlayer {
+    public:
+        struct Step;   // pattern tables live in feedback.cpp
+
+        PatternPlayer(PinWrite write, const Pins &pins) : _write(write), _pins(pins) {}
+
+        // Starts `p` at `now`, cutting short anything still playing.
+        void start(Pattern p, uint32_t now);
+
+        // Applies every step due at `now`.  Returns ms until the next step,
+        // or FEEDBACK_IDLE when nothing is playing.
+        uint32_t tick(uint32_t now);
+
+        bool busy() const { return _step != nullptr; }
+
+    private:
+        void apply(uint8_t outputs);
+
+        PinWrite    _write;
+        Pins        _pins;
+        const Step *_step    = nullptr;   // next step to apply; null when idle
+        uint32_t    _due     = 0;         // when *_step is applied
+        uint8_t     _outputs = 0;         // currently driven bitmask
+    };
+
+    class Sequencer {
+    public:
+        Sequencer(PinWrite write, const Pins &pins) : _player(write, pins) {}
+
+        // Any task.  Makes p the pending pattern, replacing one not yet
+        // started.  Dropped (returns false) if p is the pattern playing.
+        bool post(Pattern p);
+
+        // Player task.  Applies due steps, then starts the pending pattern
+        // once idle – a repeat of the last one only FEEDBACK_REPEAT_GAP_MS
+        // after it ended.  Returns ms until the next tick is needed, or
+        // FEEDBACK_IDLE when nothing is playing or pending.
+        uint32_t tick(uint32_t now);
+
+        bool busy() const { return _player.busy(); }
+
+    private:
+        PatternPlayer        _player;
+        std::atomic<uint8_t> _pending{PATTERN_COUNT};   // PATTERN_COUNT: none
+        std::atomic<uint8_t> _playing{PATTERN_COUNT};
+        uint8_t              _last    = PATTERN_COUNT;  // last pattern played
+        uint32_t             _lastEnd = 0;              // when it ended
+    };
+
+    // Starts the player task.  write / clock default to digitalWrite and
+    // millis (device build); the pins must already be OUTPUT and LOW.
+    bool begin(const Pins &pins, PinWrite write = nullptr, Clock clock = nullptr);
+
+    // Posts a pattern to the player task's Sequencer; never blocks.
+    // Dropped (returns false) if it is the pattern playing or begin() was
+    // not called.
+    bool post(Pattern p);
+
+} // namespace Feedback
+
+#endif // FEEDBACK_H
@@ -0,0 +1,60 @@
+#ifndef FRAME_DECODE_H
+#define FRAME_DECODE_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  frame_decode.h
+//  JPEG → RGB888 for the recognition path, decoding only what each stage
+//  needs instead of fmt2rgb888()'s full-size image:
+//
+//    detection   decodeScaled(): the decoder's DCT-domain scaling (1/2, 1/4)
+//                produces the detection image directly – a quarter or a
+//                sixteenth of the pixels, and no full-size buffer.
+//    alignment   decodeRegion(): full resolution, but only the face area is
+//                stored and decoding stops after its last MCU row.
+//    presence    decodeLuma(): 1/8 scale is the DC coefficient of each 8×8
+//                block – a luma thumbnail for the motion gate, almost free.
+//
+//  RGB output matches fmt2rgb888() (3 bytes per pixel, BGR order) so the
+//  matrices go straight to face_detect() / align_face().  All three sit on
+//  esp_jpg_decode(), which is not reentrant, so calls are serialised; the
+//  host build maps it to libjpeg.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include "fd_forward.h"
+#include "frame_pool.h"
+
+#define FRAME_DETECT_SHIFT   1       // detection at 1 / (1 << shift) size
+#define FRAME_REGION_MARGIN  0.30f   // face region padding, fraction of box size
+
+namespace FrameDecode {
+
+    // Whole frame at 1 / (1 << shift) of its size (shift 0..3).  Null on a
+    // decode error or out of memory.  Allocated from `arena` if given,
+    // otherwise free with dl_matrix3du_free().
+    dl_matrix3du_t *decodeScaled(const uint8_t *jpg, size_t len, int shift,
+                                 FrameArena *arena = nullptr);
+
+    // Full-resolution pixels of the rectangle x, y, w, h (frame coordinates,
+    // inside the frame).  Null on error.  Allocated as decodeScaled().
+    dl_matrix3du_t *decodeRegion(const uint8_t *jpg, size_t len, int x, int y, int w, int h,
+                                 FrameArena *arena = nullptr);
+
+    // Luma thumbnail at 1 / (1 << shift) scale into out (maxW × maxH bytes),
+    // subsampled further if the scaled frame is larger.  *w / *h receive
+    // the thumbnail size.  No heap allocation.
+    bool decodeLuma(const uint8_t *jpg, size_t len, int shift, uint8_t *out,
+                    int maxW, int maxH, int *w, int *h);
+
+    // Box / landmark coordinates: p → p·scale + (dx, dy), for the first n boxes.
+    void mapBoxes(box_array_t *b, int n, float scale, float dx, float dy);
+
+    // Bounding rectangle of the first n boxes, padded by FRAME_REGION_MARGIN
+    // and clamped to imgW × imgH.  False if it is empty.
+    bool faceRegion(const box_array_t *b, int n, int imgW, int imgH,
+                    int *x, int *y, int *w, int *h);
+
+} // namespace FrameDecode
+
+#endif // FRAME_DECODE_H
@@ -0,0 +1,99 @@
+#ifndef FRAME_POOL_H
+#define FRAME_POOL_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  frame_pool.h
+//  Per-frame image memory without per-frame heap traffic.  FramePool::begin()
+//  carves FRAME_POOL_SLOTS fixed-size slots out of PSRAM once; each frame in
+//  flight (a pipeline Job, a /stream frame with detection on) binds one slot
+//  to its FrameArena with its first matrix and bump-allocates the rest from
+//  it – detection image, face region, aligned face.  release() rewinds the
+//  arena and returns the slot in O(1); nothing is freed piecemeal, so hours
+//  of recognition leave the heap exactly as fragmented as they found it.
+//
+//  A frame that finds no free slot, or a matrix that does not fit in what is
+//  left of one, falls back to dl_matrix3du_alloc() and is counted; the
+//  fallback is freed by the same release().  stats() / toJSON() show slot
+//  utilisation and how often that happened.
+//
+//  Not covered: the box arrays face_detect() returns and the embedding
+//  get_face_id() returns are allocated inside esp-face.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Arduino.h>
+#include "fd_forward.h"
+
+// A QVGA frame's worth: full-size RGB (face region or fmt2rgb888 fallback)
+// + half-size detection image + aligned face, with matrix headers.
+#define FRAME_POOL_SLOT_BYTES  (320 * 240 * 3 + 160 * 120 * 3 + 56 * 56 * 3 + 1024)
+#define FRAME_POOL_SLOTS       5     // pipeline frames in flight + one stream viewer
+#define FRAME_ARENA_HEAP_MAX   4     // heap fallbacks one arena can track
+
+class FrameArena;
+namespace FramePool {
+    void acquire(FrameArena &a);
+    void release(FrameArena &a);
+}
+
+class FrameArena {
+public:
+    FrameArena() {}
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    // w × h × c matrix (uninitialised pixels) from the slot, else from the
+    // heap.  Never free it: release() / reset() reclaims everything.
+    dl_matrix3du_t *matrix(int w, int h, int c);
+
+    // Drops every matrix handed out so far; keeps the slot.
+    void reset();
+
+    bool   pooled() const { return _base != nullptr; }
+    size_t used()   const { return _used; }
+
+private:
+    friend void FramePool::acquire(FrameArena &a);
+    friend void FramePool::release(FrameArena &a);
+    uint8_t        *_base = nullptr;
+    size_t          _cap  = 0;
+    size_t          _used = 0;
+    int             _slot = -1;
+    bool            _bound = false;     // acquire() done (slot or not) this frame
+    int             _heapCount = 0;
+    dl_matrix3du_t *_heap[FRAME_ARENA_HEAP_MAX];
+};
+
+namespace FramePool {
+
+    struct Stats {
+        uint32_t slots;          // allocated at begin()
+        uint32_t slotBytes;
+        uint32_t inUse;          // slots bound to an arena now
+        uint32_t peakInUse;
+        uint32_t peakBytes;      // most of one slot any frame used
+        uint32_t acquired;       // frames that asked for a slot
+        uint32_t exhausted;      // …and found every slot taken
+        uint32_t fallbacks;      // matrices that came from the heap
+        uint32_t fallbackBytes;  // largest such request
+    };
+
+    // Allocates the slots (PSRAM first).  Returns how many it got; 0 means
+    // every frame uses the heap as before.  Call once.
+    int  begin(int slots = FRAME_POOL_SLOTS, size_t slotBytes = FRAME_POOL_SLOT_BYTES);
+
+    // Binds a free slot to `a` if there is one (otherwise `a` allocates
+    // from the heap until release()).  FrameArena::matrix() calls it for
+    // the first matrix of a frame.  Lock-free; safe from any task.
+    void acquire(FrameArena &a);
+
+    // Resets `a` and returns its slot; the next matrix() binds afresh.
+    void release(FrameArena &a);
+
+    Stats  stats();
+    String toJSON();
+
+} // namespace FramePool
+
+#endif // FRAME_POOL_H
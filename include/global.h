@@ -4,11 +4,12 @@
 #include <Arduino.h>
 #include "fd_forward.h"
 #include "fr_forward.h"
+#include "face_gallery.h"
+#include "presence_gate.h"
 
 // ─── Attendance mode flag ────────────────────────────────────────────────────
 extern bool isAttendanceMode;          // true = running face recognition loop
-extern unsigned long lastRecognitionTime;
-extern const unsigned long RECOGNITION_COOLDOWN;
+extern const unsigned long RECOGNITION_COOLDOWN;   // per person (cooldown_table.h)
 
 // ─── Enrollment ───────────────────────────────────────────────────────────────
 // Number of face-embedding frames accumulated per enrollment call.
@@ -17,7 +18,9 @@ extern const unsigned long RECOGNITION_COOLDOWN;
 
 // ─── Face recognition objects (defined in app_httpd.cpp) ────────────────────
 extern mtmn_config_t mtmn_config;
-extern face_id_name_list id_list;
+extern face_id_name_list id_list;      // esp-face enrolment accumulator only
+extern FaceGallery       faceGallery;  // enrolled faces used for matching
+extern PresenceGate      presenceGate; // motion gate ahead of face_detect (main.cpp)
 
 // ─── Web-server control flags ────────────────────────────────────────────────
 extern int8_t detection_enabled;
@@ -67,12 +70,15 @@ struct AttendanceSettings {
     char  endTime[6];       // "18:00"
     char  lateTime[6];      // "08:10"
     char  absentTime[6];    // "10:00"
-    int   confidence;       // 85  (recognition confidence %, stored for UI)
+    int   confidence;       // 55  match threshold: cosine similarity × 100
     bool  buzzerEnabled;    // flash/buzzer feedback on recognition
     bool  autoMode;         // attendance detection always-on when not in admin mode
     long  gmtOffsetSec;     // seconds east of UTC, e.g. 3600 for UTC+1 (Nigeria)
     char  ntpServer[64];    // "pool.ntp.org"
     char  ssid[32];         // stored so dashboard can display it
+    bool  galleryInt8;      // int8 face gallery + float re-rank (applied at boot)
+    int   maxFaces;         // faces recognised per frame, 1..FACE_GALLERY_BATCH_MAX
+    bool  presenceGate;     // skip face_detect while the scene is unchanged
 };
 
 extern AttendanceSettings gSettings;
@@ -108,16 +114,22 @@ struct AttendanceRecord {
     char time[6];          // "HH:MM"
     char status[16];       // "Present" | "Late" | "Absent"
     char notes[64];        // free-form notes (manual entries)
-    char confidence[8];    // e.g. "92%" – placeholder for MTMN
+    char confidence[8];    // match similarity × 100, e.g. "87%"
+
+    // Stores a FaceGallery similarity (0..1) as "NN%".
+    void setConfidence(float similarity) {
+        int pct = (int)(similarity * 100.0f + 0.5f);
+        snprintf(confidence, sizeof(confidence), "%d%%", pct < 0 ? 0 : (pct > 100 ? 100 : pct));
+    }
 
     // Helper: build a minimal auto-recognised record (date/time/status filled by SD layer)
     static AttendanceRecord fromFace(const char *_uid, const char *_name,
-                                     const char *_dept = "") {
+                                     const char *_dept, float similarity) {
         AttendanceRecord r = {};
         strncpy(r.uid,  _uid,  sizeof(r.uid)  - 1);
         strncpy(r.name, _name, sizeof(r.name) - 1);
         strncpy(r.dept, _dept, sizeof(r.dept) - 1);
-        strncpy(r.confidence, "92%", sizeof(r.confidence) - 1);
+        r.setConfidence(similarity);
         return r;
     }
 };
@@ -138,12 +150,29 @@ inline void setDefaultSettings(AttendanceSettings &s) {
     strncpy(s.endTime,     "18:00",       sizeof(s.endTime));
     strncpy(s.lateTime,    "08:10",       sizeof(s.lateTime));
     strncpy(s.absentTime,  "10:00",       sizeof(s.absentTime));
-    s.confidence    = 85;
+    s.confidence    = 55;     // == esp-face FACE_REC_THRESHOLD
     s.buzzerEnabled = false;
     s.autoMode      = true;
     s.gmtOffsetSec  = 3600;   // UTC+1 (Nigeria / WAT)
     strncpy(s.ntpServer, "pool.ntp.org", sizeof(s.ntpServer));
     strncpy(s.ssid,      "unknown",      sizeof(s.ssid));
+    s.galleryInt8   = false;
+    s.maxFaces      = 1;      // one face per frame, as before multi-face support
+    s.presenceGate  = true;
+}
+
+// ─── Helper: acceptance threshold for FaceGallery::match ─────────────────────
+// gSettings.confidence is a percentage of cosine similarity; clamped so a bad
+// value cannot turn recognition off (≥ 1.0) or accept everyone.
+inline float matchThreshold() {
+    int c = gSettings.confidence;
+    return (c < 30 ? 30 : (c > 99 ? 99 : c)) / 100.0f;
+}
+
+// ─── Helper: faces embedded per frame (also the O-net candidate cap) ─────────
+inline int maxFacesPerFrame() {
+    int n = gSettings.maxFaces;
+    return n < 1 ? 1 : (n > FACE_GALLERY_BATCH_MAX ? FACE_GALLERY_BATCH_MAX : n);
 }
 
 #endif // GLOBALS_H
@@ -0,0 +1,62 @@
+#ifndef LONG_POLL_H
+#define LONG_POLL_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  long_poll.h
+//  Held requests for /api/enroll_status?wait=N: the answer goes out when the
+//  watched value changes (a capture was taken) or the wait times out,
+//  instead of the portal asking every 400 ms.
+//
+//  httpd on port 80 runs every handler on one task, so a handler that
+//  blocked would stall the whole API.  The handler instead parks its socket
+//  here and returns, as /stream and /api/events do.  One task answers the
+//  parked requests when notify() says the value moved or a deadline passes.
+//  It writes a complete keep-alive response, so the browser's next request
+//  goes back through httpd on the same connection.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Arduino.h>
+
+#define LONGPOLL_MAX_WAITERS   4         // parked requests (port 80 sockets)
+#define LONGPOLL_DEFAULT_MS    10000     // wait without ?timeout=
+#define LONGPOLL_MAX_MS        25000     // longest wait a caller may ask for
+#define LONGPOLL_BODY_MAX      192       // answer JSON, bytes
+
+namespace LongPoll {
+
+    struct Stats {
+        uint32_t waiting;       // parked now
+        uint32_t parked;        // requests held since boot
+        uint32_t changed;       // answered because the value moved
+        uint32_t timedOut;      // answered at the deadline
+        uint32_t full;          // no free slot: answered at once by the caller
+        uint32_t failed;        // answer could not be written: session closed
+    };
+
+    // ready(seen): true once the watched value differs from `seen`.
+    // body(): the answer JSON (called on the answering task).
+    // onError(fd): an answer could not be written; close the session.
+    bool begin(bool (*ready)(uint32_t seen), void (*body)(char *out, size_t len),
+               void (*onError)(int fd), int core = -1);
+
+    // Holds the request on connected socket fd until ready(seen) or
+    // timeoutMs.  Returns a waiter id, or -1 when every slot is taken (the
+    // caller answers at once).  The socket stays with httpd; it is only
+    // written once.
+    int  park(int fd, uint32_t seen, uint32_t timeoutMs);
+
+    // The session is closing: forget a waiter that has not been answered.
+    // Safe with ids already answered.
+    void cancel(int id);
+
+    // The watched value may have changed.  Cheap; call from any task.
+    void notify();
+
+    Stats  stats();
+    String toJSON();
+
+} // namespace LongPoll
+
+#endif // LONG_POLL_H
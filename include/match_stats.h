@@ -0,0 +1,32 @@
+#ifndef MATCH_STATS_H
+#define MATCH_STATS_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  match_stats.h
+//  Histogram of real recognition scores since boot (or the last reset), for
+//  tuning the acceptance threshold (Settings → Confidence) from data:
+//
+//    best     – highest cosine similarity per recognised-or-rejected face,
+//               split into accepted / rejected, MATCH_STATS_BINS bins on [0,1]
+//    margin   – best − second-best, MATCH_STATS_MARGIN_BINS bins of the same
+//               width; a thin margin means two enrolled faces look alike
+//
+//  Served as JSON by GET /api/match_stats (?reset=1 clears it).  Counters are
+//  lock-free; record() is called from the attendance task and the stream.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <Arduino.h>
+
+#define MATCH_STATS_BINS         20     // 0.05 wide over [0, 1]
+#define MATCH_STATS_MARGIN_BINS  10     // 0.05 wide, last bin open-ended
+
+namespace MatchStats {
+
+    // best / second as returned in FaceGallery::Match (second < 0: none).
+    void   record(float best, float second, bool accepted);
+    void   reset();
+    String toJSON();
+
+} // namespace MatchStats
+
+#endif // MATCH_STATS_H
@@ -0,0 +1,60 @@
+#ifndef MJPEG_PART_H
+#define MJPEG_PART_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  mjpeg_part.h
+//  multipart/x-mixed-replace framing for /stream.  A part is its header
+//  block (boundary, Content-Type / -Length, X-… lines) followed by the JPEG,
+//  and goes to the socket as one unit: a single sendmsg() with the header
+//  and the JPEG as two iovecs, so lwip queues them back to back and the
+//  header rides in the same TCP segment as the first JPEG bytes.
+//
+//  The JPEG is never copied.  It is the camera's frame buffer or the
+//  re-encoder's output, neither of which can reserve headroom in front of
+//  the data, so the header is gathered from its own buffer instead.
+//
+//  The response head (the prologue) goes out as a Wire with no body.  The
+//  stream is written raw rather than through httpd's chunked encoding,
+//  which would cost three more writes per part.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/time.h>
+
+#define MJPEG_BOUNDARY      "123456789000000000000987654321"
+#define MJPEG_CONTENT_TYPE  "multipart/x-mixed-replace;boundary=" MJPEG_BOUNDARY
+
+namespace Mjpeg {
+
+    // One part on its way out.  `off` counts bytes of head + body already
+    // written, so a non-blocking writer can resume where the socket filled.
+    struct Wire {
+        const char    *head;
+        size_t         headLen;
+        const uint8_t *body;        // nullptr: head only (the HTTP prologue)
+        size_t         bodyLen;
+        size_t         off;
+
+        size_t total() const { return headLen + bodyLen; }
+        bool   done()  const { return off >= total(); }
+    };
+
+    // Writes the part header for a `bodyLen`-byte JPEG captured at `ts`
+    // into out: boundary, Content-Type, Content-Length, X-Timestamp, then
+    // the printf-formatted `extra` header lines (each ending in "\r\n"),
+    // then the blank line.  Returns its length; a header that does not fit
+    // is cut at cap - 1.
+    size_t formatHead(char *out, size_t cap, size_t bodyLen, const struct timeval &ts,
+                      const char *extra = nullptr, ...)
+        __attribute__((format(printf, 5, 6)));
+
+    // Writes what is left of `w` in one call and advances w.off.  Returns
+    // the bytes written; 0 when the socket took nothing (EAGAIN under
+    // MSG_DONTWAIT – errno says which); -1 on a socket error.
+    ssize_t write(int fd, Wire &w, int flags);
+
+} // namespace Mjpeg
+
+#endif // MJPEG_PART_H
@@ -0,0 +1,134 @@
+#ifndef OS_PORT_H
+#define OS_PORT_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  os_port.h
+//  The handful of RTOS primitives the portable modules (attendance journal,
+//  …) need, selected at compile time like storage_backend.h:
+//
+//    osTaskStart(fn, name, stackBytes, arg, prio, core)  – spawn a worker
+//    OsSignal                                            – binary semaphore
+//    OsMutex / OsLock                                    – mutex + scope guard
+//    osDelayMs(ms)
+//    osAllocLarge(bytes, align) / osFreeLarge(p)         – PSRAM-first buffers
+//
+//  Device build : FreeRTOS tasks / semaphores, heap_caps (PSRAM, else DRAM).
+//  Host build   : detached std::thread, std::mutex + condition variable,
+//                 aligned_alloc.
+//
+//  Signals and mutexes are created once and never destroyed – they live as
+//  long as the firmware, like every other task-shared object in this codebase.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(FACEGUARD_HOST)
+
+  #include <chrono>
+  #include <stdlib.h>
+  #include <condition_variable>
+  #include <mutex>
+  #include <thread>
+
+  inline bool osTaskStart(void (*fn)(void *), const char * /*name*/, uint32_t /*stackBytes*/,
+                          void *arg, unsigned /*prio*/, int /*core*/) {
+      std::thread(fn, arg).detach();
+      return true;
+  }
+
+  inline void osDelayMs(uint32_t ms) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  }
+
+  class OsSignal {
+  public:
+      void give() {
+          { std::lock_guard<std::mutex> g(_m); _set = true; }
+          _cv.notify_one();
+      }
+      // Waits up to ms for give(); consumes it.  Returns false on timeout.
+      bool take(uint32_t ms) {
+          std::unique_lock<std::mutex> g(_m);
+          bool ok = _cv.wait_for(g, std::chrono::milliseconds(ms), [this] { return _set; });
+          _set = false;
+          return ok;
+      }
+  private:
+      std::mutex              _m;
+      std::condition_variable _cv;
+      bool                    _set = false;
+  };
+
+  class OsMutex {
+  public:
+      void lock()   { _m.lock(); }
+      void unlock() { _m.unlock(); }
+  private:
+      std::mutex _m;
+  };
+
+  inline void *osAllocLarge(size_t bytes, size_t align) {
+      return aligned_alloc(align, (bytes + align - 1) / align * align);
+  }
+  inline void osFreeLarge(void *p) { free(p); }
+
+#else
+
+  #include <freertos/FreeRTOS.h>
+  #include <freertos/task.h>
+  #include <freertos/semphr.h>
+  #include <esp_heap_caps.h>
+
+  // core < 0 → no affinity.
+  inline bool osTaskStart(void (*fn)(void *), const char *name, uint32_t stackBytes,
+                          void *arg, unsigned prio, int core) {
+      BaseType_t ok = (core < 0)
+          ? xTaskCreate(fn, name, stackBytes, arg, prio, NULL)
+          : xTaskCreatePinnedToCore(fn, name, stackBytes, arg, prio, NULL, core);
+      return ok == pdPASS;
+  }
+
+  inline void osDelayMs(uint32_t ms) { vTaskDelay(pdMS_TO_TICKS(ms)); }
+
+  class OsSignal {
+  public:
+      OsSignal() : _sem(xSemaphoreCreateBinary()) { configASSERT(_sem); }
+      void give()           { xSemaphoreGive(_sem); }
+      bool take(uint32_t ms) { return xSemaphoreTake(_sem, pdMS_TO_TICKS(ms)) == pdTRUE; }
+  private:
+      SemaphoreHandle_t _sem;
+  };
+
+  class OsMutex {
+  public:
+      OsMutex() : _m(xSemaphoreCreateMutex()) { configASSERT(_m); }
+      void lock()   { xSemaphoreTake(_m, portMAX_DELAY); }
+      void unlock() { xSemaphoreGive(_m); }
+  private:
+      SemaphoreHandle_t _m;
+  };
+
+  // Large, long-lived buffers (embedding galleries, frame pools) go to PSRAM
+  // when the board has it, leaving internal DRAM for WiFi / lwIP / stacks.
+  inline void *osAllocLarge(size_t bytes, size_t align) {
+      void *p = heap_caps_aligned_alloc(align, bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      if (!p) p = heap_caps_aligned_alloc(align, bytes, MALLOC_CAP_8BIT);
+      return p;
+  }
+  inline void osFreeLarge(void *p) { heap_caps_free(p); }
+
+#endif
+
+// Scope guard for OsMutex.
+class OsLock {
+public:
+    explicit OsLock(OsMutex &m) : _m(m) { _m.lock(); }
+    ~OsLock() { _m.unlock(); }
+    OsLock(const OsLock &) = delete;
+    OsLock &operator=(const OsLock &) = delete;
+private:
+    OsMutex &_m;
+};
+
+#endif // OS_PORT_H
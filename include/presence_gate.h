@@ -0,0 +1,69 @@
+#ifndef PRESENCE_GATE_H
+#define PRESENCE_GATE_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  presence_gate.h
+//  Cheap "is anything there?" check in front of face_detect().  Each frame's
+//  luma thumbnail (40×30 at QVGA, from the JPEG DC coefficients – see
+//  FrameDecode::decodeLuma) is compared with the previous thumbnail (motion)
+//  and with an adaptive background model (something is there).  The MTMN
+//  cascade runs while either covers enough of the thumbnail, and for
+//  PRESENCE_HOLD_MS afterwards.
+//
+//  Background: per-pixel running average in 8.8 fixed point.  Unchanged
+//  pixels learn quickly, changed pixels slowly, so a person standing at the
+//  camera stays foreground.  Foreground that has not moved at all for
+//  PRESENCE_STILL_MS (a parked trolley, the "ghost" someone leaves behind)
+//  is absorbed into the background in one step.  Global brightness shifts
+//  (auto exposure, lights switched on) are removed by comparing against the
+//  mean difference instead of zero.
+//
+//  update() is called by the pipeline's DECODE stage only; stats() and
+//  toJSON() may be called from any task.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+#include <atomic>
+#include <Arduino.h>
+
+#define PRESENCE_MAX_W      80
+#define PRESENCE_MAX_H      60
+#define PRESENCE_PIXEL_DELTA 16      // luma change that counts a pixel as changed
+#define PRESENCE_AREA_PCT    1.5f    // % of pixels changed that wakes the pipeline
+#define PRESENCE_HOLD_MS   3000      // keep running this long after the last change
+#define PRESENCE_STILL_MS 10000      // motionless foreground is absorbed after this
+#define PRESENCE_LEARN_IDLE   3      // background rate 1/8 per frame, still pixels
+#define PRESENCE_LEARN_BUSY   6      // 1/64 for changed pixels
+
+class PresenceGate {
+public:
+    struct Stats {
+        uint32_t frames;        // thumbnails examined
+        uint32_t changed;       // frames with motion or foreground
+        uint32_t held;          // quiet frames run because of the hold window
+        uint32_t skipped;       // frames that never reached face_detect
+        uint32_t absorbed;      // motionless foreground taken into the background
+        float    lastChangePct; // % of pixels differing from the background
+        uint32_t maxUs;         // slowest update()
+    };
+
+    // Returns true if the full pipeline should run on this frame.  A frame
+    // of a new size resets the background (and returns true).
+    bool update(const uint8_t *luma, int w, int h, uint32_t nowMs);
+
+    void  reset();
+    Stats stats() const;
+    String toJSON() const;      // {"frames":…,"hitRate":…,…}
+
+private:
+    uint16_t _bg[PRESENCE_MAX_W * PRESENCE_MAX_H];
+    uint8_t  _prev[PRESENCE_MAX_W * PRESENCE_MAX_H];
+    int      _w = 0, _h = 0;
+    uint32_t _lastChangeMs = 0;     // last frame with motion or foreground
+    uint32_t _lastMotionMs = 0;     // last frame with motion
+
+    std::atomic<uint32_t> _frames{0}, _changed{0}, _held{0}, _skipped{0}, _absorbed{0}, _maxUs{0};
+    std::atomic<uint32_t> _lastChangeMilli{0};   // lastChangePct × 1000
+};
+
+#endif // PRESENCE_GATE_H
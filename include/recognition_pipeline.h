@@ -0,0 +1,92 @@
+#ifndef RECOGNITION_PIPELINE_H
+#define RECOGNITION_PIPELINE_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  recognition_pipeline.h
+//  The attendance loop as three tasks joined by bounded queues, so frame N+1
+//  is decoded while frame N is in face_detect() and frame N-1 is being
+//  embedded:
+//
+//    DECODE     newest frame → presence gate → detection image
+//       │  queue (PIPELINE_QUEUE_LEN)
+//    DETECT     MTMN cascade → face-region decode
+//       │  queue (PIPELINE_QUEUE_LEN)
+//    RECOGNISE  align → embed → gallery match → journal / feedback
+//
+//  Each stage is pinned to its own core (begin()); by default detection has
+//  CPU 0 to itself while decode and recognition share CPU 1 with httpd.
+//  A full queue blocks the stage in front of it, and DECODE only takes a
+//  frame from the capture broker once fewer than PIPELINE_DECODE_AHEAD
+//  images are waiting, so detection never works on stale frames – the
+//  broker skips them instead – and latency stays close to the sum of the
+//  stage times.
+//
+//  The stage bodies are supplied by the caller (main.cpp on the device, a
+//  simulated workload in host/bench/bench_pipeline.cpp); this module owns
+//  the tasks, queues, Job slots and per-stage statistics.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+#include <Arduino.h>
+#include "fd_forward.h"
+#include "capture_broker.h"
+#include "frame_pool.h"
+
+#define PIPELINE_QUEUE_LEN   2      // per link; power of two (bounded_queue.h)
+#define PIPELINE_DECODE_AHEAD 1     // detection images waiting for DETECT, at most
+#define PIPELINE_JOBS        8      // ≥ both queues + one job per stage
+
+namespace Pipeline {
+
+    enum Stage { DECODE, DETECT, RECOGNISE, STAGE_COUNT };
+
+    // One frame's worth of work, handed from stage to stage.  Fields are
+    // filled by the stage bodies; release() must free whatever is set
+    // outside `arena`, which the pipeline rewinds (and whose FramePool slot
+    // it returns) once the job is done.
+    struct Job {
+        FrameArena        arena;    // image matrices for this frame
+        Capture::FrameRef frame;    // DECODE → DETECT (region decode needs the JPEG)
+        dl_matrix3du_t   *im;       // detection image
+        dl_matrix3du_t   *faceIm;   // alignment image, DETECT → RECOGNISE
+        box_array_t      *boxes;    // faces in faceIm coordinates
+        int               shift;    // detection scale, 1 / (1 << shift)
+        uint32_t          startUs;  // micros() when DECODE picked the frame
+    };
+
+    struct Stages {
+        // Each returns false when the job goes no further (no frame / no
+        // face); the pipeline then calls release() and reuses the slot.
+        // decode() is responsible for its own pacing when it has nothing.
+        bool (*decode)(Job &job);
+        bool (*detect)(Job &job);
+        void (*recognise)(Job &job);
+        void (*release)(Job &job);
+    };
+
+    struct StageStats {
+        uint32_t done;          // jobs passed on (or finished, for RECOGNISE)
+        uint32_t dropped;       // jobs that ended here
+        uint32_t avgUs;         // mean time in the stage body (recent, EWMA)
+        uint32_t maxUs;
+        uint32_t busyPct;       // share of wall time spent in the stage body
+        uint32_t queued;        // jobs waiting in the queue in front of it
+        uint32_t queuedMax;
+    };
+
+    struct Stats {
+        StageStats stage[STAGE_COUNT];
+        uint32_t   latencyAvgUs;    // DECODE start → RECOGNISE end (EWMA)
+        uint32_t   latencyMaxUs;
+    };
+
+    // Starts the three tasks, stage s pinned to cores[s] (-1: any).  Call
+    // once, after Capture::begin().
+    bool begin(const Stages &stages, const int cores[STAGE_COUNT]);
+
+    Stats  stats();
+    String toJSON();    // {"stages":[{"name":"decode",…},…],"latencyAvgUs":…}
+
+} // namespace Pipeline
+
+#endif // RECOGNITION_PIPELINE_H
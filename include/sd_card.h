@@ -5,13 +5,16 @@
 //  FaceGuard Pro  –  sd_card.h
 //  SD / persistence layer built on greiman/SdFat (v2) instead of Arduino
 //  SD_MMC, giving full long-filename (LFN) support on FAT32 / exFAT cards.
+//  The same sources build for Linux against a POSIX directory tree (see
+//  storage_backend.h and host/CMakeLists.txt).
 // ─────────────────────────────────────────────────────────────────────────────
 
 #include "fr_forward.h"
-#include <SdFat.h>
 #include <ArduinoJson.h>
 #include "global.h"
 
+#define CSV_EXPORT_MAX_DAYS  366     // longest from..to range of one CSV export
+
 namespace Bridge {
 
     // ── SD initialisation (creates /db, /atd, /cfg, /db/users.txt if missing)
@@ -25,9 +28,33 @@ namespace Bridge {
     // ── Directory helper ─────────────────────────────────────────────────────
     void listDir(const char *dirname, uint8_t levels);
 
-    // ── Face-ID binary persistence ──────────────────────────────────────────
-    void read_face_id_name_list_sdcard(face_id_name_list *l, const char *path);
-    void write_face_id_name_list_sdcard(face_id_name_list *l, const char *path);
+    // ── Face gallery persistence (FACE.BIN, see sd_card.cpp for layout) ─────
+    // load reads v2 or the legacy esp-face list format (migrating it to v2);
+    // an INT8 gallery loads from the FACE.Q8 sidecar when it is current.
+    // append / patch rewrite one record + the header after FaceGallery::add()
+    // or remove(); both fall back to a full save if the file is out of step.
+    // append takes the raw vector: an INT8 gallery cannot reproduce it.
+    // An INT8 save keeps the exact vectors already in FACE.BIN (matched by
+    // name) and never replaces them with the int8 rows.  When the card is
+    // busy the change is kept and false returned; syncFaceGallery() writes
+    // it (cheap when nothing is pending – call it periodically).
+    bool loadFaceGallery(FaceGallery &g, const char *path);
+    bool saveFaceGallery(FaceGallery &g, const char *path);
+    bool appendFaceGallery(FaceGallery &g, const char *name, const float *vec,
+                           const char *path);
+    bool patchFaceGalleryAfterRemove(FaceGallery &g, int slot, const char *path);
+    bool syncFaceGallery(FaceGallery &g, const char *path);
+
+    // Exact vector of FACE.BIN record `row` (the INT8 re-rank source).
+    // Served from a PSRAM cache of recent rows; a miss reads the card only
+    // if it is free at once.  Never waits: false if busy or missing.
+    // holdFaceRecords() must be called before FaceGallery::remove(): until
+    // patchFaceGalleryAfterRemove() (always called after, slot < 0 too)
+    // releases it, no record is served, since gallery rows have moved and
+    // FACE.BIN's have not.
+    bool   readFaceRecord(const char *path, uint32_t row, float *vec);
+    void   holdFaceRecords();
+    String faceRowsJSON();      // cache hits / misses / busy / approxRows, for /api/perf
 
     // ── User database (JSON array in /db/users.txt) ──────────────────────────
     bool   saveUserToDB(const UserRecord &user);
@@ -46,21 +73,54 @@ namespace Bridge {
     // logAttendance – auto path: date / time / status filled from current time.
     void logAttendance(const AttendanceRecord &rec);
 
+    // logAttendanceBatch – appends many auto check-ins under one SD lock with
+    // one open/append/close per day.  Empty date/time fields are stamped with
+    // the current clock; status is derived from time when left empty.
+    // Returns rows written; *duplicates counts records already logged that day.
+    int  logAttendanceBatch(const AttendanceRecord *recs, int n, int *duplicates = nullptr);
+
+    // Called once per row logAttendanceBatch() has written, with date, time
+    // and status filled in (SD mutex held – keep it short; the event hub
+    // publishes from it).  Manual overrides do not call it.
+    typedef void (*CheckinHook)(const AttendanceRecord &rec);
+    void setCheckinHook(CheckinHook fn);
+
     // manualAttendance – admin override; date/time/status taken from rec fields.
     bool manualAttendance(const AttendanceRecord &rec);
 
     // ── Attendance queries ────────────────────────────────────────────────────
     String getLogsJSON(String date, String dept, String status, String search);
+
+    // Receives output a piece at a time (at most 1 KB); false aborts.
+    typedef bool (*ChunkSink)(void *ctx, const char *data, size_t len);
+
+    // getLogsJSON as a stream: the day's rows are read a block at a time,
+    // filtered, and written through `sink` as they are parsed.  Memory use
+    // does not depend on the number of rows, and no row is dropped.  The SD
+    // lock is not held while sink() runs.  False if the sink aborted.
+    bool streamLogsJSON(const char *date, const char *dept, const char *status,
+                        const char *search, ChunkSink sink, void *ctx);
     String getLogsRange(int days);
     String getAttendanceLogs();
     String downloadAttendanceCSV(String date = "");
+
+    // CSV export of the days from..to ("YYYY-MM-DD", inclusive, at most
+    // CSV_EXPORT_MAX_DAYS): one header line, then each day's rows in date
+    // order.  Streamed from the card a block at a time, so memory use does
+    // not depend on the size; a byte range of it can be sent (HTTP Range).
+    // csvExportSize() is its length in bytes, -1 for a bad date range.
+    // streamCSVExport() writes bytes [offset, offset + length) through sink;
+    // false if the sink aborted or the files changed under it.
+    int32_t csvExportSize(const char *from, const char *to);
+    bool    streamCSVExport(const char *from, const char *to, uint32_t offset,
+                            uint32_t length, ChunkSink sink, void *ctx);
     bool   clearAttendanceLogs(String date = "");
 
     // ── Factory reset ─────────────────────────────────────────────────────────
     // Wipes all SD data to a clean slate: deletes every attendance log,
     // FACE.BIN, users.txt (reset to []), and settings.json, then recreates
     // the directory structure.  The caller must also clear the in-memory
-    // face id_list (done in api_factory_reset_handler in app_httpd.cpp).
+    // face gallery (done in api_factory_reset_handler in app_httpd.cpp).
     bool   factoryReset();
 
     // ── Dashboard / storage / status ─────────────────────────────────────────
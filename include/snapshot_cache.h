@@ -0,0 +1,61 @@
+#ifndef SNAPSHOT_CACHE_H
+#define SNAPSHOT_CACHE_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  snapshot_cache.h
+//  Single JPEG snapshots (/capture) for pollers: the portal thumbnail, door
+//  wall displays, external dashboards.
+//
+//  The cache is the capture broker's latest frame.  While anything else
+//  is subscribed (the attendance loop normally is), that frame is at most
+//  one camera frame old, and a snapshot costs nothing but the send.  Only
+//  when it is older than the caller's max age does one caller subscribe for
+//  a fresh frame.  Callers arriving meanwhile wait for that frame rather
+//  than starting captures of their own.  After the refresh the camera is
+//  left alone again.
+//
+//  Each frame has an ETag, so a poller that already has the current frame
+//  gets a 304 and no body.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Arduino.h>
+#include "capture_broker.h"
+
+#define SNAPSHOT_MAX_AGE_MS     1000    // default for /capture without ?max_age=
+#define SNAPSHOT_WAIT_MS        2000    // longest a refresh waits for the camera
+#define SNAPSHOT_WARMUP_FRAMES  2       // frames dropped when the camera was idle
+                                        // (fb_count: the driver's queued frames
+                                        //  are from before it went idle)
+#define SNAPSHOT_ETAG_LEN       24
+
+namespace Snapshot {
+
+    struct Stats {
+        uint32_t cached;        // served from a frame already captured
+        uint32_t refreshed;     // had to wait for a new frame
+        uint32_t shared;        // waited for another caller's refresh
+        uint32_t notModified;   // If-None-Match matched: 304
+        uint32_t failed;        // no frame within SNAPSHOT_WAIT_MS
+    };
+
+    // Call once, after Capture::begin().
+    void begin();
+
+    // The newest JPEG frame captured no more than maxAgeMs ago, capturing
+    // one if needed.  Empty when the camera delivered nothing in time.
+    Capture::FrameRef get(uint32_t maxAgeMs = SNAPSHOT_MAX_AGE_MS);
+
+    // Quoted strong ETag for `f`, unique across reboots.
+    void etag(const Capture::Frame &f, char *out, size_t len);
+
+    // True (and counted) when an If-None-Match value names `tag`.
+    bool notModified(const char *ifNoneMatch, const char *tag);
+
+    Stats  stats();
+    String toJSON();
+
+} // namespace Snapshot
+
+#endif // SNAPSHOT_CACHE_H
@@ -0,0 +1,68 @@
+#ifndef STORAGE_BACKEND_H
+#define STORAGE_BACKEND_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  storage_backend.h
+//  Compile-time storage backend for the Bridge persistence layer.
+//
+//  sd_card.cpp is written against two names only:
+//    StorageFs   – the volume object (begin / exists / mkdir / remove / vol)
+//    StorageFile – an open file or directory handle (File32-compatible API)
+//  plus the storageLock*() trio that serialises access across tasks.
+//
+//  Device build : SdFat32 / File32 on the SPI SD card, FreeRTOS recursive mutex.
+//  Host build   : PosixFs / PosixFile on a plain directory tree, std mutex.
+//                 Selected by -D FACEGUARD_HOST (see host/CMakeLists.txt).
+//
+//  The backend is chosen at compile time rather than through a virtual
+//  interface so the device build keeps calling SdFat directly — the SD path
+//  is hot enough (every check-in, every portal poll) that an extra indirection
+//  per byte read is not free on the ESP32.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stdint.h>
+
+#if defined(FACEGUARD_HOST)
+
+  #include "storage_posix.h"
+  typedef PosixFs   StorageFs;
+  typedef PosixFile StorageFile;
+
+  // Host lock lives in storage_posix.cpp (std::recursive_timed_mutex).
+  void storageLockInit();
+  bool storageLockTake(uint32_t timeoutMs);
+  void storageLockGive();
+
+#else
+
+  // SdFat32 handles FAT32 (the format used by every ESP32-CAM microSD card)
+  // and enables full LFN (long filename) support when built with
+  // -D USE_LONG_FILE_NAMES=255.
+  #include <SdFat.h>
+  #include <freertos/FreeRTOS.h>
+  #include <freertos/semphr.h>
+  typedef SdFat32 StorageFs;
+  typedef File32  StorageFile;
+
+  // Recursive so helper functions that call other SD helpers
+  // (e.g. getUserCount → getUsersJSON) don't self-deadlock.
+  inline SemaphoreHandle_t &_storageMutex() {
+      static SemaphoreHandle_t m = nullptr;
+      return m;
+  }
+  inline void storageLockInit() {
+      if (!_storageMutex()) {
+          _storageMutex() = xSemaphoreCreateRecursiveMutex();
+          configASSERT(_storageMutex());
+      }
+  }
+  inline bool storageLockTake(uint32_t timeoutMs) {
+      return xSemaphoreTakeRecursive(_storageMutex(), pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+  }
+  inline void storageLockGive() {
+      xSemaphoreGiveRecursive(_storageMutex());
+  }
+
+#endif
+
+#endif // STORAGE_BACKEND_H
@@ -0,0 +1,141 @@
+#ifndef STREAM_BROADCAST_H
+#define STREAM_BROADCAST_H
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  FaceGuard Pro  –  stream_broadcast.h
+//  MJPEG for any number of /stream viewers at the cost of one.
+//
+//    producer   one task subscribes to the capture broker and turns each
+//               camera frame into a Part exactly once – the render hook
+//               (app_httpd.cpp) runs detection and, when a viewer wants the
+//               boxes burnt in, the annotate + re-encode.
+//    sender     one task writes the newest Part to every viewer socket with
+//               non-blocking sends.  A viewer that is still busy with an
+//               older Part simply gets the newest one when it finishes
+//               (latest-frame-wins), so a slow client never holds up the
+//               producer or the other viewers.
+//
+//  Each viewer has its own controller.  It measures how long each part
+//  takes to go out (the socket only drains as the link delivers, so on a
+//  congested hotspot this is the queueing delay) and holds it under a
+//  target: over target it spaces its frames out and asks for a lower
+//  re-encode quality; well under target it recovers, rate first.  The
+//  producer only renders when some viewer is idle and due a frame, and
+//  encodes at the lowest quality any plain viewer asked for, so a viewer
+//  on bad Wi-Fi costs less CPU, never more.  The operating point
+//  goes out in each part's X-Stream header.  Preview resolution is left
+//  alone: the sensor framesize is shared with recognition.
+//
+//  Each part – header and JPEG – goes out in one gather write
+//  (mjpeg_part.h), so a viewer with room in its socket costs one call per
+//  frame.
+//
+//  The /stream handler hands its socket over with addViewer() and returns,
+//  so the stream server stays free to accept the next viewer.  A viewer
+//  that accepts nothing for BROADCAST_STALL_MS is dropped and the stall
+//  handler closes its session.  With no viewers both tasks sleep and the
+//  broadcaster holds no capture subscription.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <Arduino.h>
+#include "capture_broker.h"
+#include "mjpeg_part.h"
+
+#define BROADCAST_BOUNDARY     MJPEG_BOUNDARY
+#define BROADCAST_MAX_VIEWERS  4
+#define BROADCAST_FACES_MAX    640      // X-Faces JSON, bytes
+#define BROADCAST_HEAD_MAX     (BROADCAST_FACES_MAX + 256)   // part header / prologue
+#define BROADCAST_STALL_MS     10000    // no bytes accepted for this long: drop
+#define BROADCAST_POLL_MS      20       // sender recheck while a socket is full
+#define BROADCAST_TARGET_MS    300      // default per-part send-time target
+#define BROADCAST_MAX_INTERVAL_MS 2000  // slowest frame spacing the controller picks
+#define BROADCAST_QUALITY_LEVELS  5     // re-encode quality steps (90 … 30)
+
+namespace Broadcast {
+
+    enum Kind : uint8_t {
+        PLAIN,      // /stream          – boxes burnt in when detection is on
+        OVERLAY,    // /stream?overlay=1 – camera JPEG + X-Faces header
+    };
+
+    // One output frame, shared by every viewer.  The producer sets frame and
+    // points plain / clean at its JPEG before calling the render hook.
+    struct Part {
+        Capture::FrameRef frame;
+        const uint8_t    *plain;        // what PLAIN viewers get
+        size_t            plainLen;
+        const uint8_t    *clean;        // what OVERLAY viewers get
+        size_t            cleanLen;
+        uint8_t          *encoded;      // set by render if it malloc'd a JPEG; freed with the part
+        uint8_t           quality;      // set by render when it re-encodes plain; 0 = as captured
+        char              faces[BROADCAST_FACES_MAX];   // X-Faces JSON, "" for none
+        uint32_t          seq;
+        std::atomic<int>  refs;
+    };
+
+    // What the connected viewers need from the next part.
+    struct Want {
+        bool    plain;          // PLAIN viewers are connected
+        bool    overlay;        // OVERLAY viewers are connected
+        uint8_t quality;        // re-encode quality for plain viewers (lowest asked for)
+    };
+
+    // Fills in `part` for `want`.  Runs on the producer task, once per
+    // camera frame that some viewer is due.  False drops the frame.
+    typedef bool (*Render)(Part &part, const Want &want);
+
+    struct ViewerStats {
+        bool     used;
+        uint8_t  kind;
+        uint32_t sent;          // parts written completely
+        uint32_t skipped;       // newer part replaced one before it was sent
+        uint32_t kbytes;
+        uint32_t writes;        // socket writes, including ones the socket refused
+        uint32_t latencyMs;     // capture → last byte handed to the socket (EWMA)
+        uint32_t sendMs;        // first → last byte of a part (EWMA); what is controlled
+        uint32_t kbps;          // send throughput, KB/s (EWMA)
+        uint32_t intervalMs;    // controller: minimum frame spacing
+        uint8_t  quality;       // controller: re-encode quality asked for
+        uint32_t targetMs;
+    };
+
+    struct Stats {
+        uint32_t viewers;
+        uint32_t produced;      // parts rendered
+        uint32_t renderFailed;
+        uint32_t avgRenderUs;   // EWMA
+        uint32_t maxRenderUs;
+        uint32_t stalled;       // viewers dropped for not reading
+        ViewerStats viewer[BROADCAST_MAX_VIEWERS];
+    };
+
+    // Starts the producer on `core` and the sender.  Call once, after
+    // Capture::begin().
+    bool begin(Render render, int core = -1);
+
+    // Called (from the sender, with the broadcaster locked) with the socket
+    // of a viewer dropped for stalling; the owner should close the session.
+    void setStallHandler(void (*fn)(int fd));
+
+    // Starts streaming to the connected socket `fd`, after first writing
+    // `prologue` (the HTTP response head), keeping each part's send time
+    // under `targetMs` (0: no adaptation – every frame, full quality).  Returns a viewer id,
+    // or -1 when all BROADCAST_MAX_VIEWERS are taken.  The broadcaster never
+    // closes fd.
+    int  addViewer(int fd, Kind kind, const char *prologue,
+                   uint32_t targetMs = BROADCAST_TARGET_MS);
+
+    // The socket is going away (session closed).  Safe to call with an id
+    // that was already dropped.
+    void removeViewer(int id);
+
+    int    viewers();
+    Stats  stats();
+    String toJSON();
+
+} // namespace Broadcast
+
+#endif // STREAM_BROADCAST_H
@@ -0,0 +1,1384 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <pgmspace.h>
+
+// Generated by tools/embed_web_assets.py from web/ – do not edit.  After
+// changing anything under web/, run  python3 tools/embed_web_assets.py
+// (PlatformIO does it before each build).
+
+struct WebAsset {
+    const char    *path;        // URL it is served at
+    const char    *type;        // Content-Type
+    const uint8_t *gz;          // gzip'd body
+    size_t         gzLen;
+    size_t         rawLen;      // uncompressed size
+    const char    *etag;        // quoted strong ETag of the gzip'd body
+    bool           immutable;   // versioned URL: cacheable for a year
+};
+
+// login.html: 3302 bytes, 1398 gzip'd
+static const uint8_t web_login_html_gz[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x57,0xdb,0x6e,0xe3,0x36,
+    0x10,0x7d,0xcf,0x57,0xb0,0x0a,0x5a,0xc7,0x85,0x64,0x4b,0xf2,0x35,0x92,0x6d,0x60,
+    0xbb,0xdd,0x2d,0x02,0xb4,0xd8,0x00,0xd9,0x7d,0xd8,0x47,0x4a,0xa2,0x64,0x76,0x25,
+    0x51,0x25,0x29,0xc7,0xae,0x10,0x60,0xff,0xa1,0x7f,0xd0,0x4f,0xdb,0x2f,0xe9,0x90,
+    0xa2,0x63,0xf9,0x92,0x60,0x8b,0x04,0x91,0x44,0x0d,0x87,0x67,0xce,0x9c,0x19,0x4d,
+    0x16,0x3f,0xfc,0xfa,0xe1,0xed,0xc7,0xcf,0xf7,0xef,0xd0,0x5a,0x16,0xf9,0xea,0x6a,
+    0xa1,0x2e,0x28,0xc7,0x65,0xb6,0xb4,0x48,0x69,0xa9,0x05,0x82,0x13,0xb8,0x14,0x44,
+    0x62,0x14,0xaf,0x31,0x17,0x44,0x2e,0xad,0x4f,0x1f,0xdf,0x3b,0x73,0x6b,0xbf,0x5c,
+    0xe2,0x82,0x2c,0xad,0x0d,0x25,0x8f,0x15,0xe3,0xd2,0x42,0x31,0x2b,0x25,0x29,0xc1,
+    0xec,0x91,0x26,0x72,0xbd,0x4c,0xc8,0x86,0xc6,0xc4,0xd1,0x0f,0x36,0x2d,0xa9,0xa4,
+    0x38,0x77,0x44,0x8c,0x73,0xb2,0xf4,0x94,0x0f,0x49,0x65,0x4e,0x56,0xef,0x71,0x4c,
+    0x7e,0xab,0x31,0x4f,0xd0,0x3d,0x67,0xe8,0xdb,0xd7,0x7f,0xd0,0xef,0x2c,0xa3,0xe5,
+    0x62,0xd8,0xbe,0xbe,0x5a,0x08,0xb9,0x53,0xd7,0x9f,0x9b,0x88,0x6d,0x1d,0x41,0xff,
+    0xa6,0x65,0x16,0x44,0x8c,0x27,0x84,0x3b,0xb0,0x12,0x16,0x98,0x83,0x79,0xe0,0x86,
+    0x15,0x4e,0x12,0xf5,0xce,0x7d,0xba,0x8a,0x58,0xb2,0x6b,0x52,0x40,0xe3,0xa4,0xb8,
+    0xa0,0xf9,0x2e,0xe8,0x3d,0x90,0x8c,0x11,0xf4,0xe9,0xae,0x67,0x8b,0x9d,0x90,0xa4,
+    0x70,0x6a,0x6a,0x0b,0x5c,0x0a,0x47,0x10,0x4e,0xd3,0x30,0xc2,0xf1,0x97,0x8c,0xb3,
+    0xba,0x4c,0x82,0x6b,0x77,0xee,0xc6,0x9e,0x1f,0xc6,0x2c,0x67,0x3c,0xb8,0x26,0xf3,
+    0x74,0x9c,0xce,0xc3,0x82,0x96,0xce,0x9a,0xd0,0x6c,0x2d,0x03,0xcf,0x75,0x37,0xeb,
+    0x30,0xa1,0xa2,0xca,0xf1,0x2e,0x48,0x73,0xb2,0x0d,0x71,0x4e,0xb3,0xd2,0xa1,0xe0,
+    0x57,0x04,0x31,0x30,0x40,0x78,0xf8,0x67,0x2d,0x24,0x4d,0x77,0x8e,0xe1,0xc4,0x2c,
+    0xb7,0xd0,0x82,0x20,0x22,0x29,0xe3,0xa4,0xd9,0xbf,0xec,0xf5,0xc2,0x8a,0x09,0x20,
+    0x88,0x95,0x41,0x4a,0xb7,0x24,0x09,0x69,0x09,0x7c,0x43,0x50,0x07,0x60,0x0e,0x2d,
+    0x70,0x46,0x82,0x9c,0x96,0x04,0x73,0x27,0xe3,0x38,0xa1,0xb0,0xf5,0x86,0x67,0x11,
+    0xbe,0x71,0x6d,0xdf,0xbf,0xb5,0xfd,0xc9,0xc4,0x1e,0xb8,0xfe,0xa4,0x8f,0xbc,0x6a,
+    0x6b,0x4b,0x0e,0xe1,0x55,0x98,0x83,0x91,0x7a,0xee,0xdb,0xa7,0x3b,0x6f,0xdd,0x84,
+    0x64,0xf6,0x77,0xef,0xef,0x42,0x81,0x2c,0x90,0x60,0xec,0x56,0x5b,0xa4,0xfe,0x00,
+    0x76,0xaa,0x82,0x73,0xc8,0x06,0x8c,0x45,0x50,0xb2,0x92,0x3c,0x5d,0x0d,0x20,0x39,
+    0x4d,0x97,0x57,0xcf,0xf3,0xe6,0xfe,0x2c,0x6c,0x53,0x17,0x80,0x4b,0x24,0x58,0x4e,
+    0x13,0x74,0xed,0x91,0x91,0x3b,0x71,0xcd,0x0b,0x47,0xc1,0xab,0x45,0xe0,0x8d,0x95,
+    0x63,0x93,0x52,0x7d,0xd4,0x68,0x0a,0x2b,0x5a,0x4c,0xc1,0xc8,0x6f,0x8f,0x35,0x94,
+    0x71,0x92,0x63,0x49,0x37,0x24,0xd4,0x0a,0x59,0xe3,0x84,0x3d,0x06,0x2e,0xf2,0xc1,
+    0x03,0x9a,0xaa,0x9d,0x26,0x46,0xf5,0x33,0x98,0xf6,0x6d,0x17,0xb9,0x1a,0x37,0x3a,
+    0x8b,0x7d,0xd2,0x6f,0x71,0xbf,0x9a,0x20,0x1c,0x01,0xee,0x5a,0x92,0x50,0xb2,0x0a,
+    0x32,0x94,0x93,0x54,0x25,0x8a,0x6b,0x6d,0xb8,0xe1,0x5e,0x24,0x80,0xaf,0x13,0xfc,
+    0x65,0xee,0x3b,0x14,0x9f,0xe5,0x61,0xd4,0xef,0xbe,0xee,0x5f,0x60,0x07,0xe9,0x3f,
+    0x10,0x0c,0x60,0xce,0x59,0xc6,0x1a,0x49,0xb6,0xd2,0xd1,0x52,0xdc,0x8b,0xb0,0xad,
+    0x0d,0x28,0x13,0x29,0x59,0x11,0xf8,0xf3,0x6a,0x6b,0x6c,0x1d,0x0a,0x91,0x35,0x2d,
+    0x99,0x13,0x1f,0xb0,0x1a,0xd8,0xfa,0xfe,0xa8,0x18,0x5c,0x32,0x49,0xd3,0xd3,0xd3,
+    0x95,0xd5,0xbe,0x00,0x68,0xa9,0x82,0x73,0xfe,0x5f,0x1d,0x84,0xba,0x38,0xb5,0x8c,
+    0x7c,0x95,0xd6,0x63,0xa0,0xda,0xff,0x51,0x2e,0x4d,0x36,0xcf,0x49,0xda,0xc7,0xa3,
+    0x9b,0x45,0x73,0xf0,0xea,0x41,0xac,0xed,0x21,0x8f,0x6d,0x64,0x33,0x57,0xa5,0x4a,
+    0x2a,0x99,0x02,0xa7,0xb1,0x52,0xd5,0x60,0x72,0xe0,0x43,0xd4,0x51,0x77,0xb7,0x92,
+    0x97,0x69,0x00,0x86,0x81,0x93,0xbd,0x23,0x30,0xd0,0x7c,0xeb,0x24,0x81,0x56,0x8a,
+    0xa0,0xae,0x2a,0xc2,0x63,0x2c,0xc8,0x3e,0x1a,0xa5,0x0f,0x5f,0x1d,0x91,0xe3,0x88,
+    0xe4,0xcd,0x9e,0xb0,0x28,0x67,0xf1,0x97,0x0e,0x01,0xb7,0xe0,0xea,0xc4,0xbb,0xa7,
+    0xa0,0xbd,0xec,0xdf,0x20,0x9b,0xcd,0x6f,0x6f,0xf1,0xfc,0x84,0xbb,0xa9,0x8e,0x29,
+    0xcd,0x9a,0x13,0x4a,0xf5,0x3a,0x2d,0xab,0x5a,0x9a,0xb4,0x43,0x1b,0xfb,0xf1,0x38,
+    0xd5,0x89,0x37,0xf1,0xdd,0xef,0xad,0xcf,0x59,0xa7,0x3c,0x3d,0xcf,0xa8,0xb1,0x13,
+    0x95,0x37,0x3a,0x50,0x68,0x7a,0x28,0xab,0xa5,0x92,0x8a,0xee,0x0f,0xa1,0x8e,0xab,
+    0x2d,0x28,0xe3,0x58,0x1b,0xa3,0x81,0x37,0x17,0xf6,0x21,0xf7,0xfa,0x39,0xec,0xb6,
+    0xf2,0x82,0x95,0x4c,0xf1,0x44,0x4c,0x38,0x41,0xca,0xe2,0x5a,0x34,0x5d,0x27,0x1d,
+    0xd9,0x1e,0x69,0x08,0x54,0x74,0xa9,0xea,0xe7,0xa0,0xa2,0xa8,0x06,0x9a,0xca,0x17,
+    0xa9,0x69,0xdd,0xed,0x9d,0xb7,0x1f,0x08,0x43,0x94,0x8e,0xe6,0x15,0x6e,0xfc,0x63,
+    0x5a,0xc6,0x17,0x74,0x19,0xd7,0x5c,0x80,0x63,0xd3,0x46,0xbb,0xd4,0xe0,0x3c,0x6f,
+    0x19,0xb8,0x20,0xdd,0xae,0xcc,0xc6,0x2a,0xbb,0x6d,0x0c,0xc1,0x9a,0x6d,0x08,0x6f,
+    0x8e,0xe1,0x47,0xe3,0x38,0x3e,0xab,0x28,0xf7,0x62,0x45,0x85,0x07,0xc5,0xe9,0x3b,
+    0x68,0xad,0xe4,0xf3,0x8d,0xa3,0x3e,0x01,0x20,0x2c,0xc2,0x79,0x63,0x68,0x48,0xd3,
+    0x51,0x32,0x99,0x85,0xe7,0x5d,0xa7,0x13,0xed,0x73,0xf0,0xa7,0xc9,0xeb,0x82,0x3f,
+    0x6a,0x27,0x2d,0x9d,0x07,0xf0,0x1a,0xa0,0x82,0x36,0xf5,0xec,0xf9,0xcc,0x1e,0x78,
+    0xfd,0x73,0x85,0x9e,0xda,0xc0,0x27,0xec,0x24,0x23,0x93,0x4e,0x46,0xda,0x2e,0xb8,
+    0x06,0xae,0x9b,0x57,0xb1,0x77,0x7a,0x00,0x04,0x8a,0xa7,0xd1,0x11,0xe6,0xe9,0x8b,
+    0x91,0xe9,0x76,0xb8,0xff,0x0c,0x0c,0xa6,0x4f,0x57,0x8b,0xa1,0x19,0x61,0x16,0x43,
+    0x33,0x54,0xa9,0x21,0x00,0x2e,0x09,0xdd,0xa0,0x38,0xc7,0x42,0x2c,0x2d,0xc8,0x0d,
+    0x8c,0x44,0x08,0x75,0xd7,0x54,0x63,0xd2,0x8b,0xe7,0xcb,0xba,0x7f,0x5b,0xab,0x9f,
+    0xae,0xb7,0xde,0xfb,0xf1,0xd8,0x0b,0x17,0x43,0x30,0x78,0xc1,0x54,0xb7,0x46,0xeb,
+    0x78,0xce,0x7a,0xcd,0x1e,0x5a,0xa1,0xb5,0x7a,0x93,0xc0,0xc4,0x83,0xee,0x61,0xac,
+    0xc3,0xf9,0xb3,0xf1,0xe1,0x46,0xc9,0x03,0xe1,0x58,0x69,0x74,0x69,0x0d,0x73,0x35,
+    0xb0,0x59,0x08,0x66,0xc2,0x35,0x4b,0x96,0xd6,0xfd,0x87,0x87,0x8f,0x17,0x70,0xa7,
+    0x99,0xb5,0x5a,0xe8,0x56,0xb8,0xfa,0x04,0x53,0x97,0x1a,0x1e,0x17,0xc3,0xf6,0x79,
+    0xa1,0x2b,0x19,0xc9,0x5d,0x05,0xf3,0xa4,0x4a,0x8a,0x65,0x66,0xcb,0x1a,0x0c,0x2d,
+    0x04,0xc2,0x88,0xc9,0x9a,0xe5,0x90,0xd0,0xa5,0x85,0x15,0x32,0x0b,0x71,0xf2,0x57,
+    0x4d,0x39,0x49,0x10,0xae,0x25,0x8b,0x59,0x51,0x41,0x85,0x98,0x0d,0x6a,0x2b,0x1c,
+    0x75,0x39,0xc4,0x0e,0x8a,0x7b,0x58,0x78,0x04,0x99,0x5c,0x44,0x51,0x99,0x97,0x7b,
+    0x24,0xea,0xf9,0x04,0xc9,0xb7,0xaf,0xff,0x3e,0xff,0xbe,0x08,0x08,0x6a,0x5b,0x7d,
+    0xc0,0x9d,0x67,0x7f,0x47,0xc0,0xda,0x92,0x35,0x47,0x02,0xf1,0x05,0x95,0xd6,0xea,
+    0x01,0xf4,0x88,0xee,0x60,0x02,0x6e,0xdf,0xb6,0xcc,0x2b,0xc6,0x4f,0x05,0x02,0xc5,
+    0x68,0x21,0x9a,0xb4,0x37,0x4a,0x0c,0xfe,0xcc,0x9b,0x84,0xb0,0x75,0x83,0x55,0x59,
+    0xc4,0x80,0x06,0x8e,0x86,0xa9,0x5b,0x1c,0x32,0xd7,0xd9,0xae,0x4a,0xc0,0x5a,0xbd,
+    0x7b,0xb8,0x1f,0xf9,0xce,0xdb,0x37,0x7f,0x20,0x50,0x08,0xd8,0xa2,0x37,0xd0,0x69,
+    0xca,0x04,0x97,0x31,0x41,0x0f,0x7a,0x56,0x5e,0x44,0x7c,0xd5,0x59,0x84,0x6c,0x43,
+    0xba,0x33,0x3d,0xed,0xd3,0xb2,0x26,0x02,0x81,0x52,0x0e,0x15,0x6b,0x8e,0xda,0x5f,
+    0x44,0xcc,0x69,0x25,0x57,0x57,0x34,0xbd,0x81,0xef,0x1e,0x56,0x8a,0x19,0x08,0x98,
+    0x85,0xe2,0xf5,0x80,0x96,0x71,0x5e,0x27,0x44,0xdc,0xf4,0x00,0x3f,0xe3,0xbd,0x7e,
+    0x3f,0x81,0x56,0x5e,0x00,0xe4,0x41,0x46,0xe4,0xbb,0x9c,0xa8,0xdb,0x5f,0x76,0x77,
+    0x89,0x36,0xe8,0xf5,0x07,0xba,0x8c,0x06,0xa6,0x53,0x2c,0x7b,0xfa,0x43,0xda,0x0b,
+    0x55,0x7d,0x99,0x43,0x80,0xb2,0xb6,0xb2,0x86,0xed,0x7f,0x35,0xff,0x01,0x44,0x9d,
+    0x82,0xf4,0xe6,0x0c,0x00,0x00,
+};
+static const WebAsset web_login_html = {
+    "/", "text/html; charset=utf-8", web_login_html_gz, sizeof(web_login_html_gz), 3302,
+    "\"5263aa3428b18d6b\"", false };
+
+// index.html: 85441 bytes, 20219 gzip'd
+static const uint8_t web_index_html_gz[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x7d,0xd9,0x72,0xe3,0x56,
+    0x96,0xe0,0x7b,0x7e,0x05,0x2c,0xdb,0x09,0xd2,0x22,0x29,0x2e,0xda,0x92,0x4c,0x2a,
+    0x5b,0x29,0x29,0x6d,0x75,0x2b,0x97,0x96,0x64,0xbb,0x6b,0xb2,0x33,0x32,0x41,0x00,
+    0xa4,0x60,0x81,0x00,0x0b,0x00,0xb5,0x98,0xc9,0x88,0x7a,0x99,0x25,0x62,0x1e,0x7a,
+    0x22,0xba,0x27,0x6a,0x1e,0xfa,0x79,0x7e,0xa1,0xdf,0xe7,0x53,0xfc,0x25,0x73,0xce,
+    0xb9,0x0b,0x2e,0x56,0x82,0xca,0x74,0x55,0x79,0x3c,0xae,0xb2,0x45,0x00,0xf7,0x9e,
+    0xbb,0x9d,0x7b,0xee,0xd9,0xef,0xd3,0x2f,0x8e,0x5f,0x1f,0x5d,0xfe,0xe1,0xcd,0x89,
+    0x76,0x15,0x4d,0xdd,0x83,0x47,0x4f,0xf1,0x8f,0xe6,0x1a,0xde,0x64,0xb8,0x61,0x7b,
+    0x1b,0xf8,0xc2,0x36,0x2c,0xf8,0x33,0xb5,0x23,0x43,0x33,0xaf,0x8c,0x20,0xb4,0xa3,
+    0xe1,0xc6,0xf7,0x97,0x2f,0x9a,0xfb,0x1b,0xe2,0xb5,0x67,0x4c,0xed,0xe1,0xc6,0x8d,
+    0x63,0xdf,0xce,0xfc,0x20,0xda,0xd0,0x4c,0xdf,0x8b,0x6c,0x0f,0x8a,0xdd,0x3a,0x56,
+    0x74,0x35,0xb4,0xec,0x1b,0xc7,0xb4,0x9b,0xf4,0xd0,0x70,0x3c,0x27,0x72,0x0c,0xb7,
+    0x19,0x9a,0x86,0x6b,0x0f,0x3b,0x08,0x23,0x72,0x22,0xd7,0x3e,0x78,0x61,0x98,0xf6,
+    0xb7,0x73,0x23,0xb0,0xb4,0x37,0x81,0xff,0x74,0x8b,0xbd,0x7c,0xf4,0x34,0x34,0x03,
+    0x67,0x16,0x69,0x61,0x60,0x0e,0x37,0xae,0xa2,0x68,0x16,0xf6,0xb7,0xb6,0x4c,0xcb,
+    0xfb,0x29,0x6c,0x99,0xae,0x3f,0xb7,0xc6,0xae,0x11,0xd8,0x2d,0xd3,0x9f,0x6e,0x19,
+    0x3f,0x19,0x77,0x5b,0xae,0x33,0x0a,0xb7,0x8e,0xa0,0x97,0x51,0xeb,0xa7,0x70,0x6b,
+    0xbb,0xb5,0xdd,0xea,0x6c,0x99,0xf4,0x38,0x9f,0x5a,0xad,0xa9,0xe3,0xc1,0xeb,0x8d,
+    0x83,0xa7,0x5b,0x0c,0x2a,0x82,0x8f,0xee,0xb1,0x99,0x7e,0xe0,0xfb,0xd1,0xa2,0xd9,
+    0x1c,0x4d,0xfa,0x5f,0xb6,0xf7,0xdb,0x66,0xa7,0x3b,0xc0,0x87,0x2e,0x3c,0x59,0x9d,
+    0x9d,0x6e,0x1b,0x9e,0x4c,0xe8,0x5a,0xff,0xcb,0x4e,0xa7,0xb3,0xdf,0xdd,0xc3,0x8f,
+    0x7e,0x60,0xd9,0x01,0xbc,0xb0,0x7b,0xed,0x9d,0xf6,0xe0,0x11,0x14,0xb8,0x37,0x3c,
+    0x28,0xdf,0xb6,0x77,0xc6,0x63,0x2c,0x6f,0x39,0xd3,0x7e,0x30,0x19,0x19,0xb5,0x76,
+    0xa3,0xdb,0x7d,0xd2,0xe8,0xee,0xec,0x34,0xda,0xad,0x4e,0xb7,0x0e,0xdf,0x8c,0xe9,
+    0x08,0xeb,0x8e,0xc7,0xa3,0xbd,0x36,0xc2,0x36,0x64,0x59,0x2c,0xd5,0xd9,0xef,0x35,
+    0xda,0x58,0x76,0xa7,0x8e,0x70,0x27,0x81,0x6d,0x33,0xc0,0xbb,0x7b,0xbb,0x50,0x78,
+    0xa2,0x02,0xee,0xb5,0x1b,0xd0,0x23,0x5e,0xb8,0xd9,0x0c,0x6c,0x0b,0xc1,0xf6,0xac,
+    0x1d,0xec,0x63,0x90,0x00,0xbb,0xdb,0x69,0xec,0xef,0xc5,0x60,0xa3,0x4e,0xff,0x4b,
+    0x7b,0x7f,0xbc,0x3d,0xde,0x87,0x92,0x11,0x8c,0x74,0x6f,0xff,0xc9,0x13,0x83,0x1e,
+    0x7a,0xfd,0x2f,0x01,0x82,0xb1,0x3b,0x82,0x87,0xf1,0x6d,0x7f,0xb7,0xdd,0x5e,0x3e,
+    0xfa,0x66,0x31,0xf2,0xef,0x9a,0xa1,0xf3,0xb3,0xe3,0x4d,0xfa,0x6c,0xf0,0x30,0x07,
+    0x77,0x83,0xa9,0x11,0x4c,0x1c,0xaf,0xdf,0x1e,0xcc,0x0c,0xcb,0xc2,0x6f,0x50,0x76,
+    0xe4,0x5b,0xf7,0x8b,0x31,0x20,0x41,0x73,0x6c,0x4c,0x1d,0xf7,0xbe,0xaf,0x5f,0xd8,
+    0x13,0xdf,0xd6,0xbe,0x3f,0xd5,0x1b,0xe1,0x7d,0x18,0xd9,0xd3,0xe6,0xdc,0x69,0x84,
+    0x86,0x17,0x36,0x43,0x3b,0x70,0xc6,0x83,0x91,0x61,0x5e,0x4f,0x02,0x7f,0xee,0x59,
+    0xfd,0x1b,0x23,0xa8,0xe1,0xd4,0xd7,0x07,0xa6,0xef,0xfa,0x01,0x7f,0x8e,0x3a,0xf5,
+    0x01,0xac,0x5e,0xf3,0xca,0x76,0x26,0x57,0x51,0xbf,0xd3,0x6e,0xdf,0x5c,0x0d,0x2c,
+    0x27,0x9c,0xb9,0xc6,0x7d,0x7f,0xec,0xda,0x77,0xac,0xd1,0x7e,0x7f,0x64,0x8f,0xfd,
+    0xc0,0x5e,0x70,0x0c,0xec,0xeb,0xfa,0x60,0xe6,0x87,0x80,0x71,0xbe,0xd7,0x1f,0x3b,
+    0x77,0xb6,0x35,0x70,0x3c,0x40,0x60,0xe8,0x6e,0xdc,0x64,0xd3,0x99,0x1a,0x13,0xbb,
+    0xef,0x3a,0x9e,0x6d,0x04,0x30,0xdb,0xb0,0x18,0x50,0xb5,0x96,0x5a,0xba,0x56,0xbb,
+    0xbb,0x53,0xd7,0x3a,0xb3,0xbb,0x46,0x14,0x40,0xc7,0x67,0x80,0x76,0x5e,0x84,0xcf,
+    0xf5,0x46,0xba,0xe6,0x93,0xb6,0x65,0x4f,0x1a,0x95,0xeb,0xab,0x5d,0x81,0xf9,0xb5,
+    0xfb,0xdb,0xed,0xd9,0x9d,0x86,0xff,0x81,0xbe,0x3b,0x30,0x8e,0xa0,0x69,0xdf,0x40,
+    0xe1,0xb0,0xef,0xf9,0x9e,0x3d,0xf8,0xb9,0xe9,0x78,0x96,0x7d,0x87,0xf3,0xbc,0xf5,
+    0x8d,0xf6,0xcb,0xbf,0xfd,0x49,0xbb,0x38,0x3d,0x3e,0x79,0x7e,0x78,0x4e,0xbf,0xbf,
+    0xd9,0x7a,0xd4,0x0a,0x47,0x0b,0xda,0x6b,0xfd,0x2e,0x01,0xc9,0xcc,0x5b,0xce,0x6c,
+    0x03,0x56,0xf2,0x35,0x0d,0x58,0x41,0xe8,0x41,0xe8,0xbb,0x8e,0xa5,0xf1,0x12,0xf4,
+    0xb1,0x9e,0x98,0xf2,0x01,0xfe,0xa7,0x69,0x39,0x81,0x6d,0xd2,0xfc,0xc2,0x7a,0xcd,
+    0xa7,0x5e,0x7a,0xbe,0x5d,0x7b,0x8c,0xd3,0x1d,0xf9,0x33,0x9c,0x74,0x3f,0x8a,0xfc,
+    0x29,0xfc,0x10,0x83,0x80,0x0e,0x0d,0xfc,0x1b,0x3b,0x18,0xbb,0xfe,0x6d,0xf3,0xbe,
+    0x6f,0xcc,0x23,0x7f,0x89,0x03,0x68,0xba,0xfe,0xc4,0x5f,0x08,0x94,0xea,0xe2,0x30,
+    0x24,0xce,0x11,0x88,0x4a,0x1d,0x34,0x5c,0x67,0xe2,0x35,0x1d,0xc0,0xb7,0xb0,0x6f,
+    0xda,0x38,0x93,0x83,0x89,0x31,0x83,0x46,0x67,0x77,0xac,0x15,0x07,0xf0,0x84,0xcf,
+    0x55,0x6f,0x17,0xda,0xe0,0xd3,0x44,0xbf,0x33,0xb3,0x84,0xfb,0x3b,0x9e,0x26,0x58,
+    0xeb,0x79,0xd8,0xdf,0x87,0x82,0xab,0x9a,0xfc,0x69,0x1e,0x46,0xce,0xf8,0xbe,0x29,
+    0x70,0x92,0xbf,0xa6,0xfd,0x41,0xeb,0xdd,0xd9,0xa7,0xe1,0xc1,0xee,0xba,0x32,0x2c,
+    0xff,0xb6,0xdf,0xd6,0xda,0x5a,0x07,0xba,0xc0,0x87,0x86,0x84,0xa4,0xce,0x26,0x3b,
+    0xbc,0x0a,0x1c,0xef,0x1a,0x97,0x1e,0x7b,0x4f,0x24,0x92,0xed,0xb3,0x5b,0xd6,0x71,
+    0xa4,0x26,0x0a,0xdc,0x6d,0x80,0xeb,0xda,0x11,0x62,0x10,0x20,0x9c,0x89,0x53,0xd9,
+    0xda,0x11,0x63,0x0f,0xe7,0xa3,0x85,0x52,0x16,0xa7,0x58,0xdd,0x71,0x6c,0xb4,0xa9,
+    0xda,0x5d,0x28,0x14,0xd9,0x77,0x51,0x93,0x70,0x18,0x76,0xda,0xb4,0x3f,0x9f,0xcd,
+    0xec,0xc0,0x34,0x42,0x9b,0x43,0xb5,0x4d,0xb9,0x6c,0x34,0x86,0x0e,0x21,0xb3,0x6c,
+    0xd4,0x36,0xd5,0x6e,0x53,0xd3,0x4f,0xb2,0xbd,0xec,0x95,0xb4,0x93,0xa4,0x0b,0xbd,
+    0x7a,0x4c,0x78,0x34,0x9c,0x47,0x46,0x8f,0x04,0x9a,0xb0,0x86,0x3d,0xe3,0x66,0x51,
+    0x15,0x31,0x24,0xb8,0x27,0xbc,0xf3,0xa9,0x15,0xdf,0xc3,0x79,0x9a,0x07,0x21,0x74,
+    0x81,0xef,0x4e,0x75,0xc6,0xb1,0xe3,0xea,0x82,0xec,0xc0,0x82,0x24,0xfa,0x0b,0x1b,
+    0x2d,0xd9,0xc3,0xae,0x6c,0x41,0xc1,0x69,0x85,0x44,0x0c,0xe8,0x37,0xdb,0x51,0x86,
+    0xeb,0x6a,0xad,0xce,0x7e,0xc8,0xe6,0xc6,0xb2,0x4d,0x3f,0x30,0xe8,0x03,0x12,0x06,
+    0x36,0xce,0xfe,0x15,0x6e,0xa7,0x45,0x16,0x79,0xe1,0xf4,0xca,0x92,0x54,0x3e,0x34,
+    0xf5,0x35,0xdf,0x48,0x0c,0x5a,0xcb,0x80,0xad,0x7d,0x63,0xe7,0x80,0x23,0x9c,0xcc,
+    0xe2,0x4b,0x02,0x60,0x9a,0x02,0xc2,0xd8,0x25,0x71,0x08,0x6c,0xd7,0x40,0xd0,0x89,
+    0x76,0x4a,0xc9,0xb7,0x31,0x82,0xb9,0x99,0x47,0xb6,0x4a,0x51,0x7a,0xed,0xaf,0x07,
+    0x7c,0xfb,0xc6,0xbb,0x77,0x1b,0x5e,0x56,0xda,0xbc,0x6d,0x0d,0x6a,0xd1,0xbf,0xed,
+    0xf4,0xf6,0x53,0x76,0x1f,0x56,0x64,0xbd,0x44,0x72,0xc1,0xa9,0x05,0x6d,0x59,0x5a,
+    0x05,0x42,0xa5,0x9c,0x3d,0xbd,0x33,0xbb,0xcb,0xdb,0xb3,0x63,0xe0,0x33,0x60,0x7d,
+    0x38,0x0e,0xe0,0x18,0x90,0xe6,0x49,0xa4,0xc3,0x2d,0x9b,0xc0,0x3a,0x2c,0x51,0x40,
+    0xeb,0x10,0xe0,0x7d,0xd8,0x04,0xf2,0xee,0x14,0xad,0x77,0x06,0xb1,0x92,0xc4,0x32,
+    0x4b,0xcb,0x64,0x3f,0x38,0x89,0x0c,0xfc,0xdb,0x32,0x22,0x81,0xe8,0xbc,0x6a,0x63,
+    0x25,0xd1,0xbd,0x47,0x70,0x2d,0x60,0xb6,0x44,0x3d,0xc7,0xc3,0xf3,0xb3,0x39,0x72,
+    0x7d,0xf3,0x9a,0x2f,0xa6,0x42,0x8a,0x77,0x33,0x1b,0x70,0x07,0x96,0x97,0xc3,0x0c,
+    0x64,0x11,0xc3,0x83,0x43,0x9c,0xd0,0x64,0x04,0xd0,0xae,0xb5,0x6e,0xa8,0x39,0xde,
+    0x18,0x79,0x4d,0x9b,0x35,0xd7,0x9a,0x64,0xe7,0x88,0x18,0xab,0x7a,0x7a,0xe9,0x77,
+    0xe4,0xd2,0xb3,0xef,0xbc,0xbe,0x91,0xad,0x4f,0x5c,0x5c,0x49,0x7d,0xf6,0x9d,0xd7,
+    0xcf,0xd9,0x93,0xc0,0xac,0x95,0xd4,0xc6,0xaf,0xcb,0x47,0x7f,0x77,0x6d,0xdf,0x8f,
+    0x03,0xe0,0xaf,0x43,0x8d,0x46,0xb6,0x68,0x7f,0xdd,0x80,0x43,0xf3,0xeb,0x85,0x8f,
+    0xa4,0x32,0xba,0xef,0x77,0x96,0x3b,0xca,0x53,0x6b,0x7b,0x29,0xd9,0x82,0x97,0x87,
+    0xa7,0xaf,0x24,0x4f,0x30,0x35,0x1c,0x4f,0x60,0x1d,0x6d,0x20,0xc6,0x1b,0xe0,0xa2,
+    0xf5,0x3b,0xd9,0x6d,0x19,0x1f,0xd0,0xd0,0x7d,0xc0,0xc1,0x91,0x11,0x2c,0xf8,0x8a,
+    0xec,0xa4,0x0e,0x47,0xda,0xe5,0x9d,0x5e,0xa3,0xdb,0x69,0xf4,0xba,0x8d,0xd6,0x93,
+    0x1d,0xc6,0xd0,0x58,0x81,0x3f,0x6b,0x8e,0x1d,0x17,0x50,0x00,0xd6,0x64,0x1e,0xd4,
+    0xf6,0x89,0xd5,0xf9,0x2c,0x87,0x78,0x4c,0xf1,0x89,0x33,0x20,0xd2,0xbd,0x4d,0xec,
+    0x12,0x1f,0x06,0x1c,0xb8,0xe6,0xf5,0x3d,0x67,0x3a,0xc4,0x50,0x76,0x70,0x0b,0x46,
+    0xa3,0xcc,0xf9,0xc3,0xb6,0xaa,0x42,0xb4,0x77,0xf1,0x14,0x75,0xc5,0xe0,0x47,0x4d,
+    0x13,0x51,0x33,0xc1,0xcf,0x4e,0x7d,0xcf,0xc7,0xb3,0xca,0x56,0x77,0x7c,0x37,0xef,
+    0x04,0x65,0x10,0xe6,0xc0,0xe6,0x56,0x3a,0x81,0xf6,0x73,0x19,0x8f,0xf5,0xf7,0xf2,
+    0x9e,0xb2,0x97,0x77,0x04,0x49,0x29,0x3e,0xb6,0xba,0xd9,0x7d,0x0d,0x1d,0x87,0x53,
+    0x93,0xf3,0x91,0xca,0x86,0xec,0xe6,0xec,0xc8,0x64,0xa7,0xd3,0xec,0x70,0xa7,0xb7,
+    0x83,0xfc,0xb0,0x32,0x29,0x8d,0x2f,0xf7,0xcc,0x6d,0x6b,0x3c,0xae,0x7f,0x06,0xde,
+    0xa9,0x93,0x5a,0xbc,0xbd,0xd4,0x89,0x0b,0x92,0x04,0x0c,0x85,0xd7,0x4f,0x72,0x94,
+    0x0a,0x63,0x0c,0xc2,0xa8,0x59,0x23,0xee,0x58,0x6b,0x6a,0x88,0xe1,0x75,0xb9,0x8d,
+    0x8e,0x0e,0xcf,0x8f,0x2f,0xe4,0x3e,0xc2,0xb5,0xf8,0x2c,0xd4,0x36,0xc1,0x6b,0xd0,
+    0x71,0x92,0xdd,0x84,0x82,0x33,0xee,0x5f,0x39,0x96,0x65,0x7b,0x2a,0x2b,0xa0,0x1e,
+    0xb4,0xc4,0x13,0x2c,0x59,0xdf,0xc4,0xf9,0x5f,0x76,0x0e,0x83,0x00,0x28,0x4a,0x57,
+    0x3a,0x70,0xd9,0x36,0xe2,0xc7,0x2e,0xa3,0xb9,0x6d,0x81,0x0e,0x9d,0xf2,0xb5,0x67,
+    0xa2,0x90,0xc2,0xce,0x34,0x14,0xfe,0x41,0x7d,0x2f,0x7a,0x94,0xdd,0x9d,0xed,0x2c,
+    0x7b,0xd8,0xad,0xcc,0x1e,0x66,0xd8,0x2d,0x42,0xf5,0x8a,0x3b,0x51,0x74,0x09,0x07,
+    0xb5,0xe0,0x94,0x32,0x7f,0xd8,0xa9,0x73,0x59,0xc8,0x65,0x97,0x87,0x97,0x29,0xf4,
+    0x09,0x23,0x23,0x0a,0x61,0x7a,0x1c,0x4b,0x92,0x03,0x7c,0x18,0xe0,0x7f,0x9a,0xd0,
+    0x05,0x78,0x13,0xd9,0x4d,0x26,0x49,0x85,0x80,0x08,0x33,0xdb,0x88,0x6a,0xdb,0x8d,
+    0xce,0x18,0xf0,0x47,0x92,0xb9,0x14,0x03,0xc9,0x8f,0x6a,0xf3,0x6f,0x01,0x2d,0x89,
+    0x43,0xed,0x86,0x82,0xd4,0x58,0xf6,0xd8,0x98,0xbb,0x11,0x75,0x8f,0x63,0x66,0xbc,
+    0x64,0xf4,0x0b,0xc7,0xfb,0x87,0x5a,0xb3,0xcb,0x0e,0x07,0xe5,0x28,0x44,0x0e,0x0c,
+    0x87,0xa6,0x71,0xec,0xc5,0xff,0xb5,0xb6,0x89,0xe9,0x31,0x5b,0xe6,0x42,0x61,0x8f,
+    0xba,0xa9,0x81,0x31,0xba,0x8b,0xc5,0x26,0x65,0xc5,0xf8,0xe9,0x8e,0xe5,0x82,0xb2,
+    0x72,0x74,0x0e,0x63,0x29,0xa3,0xac,0x94,0x3c,0xeb,0x43,0xb3,0x39,0x81,0xb9,0x59,
+    0x64,0xb7,0x11,0xdb,0x39,0x4d,0x9a,0x61,0x04,0xc1,0x7e,0x31,0x0a,0xbb,0xd7,0x8e,
+    0x29,0xec,0x5e,0x3b,0x97,0xe7,0x51,0xcf,0x52,0x5c,0x18,0x31,0x15,0x9a,0x6c,0x32,
+    0x9f,0x4b,0x67,0x33,0x51,0x52,0x6a,0x22,0x4b,0x05,0x25,0xa5,0x02,0x59,0xca,0x28,
+    0x29,0x65,0x50,0x29,0x9a,0x05,0xd7,0x18,0xd9,0xee,0x8a,0x8d,0xdc,0x41,0x71,0xf4,
+    0xa1,0x5b,0x79,0x97,0xe3,0x7d,0xf3,0xc6,0x50,0xdb,0xe9,0x75,0x73,0x4e,0x04,0x62,
+    0x31,0xc5,0xde,0xcd,0x95,0x11,0xe5,0x54,0x22,0xb4,0xec,0x31,0x1e,0x4f,0x62,0xfa,
+    0xbb,0x8a,0x47,0xb9,0x05,0x62,0x04,0xca,0xfd,0xac,0x62,0x4e,0x4a,0x26,0xef,0xe4,
+    0x1e,0xcb,0x50,0x0e,0x05,0x91,0x22,0x04,0x23,0x12,0xa1,0x52,0xbb,0x18,0x60,0x17,
+    0x3f,0x49,0x56,0xb1,0xd3,0x95,0x94,0xea,0xdb,0xf3,0xd3,0x63,0x49,0xa3,0x26,0xdd,
+    0x2a,0xb4,0x09,0x48,0x92,0x06,0xff,0x4a,0xaa,0xb4,0x6c,0x4d,0x7a,0x6b,0xd4,0x4b,
+    0xd6,0x85,0x46,0x7b,0x9d,0x2a,0xb5,0xbb,0x99,0x56,0xa7,0xa3,0x45,0x8a,0xc2,0x13,
+    0x40,0x3e,0xb0,0xcb,0xc3,0xe7,0x67,0x27,0x72,0x64,0xd1,0xed,0x42,0x2a,0x9b,0xee,
+    0xb8,0xb2,0x29,0x32,0x46,0x70,0xde,0x70,0xa9,0xae,0x8d,0xa2,0xa3,0x3c,0x3a,0x5d,
+    0x63,0x16,0xda,0x7d,0xf1,0x23,0xcd,0x2f,0xe5,0xf2,0x83,0x00,0x0f,0xf5,0xe5,0x5a,
+    0x74,0xb5,0x50,0xa4,0x43,0x3c,0x3a,0x25,0x51,0xdd,0x47,0x76,0x2c,0xb9,0x2e,0x4f,
+    0x3e,0xe5,0x88,0xeb,0x55,0xe5,0xaa,0x6f,0xaf,0xe0,0x90,0xa3,0x06,0xec,0xbe,0xe7,
+    0xdf,0x06,0xc6,0x0c,0x7a,0x8b,0x5a,0x53,0x2d,0x92,0x04,0x30,0x03,0x82,0xa8,0x6f,
+    0xaf,0xdd,0xd8,0xde,0x6f,0xec,0x13,0x01,0x4e,0x30,0x21,0x72,0xfb,0x03,0x0b,0x12,
+    0x53,0x7d,0xce,0x60,0xc6,0xd0,0xb3,0x4a,0x09,0xa6,0x94,0xee,0xa2,0xc4,0xb0,0xd3,
+    0x69,0xb4,0x76,0xeb,0xb2,0xb0,0xb5,0x50,0x65,0x50,0xad,0x80,0x35,0x8d,0xac,0xe6,
+    0x6c,0x91,0xd2,0x66,0x7c,0xe1,0x4c,0xd1,0xfc,0x60,0x78,0x51,0x5a,0x05,0x23,0xd1,
+    0xe1,0xf9,0xe1,0xf1,0xb7,0x31,0x3a,0x8c,0x0c,0x6b,0x62,0xa7,0xe5,0xd0,0x32,0x9e,
+    0xa0,0xa7,0x9c,0x8d,0x78,0x00,0xec,0x67,0x08,0x75,0x2f,0xb1,0xae,0x44,0xf2,0x32,
+    0x92,0x45,0x3e,0xde,0xb4,0x46,0xb3,0x02,0xd2,0x3c,0xc8,0x52,0x9b,0xec,0x99,0x9e,
+    0xb2,0x07,0xb4,0x68,0x96,0x46,0x46,0x01,0x1d,0x1f,0xa4,0xe9,0x53,0x01,0xc0,0xd8,
+    0x6c,0xc0,0x01,0xba,0x05,0x24,0x7f,0x90,0xa5,0x68,0x25,0x20,0x99,0x81,0x83,0x83,
+    0xb4,0x33,0x78,0xd1,0xe9,0x6e,0x37,0xf6,0xf6,0x24,0xaf,0xca,0x61,0x7f,0xf9,0xc4,
+    0xdc,0x05,0x99,0xa1,0x00,0xac,0x5a,0xa7,0x47,0x70,0xc3,0x28,0x03,0xb8,0xd7,0x6b,
+    0x74,0x76,0x60,0x92,0xb6,0x7b,0x09,0xc0,0xdb,0x5d,0x63,0x67,0xbc,0x53,0x00,0x58,
+    0xad,0xd3,0xdd,0x61,0x90,0xc3,0xf2,0x95,0xfa,0x72,0x77,0x77,0x34,0xda,0x35,0x0a,
+    0x00,0xee,0xed,0x36,0x3a,0x7b,0x3b,0xb4,0x9b,0x04,0x3c,0x63,0x5d,0x05,0x5b,0xce,
+    0xc2,0xc7,0x4a,0xb6,0x18,0xdb,0x2f,0x5f,0xc5,0x9c,0xe7,0x28,0xf2,0xd6,0x41,0xf5,
+    0x5d,0x05,0xd5,0x89,0x62,0x65,0xc5,0xbe,0xdd,0x24,0xae,0x77,0x73,0x70,0x3d,0x25,
+    0x71,0xe6,0xa9,0x32,0xf9,0x80,0xc8,0xb4,0x91,0x47,0xa1,0xb0,0xe3,0xcd,0x9c,0xad,
+    0xc1,0xa6,0x23,0x25,0xe9,0xe5,0x6a,0xd1,0x33,0xe2,0xcf,0x7e,0x5d,0x80,0xcd,0x12,
+    0xa6,0x2f,0xdb,0xed,0xd1,0xb6,0x69,0xa6,0x01,0xe1,0xc9,0x99,0x01,0xd4,0xe3,0xc4,
+    0x30,0xc3,0xcd,0x76,0x18,0x77,0x86,0x4d,0x4c,0x2a,0xa9,0x62,0xbb,0xab,0xb8,0x74,
+    0x01,0x8d,0x77,0xb8,0x54,0x8f,0x9b,0xc1,0x88,0x1d,0x51,0xdd,0xfa,0x8c,0xe4,0x20,
+    0x06,0x5a,0x44,0xdd,0xf3,0x0a,0x1b,0x9f,0x95,0x7e,0xc4,0x60,0x4b,0xfa,0x90,0x29,
+    0x1c,0x4e,0x17,0x19,0xd5,0x48,0x92,0xe9,0x5a,0x52,0xb9,0xbb,0x50,0x96,0x43,0x1d,
+    0xf1,0x5e,0x86,0xb4,0x8b,0x45,0x81,0x06,0x67,0x49,0xed,0x0e,0xee,0xa0,0x3d,0xa1,
+    0x00,0x46,0x3c,0xee,0xe3,0x7f,0x72,0xf6,0x9a,0xdc,0xab,0xa7,0xaf,0xde,0x7c,0x7f,
+    0x19,0xef,0xd6,0xf1,0x24,0x97,0xab,0x61,0x3c,0xb5,0x68,0x8a,0xa9,0x4c,0x4b,0xd9,
+    0x88,0x4f,0x62,0xb0,0xc9,0x54,0xe4,0x78,0xb3,0x79,0xf4,0x36,0xba,0x9f,0xd9,0x43,
+    0x04,0xf3,0xae,0xa1,0xbc,0xb0,0xa7,0x86,0xe3,0x26,0xde,0xcc,0x8c,0x30,0xbc,0x85,
+    0x75,0x4b,0xbc,0xf4,0xe6,0xb8,0xa0,0x89,0x57,0x91,0x33,0xb5,0x13,0x2f,0x2c,0xd8,
+    0x39,0xef,0x1a,0xa1,0xed,0xda,0x66,0xd4,0xc0,0x86,0x8c,0xc0,0x36,0x12,0x6c,0x59,
+    0x89,0xd1,0xb2,0xa2,0x6c,0xbb,0x9b,0xb6,0xee,0x74,0xb3,0x14,0x2c,0xbd,0xb3,0xfc,
+    0x79,0x84,0xb4,0x92,0xd1,0xa7,0x32,0xfd,0x4b,0x23,0xa6,0x18,0x8c,0xb0,0x19,0x30,
+    0xcb,0x06,0x54,0x30,0x79,0xe5,0x82,0x73,0x9f,0xe6,0xa0,0x3f,0xf6,0xcd,0x79,0xc8,
+    0x87,0xcf,0x1f,0xc4,0x24,0xb0,0xc7,0x45,0x8e,0xa9,0x46,0x9c,0x08,0x09,0x4a,0x05,
+    0xb4,0x2a,0x87,0x54,0xb5,0xf7,0x00,0xfb,0x19,0x78,0xcd,0x9f,0xe1,0x08,0x16,0xb9,
+    0x13,0xca,0xcd,0xa2,0xde,0x6c,0x91,0xb5,0xd4,0xf0,0x2f,0x1a,0xf5,0x58,0x6c,0x0d,
+    0xa6,0x4c,0x46,0x99,0x6b,0xc9,0x0d,0xaa,0x8b,0x02,0x8b,0x8d,0x94,0x7b,0x51,0x98,
+    0xcd,0xa7,0x9b,0xf0,0xa5,0x9e,0x61,0x6e,0x53,0xd6,0xb5,0x1c,0x93,0x38,0x8a,0x0f,
+    0x20,0x2d,0xac,0x2f,0xb6,0x74,0x99,0xe8,0x01,0x05,0x1f,0x26,0xba,0x74,0x55,0x49,
+    0xe3,0xf5,0xb7,0xdf,0xaa,0xa2,0xc6,0xc4,0xa5,0x8d,0x5f,0xdd,0xee,0x98,0xda,0xef,
+    0x8c,0xbe,0x00,0x18,0xbe,0x09,0xb6,0x15,0x0d,0x01,0xb3,0x87,0x17,0xa8,0x9f,0x72,
+    0x15,0x3a,0x19,0x1d,0x4e,0xf1,0xc9,0xac,0x32,0xf5,0xdd,0xe4,0xf9,0x9c,0xb6,0x67,
+    0x41,0xef,0x5a,0x79,0x98,0xc4,0x45,0x66,0xf8,0xdc,0xef,0x1b,0xe3,0x88,0x0e,0xac,
+    0x12,0xfd,0x22,0xdf,0xe5,0xdb,0xf1,0x00,0x99,0x0c,0x1b,0x83,0x25,0xc6,0x20,0x47,
+    0x27,0x42,0x36,0x40,0xa2,0x7a,0x88,0x84,0x88,0x5f,0xf1,0x38,0x24,0x8a,0xe1,0x30,
+    0x64,0x67,0x45,0x87,0x72,0x10,0xf0,0x9f,0x6a,0x38,0xaf,0xf5,0x04,0xc9,0x83,0x6f,
+    0x13,0xfb,0xdd,0x02,0x78,0x9a,0xd1,0xb5,0x03,0xe2,0x5c,0x6a,0x4f,0x17,0xae,0x81,
+    0x70,0x24,0xc8,0x30,0x4d,0x5d,0x85,0x06,0xb5,0x73,0x9a,0xea,0xf7,0x45,0x5b,0x21,
+    0x90,0x33,0x54,0x36,0x5d,0x01,0xf5,0x2c,0xec,0xc0,0xea,0xa9,0x2b,0x36,0x7f,0xe2,
+    0x04,0xa6,0xd0,0x60,0x95,0x15,0x94,0xe3,0xfa,0x8b,0xd3,0xb3,0xcb,0x93,0x73,0x4d,
+    0xf5,0x39,0x19,0xa3,0x85,0xe8,0x33,0xd0,0xe8,0x84,0x11,0x12,0x29,0x19,0x8d,0x27,
+    0x73,0xb8,0xee,0x97,0x1f,0xae,0xf4,0xc9,0xf6,0xac,0x41,0xde,0x21,0x4a,0x7d,0xd5,
+    0xe2,0x23,0xb6,0x2f,0xac,0x3d,0x64,0x10,0xe0,0x33,0xca,0xf6,0x9f,0x50,0xe4,0x9e,
+    0x1c,0x5d,0x9e,0xbe,0x8e,0x8d,0x69,0xe8,0xe4,0x20,0xba,0x44,0x04,0x08,0xdf,0x08,
+    0x5b,0x79,0xe2,0x74,0x5e,0x52,0xe1,0xe6,0x95,0xb5,0xda,0xfc,0x93,0x36,0x75,0xd0,
+    0xf9,0xd0,0x1c,0xd9,0xd1,0x2d,0x48,0x7c,0x39,0x3a,0xdf,0xf4,0xf8,0x55,0xcf,0x96,
+    0x1c,0x2f,0x8b,0x6e,0x3b,0x4f,0x2d,0x96,0xef,0x1c,0x22,0xaa,0x6b,0xf0,0xc1,0x2b,
+    0x53,0x48,0x31,0xb4,0x52,0xa1,0x6e,0x03,0xd4,0x24,0x7f,0xb2,0x8e,0x62,0x23,0xeb,
+    0x1a,0x21,0xb5,0x55,0x7b,0x72,0x35,0xce,0x5e,0x7f,0xab,0x9d,0x9d,0x5e,0x5c,0xca,
+    0xe5,0x70,0x7d,0x38,0x86,0x1c,0x90,0xf7,0xa6,0xc6,0x9d,0x50,0xf2,0x75,0xf7,0x71,
+    0xbc,0x59,0xd7,0x22,0x2c,0x8b,0xd3,0xfe,0x30,0x7f,0x90,0xf6,0xa0,0xa2,0x9e,0xa4,
+    0x07,0xd2,0x65,0x6c,0x93,0x86,0x46,0x4f,0x3d,0xad,0xd5,0x0b,0x35,0x9b,0x1c,0x65,
+    0x14,0xa3,0x2e,0x7d,0x5a,0x8c,0x03,0x7f,0x2a,0x6d,0xb8,0xed,0x41,0x2e,0x71,0x6a,
+    0x92,0x55,0x2a,0xf2,0x63,0xcb,0xaf,0x52,0x8e,0xb0,0x90,0x0f,0x4f,0x9a,0xed,0x48,
+    0x13,0x2a,0x28,0x51,0x37,0xd7,0x93,0xe5,0x41,0x3b,0xf6,0xd3,0x8d,0x76,0xdd,0x15,
+    0x46,0x3b,0x8e,0x57,0xa9,0xe3,0x06,0x07,0x87,0xae,0xa6,0x8b,0x75,0x1c,0x6e,0x3a,
+    0x70,0x10,0x61,0x45,0xcb,0x9e,0x45,0xa5,0xae,0x0c,0xa4,0x35,0xc0,0x92,0xc8,0x9b,
+    0x26,0x4c,0xe5,0xe4,0xa1,0xa1,0xa8,0xf3,0x48,0xcf,0x9a,0x6b,0x83,0xcc,0x98,0x87,
+    0xd3,0x0c,0x76,0xde,0x90,0x60,0x9a,0xc6,0x2b,0x3d,0xb1,0x62,0x73,0xe4,0x77,0x87,
+    0xe7,0x97,0xda,0x8f,0xe7,0x87,0x6f,0x62,0x9b,0xe4,0x55,0x96,0x5b,0x8b,0x59,0x05,
+    0x95,0x90,0x7d,0x7f,0x01,0x64,0x1b,0x2d,0x52,0x49,0x8d,0xef,0x7c,0xb2,0x86,0x35,
+    0x0a,0x67,0x03,0x0d,0xfb,0x6e,0x03,0xc8,0x25,0xec,0xb8,0x5a,0xe7,0x09,0x34,0x41,
+    0x26,0xaa,0xba,0xca,0x56,0xcd,0xcd,0xcf,0x71,0x1e,0x3c,0x51,0xcf,0x83,0xed,0xe4,
+    0x09,0x9f,0x32,0x36,0x89,0x43,0x2c,0xcf,0xc7,0x68,0x6e,0x56,0x31,0x8c,0x76,0x8b,
+    0x04,0xfa,0x8a,0xe6,0x29,0x42,0xa1,0xb9,0x19,0xef,0xc0,0x6d,0xc5,0x70,0xbe,0x9d,
+    0xd5,0xa0,0x3c,0xc9,0x3d,0xaa,0x49,0x1e,0xfe,0xd5,0xb7,0xe0,0x6e,0xa5,0x2d,0x98,
+    0x24,0xc8,0xfb,0x7c,0x61,0x57,0xee,0xc2,0xdd,0xec,0x2e,0xcc,0xd2,0xf6,0x25,0x42,
+    0x72,0xac,0x15,0x9b,0x32,0x6b,0xf4,0x29,0xd4,0xa0,0xe2,0xcc,0x9b,0x51,0x98,0x15,
+    0xc5,0x77,0x62,0xf6,0x1a,0x39,0xc6,0x7d,0xe5,0x5c,0x69,0xab,0x08,0xc5,0x5f,0x72,
+    0x86,0x51,0xe0,0x8c,0x26,0x01,0xc7,0x3e,0x37,0xb1,0x73,0xc0,0x4b,0xed,0xcd,0xf9,
+    0xc9,0x0f,0xa7,0x27,0x3f,0x2a,0x2e,0x02,0x53,0xf4,0x8c,0x56,0x85,0x57,0x23,0x9c,
+    0x81,0xe4,0xd5,0x24,0x6f,0xbd,0xfe,0xf6,0x56,0x6f,0x90,0xd4,0x38,0xb5,0xf3,0x28,
+    0x73,0x39,0x02,0xac,0xb6,0xca,0xe6,0xca,0x13,0xbc,0x6f,0x9a,0x33,0x9d,0x34,0xe4,
+    0xc3,0x0d,0x30,0x9a,0x7e,0xfc,0x68,0x1a,0xde,0x8d,0x11,0xaa,0xdd,0x8f,0xbd,0x87,
+    0xbf,0x1e,0xf8,0xa3,0x9f,0x70,0x28,0x63,0x07,0x90,0x0a,0x9b,0x1c,0xa4,0xf9,0x1d,
+    0x04,0xe3,0x22,0x23,0x94,0xef,0x48,0xb0,0x2f,0xd8,0xf5,0xfd,0x1c,0x37,0x22,0xbe,
+    0x8f,0x76,0xeb,0x39,0x6a,0x75,0x55,0xf1,0x9e,0xd5,0xc5,0x64,0x55,0x58,0x55,0x0e,
+    0xf8,0xed,0x12,0x6c,0xc2,0x71,0x8c,0xe1,0x67,0xc1,0x38,0x90,0x7b,0xa6,0x71,0x14,
+    0x88,0xb3,0x24,0xcd,0x36,0x98,0x48,0xcb,0xa7,0xb2,0xdb,0x56,0xd9,0xf4,0xd8,0xca,
+    0x9b,0x6f,0xc1,0xce,0x99,0x82,0xb4,0x76,0x33,0x4f,0x29,0xd9,0xdd,0xa9,0x17,0xc8,
+    0xc8,0x21,0x2c,0xec,0xa2,0xd0,0x9d,0x32,0xe5,0xd7,0xd1,0x7d,0xa0,0x5f,0x07,0xb9,
+    0xf7,0xa8,0x7e,0x1d,0x0a,0x1b,0x84,0x1d,0x40,0xcf,0x3c,0x06,0x4c,0x3a,0xe8,0x25,
+    0x78,0x3c,0x85,0x35,0xa2,0xfe,0x12,0x67,0x44,0x0e,0x28,0xc8,0xfa,0x90,0x37,0x24,
+    0x60,0xe1,0x92,0xd6,0x67,0xd6,0x0c,0xa3,0xc0,0x99,0xe5,0xef,0xf7,0x14,0x77,0x5c,
+    0xb0,0x1b,0x66,0x20,0x5f,0x71,0x4c,0xdf,0x51,0x84,0xa8,0x9d,0xed,0x55,0x4e,0x4e,
+    0x7f,0x49,0x6e,0x69,0x3f,0x97,0x55,0x61,0x9d,0x6f,0x59,0xb0,0xb8,0x79,0xca,0x21,
+    0x6e,0x28,0xca,0xb1,0x54,0xc7,0x52,0xcd,0xe5,0xe5,0xe9,0xab,0x6f,0x13,0xce,0x29,
+    0xa3,0x1c,0xea,0xd9,0x7b,0xe8,0xc8,0x8b,0x5d,0xd2,0x7a,0x59,0x7d,0xc7,0xae,0xca,
+    0xae,0xdf,0xc9,0x48,0x00,0xe8,0x92,0xd4,0xc2,0xee,0x09,0x71,0x30,0xbb,0x32,0x25,
+    0xbc,0x65,0x9e,0x0b,0x76,0x46,0xec,0x8d,0x75,0x1c,0xca,0x48,0x0b,0x6c,0x12,0x79,
+    0x66,0x0c,0xde,0xd5,0x75,0xfd,0xa5,0x79,0x35,0x76,0xce,0x00,0xf8,0xa8,0xc6,0x21,
+    0xd4,0xd3,0x2a,0x7e,0x2c,0x39,0x4b,0x0b,0x9d,0xb3,0x42,0x99,0x73,0xf2,0xd9,0x79,
+    0xaf,0xac,0x6f,0x3d,0x97,0xa6,0xc3,0x49,0xd6,0x67,0xab,0x93,0xc3,0x0f,0x3c,0xd4,
+    0xc0,0x9d,0xc7,0x88,0x64,0x95,0x02,0x05,0x04,0x7e,0x8f,0xba,0x08,0x94,0xc6,0xa7,
+    0x23,0x39,0x7b,0xde,0xc4,0x1a,0xd2,0x9d,0x0a,0xc6,0xb5,0xce,0x4e,0x19,0x56,0xe3,
+    0xb0,0xb5,0x4e,0x2f,0x63,0x4e,0xc8,0xa0,0x5f,0xc2,0x1b,0xa5,0xb5,0x97,0x3f,0xaf,
+    0xa2,0xd3,0x1a,0x10,0x39,0xdf,0x9b,0x2c,0x8a,0x45,0x82,0x97,0xaf,0x8f,0x0f,0xcf,
+    0x62,0x4f,0x5f,0x45,0x03,0x5b,0x14,0xf2,0xc4,0x46,0xbf,0xdf,0xe8,0x74,0x1b,0x68,
+    0x2c,0xde,0x2f,0xf2,0xd9,0xdd,0x46,0xbe,0x57,0x89,0xd5,0x89,0x65,0x7b,0xda,0x1b,
+    0xd5,0xa9,0x99,0xea,0x77,0xb9,0xc4,0x3e,0xb6,0xfc,0x99,0xed,0x2d,0x92,0x11,0x5c,
+    0xad,0xe9,0x67,0x72,0xad,0xdc,0x96,0x7e,0x55,0xc4,0xb2,0xa0,0x5a,0x40,0xd0,0x78,
+    0xa6,0x69,0x95,0x6a,0x82,0x27,0x18,0x0f,0x95,0xd2,0x12,0x28,0x27,0xd6,0xd4,0x42,
+    0xb9,0xbd,0xdb,0x65,0x82,0x7b,0xf2,0xfc,0x25,0xee,0x7f,0x37,0x2d,0x02,0xec,0x26,
+    0x7d,0xb6,0x11,0x40,0xb1,0x74,0x4f,0x31,0x90,0xb5,0xd6,0x93,0xdd,0xba,0xa6,0x48,
+    0x1b,0x9d,0x76,0x05,0x41,0x7f,0x6a,0x91,0x52,0x49,0xdd,0x9e,0xda,0x67,0x0c,0x93,
+    0x2a,0x55,0x46,0xb1,0xe6,0x2b,0xb9,0x51,0xe7,0x51,0x3c,0xa8,0x6b,0xba,0x7e,0x98,
+    0xa0,0x92,0x8c,0xf4,0x2a,0x64,0x78,0x05,0xc5,0x4e,0x9d,0x8e,0x49,0xf7,0x2e,0xf5,
+    0x94,0xc9,0x32,0x51,0x0a,0xf5,0x16,0xd6,0x9b,0x9d,0x50,0xe9,0x56,0xbe,0x89,0x95,
+    0x15,0xa0,0xc0,0xc6,0x04,0x2e,0xe3,0x5b,0x1e,0xd3,0x91,0x88,0xe1,0xe8,0x56,0x8b,
+    0xe1,0x48,0x2e,0x44,0x7a,0xd6,0xa5,0x1a,0x53,0x3a,0xa4,0x0a,0x63,0xc3,0xf9,0xe1,
+    0xe9,0x2b,0x38,0xbb,0xb5,0x8b,0xcb,0x93,0x37,0xf1,0x01,0x1e,0x85,0x91,0x3d,0x5b,
+    0x5f,0xb3,0xb5,0x47,0x9a,0xad,0x2a,0xee,0x4d,0x79,0x9e,0x38,0xd8,0x26,0xe3,0x42,
+    0xf2,0xbc,0xe2,0xd8,0x67,0x7e,0x4c,0xe5,0x7a,0xc7,0x63,0x81,0x95,0x91,0x35,0x72,
+    0xe4,0x6f,0xce,0x5f,0x7f,0x7b,0x7e,0x72,0x11,0x8f,0x79,0x16,0xf8,0x93,0xa6,0x12,
+    0x9e,0xb0,0x5d,0xdd,0x34,0xd2,0x55,0x58,0x0e,0x2e,0x35,0x2d,0x39,0x40,0xd4,0x6f,
+    0x2c,0x54,0xb1,0x27,0x5b,0x53,0xc1,0x23,0xea,0xb9,0xd6,0x22,0x34,0x92,0xd5,0x5b,
+    0x66,0xa1,0x61,0x24,0x2e,0x53,0x18,0x95,0xa2,0x16,0x2a,0x0c,0x3d,0x51,0x0b,0x15,
+    0xc4,0x97,0xc8,0x89,0x3b,0x3e,0x79,0x73,0x89,0x1a,0xfb,0x78,0xe6,0x2c,0x98,0xb5,
+    0x26,0x06,0xf8,0x54,0x0d,0x4c,0xc8,0x53,0x06,0x10,0x90,0x5c,0x57,0xcf,0xf4,0x0e,
+    0x66,0xcb,0xbb,0xdf,0x4e,0xc7,0x45,0x15,0x0a,0x60,0x04,0x7a,0x34,0x49,0x79,0x5e,
+    0xef,0x54,0x5f,0xdf,0x5e,0xee,0xfa,0x12,0xd8,0x15,0xeb,0xdb,0xab,0x22,0xfd,0x24,
+    0x02,0x1a,0x98,0xdb,0x48,0x3d,0x07,0x2b,0x88,0x39,0xa4,0x46,0x67,0x66,0x54,0x6d,
+    0x92,0x7a,0xdd,0xe4,0x1e,0x50,0x14,0x8e,0xd9,0x00,0x94,0xa4,0x46,0x91,0xaf,0xf6,
+    0xf9,0xe1,0xe5,0x89,0x76,0x74,0x7a,0x7e,0xa4,0x98,0x24,0x03,0x54,0xe6,0x55,0xb7,
+    0x49,0x6e,0x67,0x84,0xa8,0x25,0x87,0x61,0x3a,0x81,0xe9,0xda,0x39,0x3a,0x47,0xee,
+    0xcb,0xac,0xa8,0x9d,0xe9,0x77,0x5a,0xe9,0xa9,0x00,0xd1,0xc2,0x9b,0x49,0x91,0xa6,
+    0x21,0x3e,0xf4,0x02,0x3f,0x22,0x89,0x9a,0xe6,0xbd,0x2e,0x20,0xe0,0x04,0xe5,0xc8,
+    0xb3,0x82,0xdb,0xf9,0x74,0xb9,0x6b,0xbb,0x8a,0x8a,0x4c,0xf4,0x86,0x3c,0xfb,0x17,
+    0x0f,0x52,0x0a,0xab,0xa7,0x57,0x57,0x31,0x28,0x1f,0xc6,0x36,0x8e,0x2f,0x23,0xdf,
+    0x08,0x01,0x7e,0x8a,0xb3,0xc3,0x93,0x65,0x17,0xbb,0xc9,0x5d,0x7f,0x51,0x88,0x12,
+    0xec,0x5a,0x57,0x65,0xd7,0x4a,0xe2,0xb5,0xb9,0xb7,0x17,0xc5,0x79,0x19,0x49,0xa7,
+    0xb9,0xcf,0x16,0x4a,0xc8,0xc4,0xb6,0xd8,0xbc,0xc6,0x82,0xcf,0x62,0x3e,0x2b,0x22,
+    0x36,0x6b,0x87,0xb3,0x59,0x95,0x03,0xa5,0x2a,0xc5,0x0b,0x28,0xdc,0x58,0x54,0xd1,
+    0xd4,0xd2,0xa9,0x62,0x6a,0xa1,0xd9,0x6a,0x49,0xc7,0x0c,0x61,0x82,0xce,0x8d,0x31,
+    0x60,0x65,0xed,0xd2,0xb2,0xcc,0x4d,0x9c,0x95,0x74,0x4a,0x4b,0x0a,0xf3,0x3a,0x15,
+    0xbd,0x2d,0x2d,0x2a,0x9d,0xcb,0xa9,0x70,0x73,0x0a,0x82,0xe1,0x0a,0xd9,0xa4,0x98,
+    0xca,0x28,0x6a,0xcf,0xe3,0xd3,0x1f,0x4e,0x8f,0x4f,0x62,0xeb,0xaf,0xe5,0xdc,0x2c,
+    0x2a,0x44,0xc6,0x88,0x64,0x11,0xe4,0x96,0xa7,0x10,0xab,0x93,0x8b,0x37,0xaf,0x5f,
+    0x5d,0x9c,0xfe,0x20,0x69,0xd5,0xdf,0x4d,0x6d,0xcb,0x31,0x6a,0x31,0xe3,0xfe,0x04,
+    0xcd,0x18,0xf5,0x85,0x1a,0x3f,0x53,0xea,0xa3,0xb1,0x6c,0x4d,0xba,0x0d,0x72,0x2a,
+    0x2f,0x2c,0x46,0x0e,0xeb,0xe5,0x40,0x96,0xd9,0x8e,0xec,0x6e,0xb3,0x8e,0x64,0xe2,
+    0x29,0xdb,0xe8,0xff,0x92,0xef,0x56,0xd0,0x44,0x72,0x86,0x21,0x00,0x23,0x26,0xf5,
+    0x64,0x70,0x49,0x31,0xfa,0x9b,0x81,0xef,0xba,0xc8,0xce,0x70,0x81,0x45,0xd1,0x49,
+    0xc1,0x1e,0xcd,0x29,0x88,0xf2,0xb3,0x79,0x9d,0x27,0xee,0xd7,0xf3,0x8b,0x93,0x3f,
+    0x41,0xf5,0x13,0x94,0x14,0x0f,0x8e,0x57,0x16,0xae,0x9b,0x75,0x3f,0xc8,0x57,0x6b,
+    0xa6,0xda,0x00,0xe2,0xd5,0x2c,0x8c,0x20,0x57,0x7c,0x14,0x14,0x05,0x22,0x74,0x44,
+    0x6b,0xed,0x66,0x34,0x88,0x49,0xb5,0x21,0xf6,0x16,0x75,0x85,0xe9,0xe3,0xa3,0xb7,
+    0xcb,0x8e,0x8f,0xe5,0xa3,0xa7,0x5b,0x3c,0xed,0xcb,0xd3,0x2d,0x9e,0xdd,0x06,0x19,
+    0x7b,0xf8,0xe3,0x19,0x37,0x9a,0xe9,0x1a,0x61,0x38,0xdc,0x08,0x47,0x1b,0x9a,0x63,
+    0xc1,0x5f,0xc7,0xb2,0x61,0xde,0x36,0x0e,0x1e,0x69,0xda,0x53,0xc0,0xf3,0xf8,0x3b,
+    0xe5,0xa8,0xa0,0xf7,0x99,0x2f,0x98,0x57,0x62,0xe3,0xe0,0xf1,0x97,0x77,0x9d,0x17,
+    0xdb,0xdb,0x9d,0xc1,0xd3,0x2d,0xf8,0x1c,0x17,0x3c,0x48,0x95,0x26,0x49,0x6a,0x23,
+    0x9d,0x00,0x27,0xa7,0x60,0x38,0x1f,0x6d,0x1c,0xdc,0x74,0x5b,0x6d,0x0d,0x76,0x4c,
+    0xaf,0xcb,0xcb,0x08,0xe0,0xf1,0x8f,0x54,0x2d,0xdb,0xcc,0xef,0xa5,0xb4,0xf3,0x6f,
+    0x1c,0xbc,0x32,0x6e,0x9c,0x09,0x4d,0xb2,0xda,0x57,0x43,0x14,0xc6,0x79,0x61,0x3c,
+    0xfc,0x86,0xe6,0x7b,0xa6,0xeb,0x98,0xd7,0x00,0xe1,0xca,0xbf,0xbd,0xb0,0xcd,0x9a,
+    0x6e,0x19,0xe1,0xd5,0xc8,0x87,0x8e,0xeb,0x75,0x36,0x67,0x5e,0x53,0xbe,0xda,0x38,
+    0x78,0x8a,0x4e,0x04,0x0a,0x20,0x9c,0x1c,0x9a,0x9b,0xee,0xf3,0x2e,0x4e,0x0d,0x7e,
+    0x3e,0xd0,0x8e,0x45,0x85,0xa7,0x5b,0x46,0x4e,0xeb,0x79,0xcd,0x62,0x50,0x6d,0x18,
+    0x37,0x49,0x8f,0x65,0xcd,0xed,0x1c,0xed,0xcb,0xe6,0xbe,0xc7,0xc2,0xd5,0x9b,0x32,
+    0x22,0x60,0x11,0x2c,0x74,0xbb,0x89,0xdb,0x8b,0xdf,0x95,0x36,0x7a,0xf2,0x5c,0x36,
+    0x7a,0x28,0x6b,0x54,0x6f,0x39,0xb0,0x31,0xa6,0x41,0x19,0x26,0x7f,0x51,0x3e,0xd0,
+    0x13,0xd9,0xe6,0x39,0x2b,0x5e,0xbd,0x41,0x60,0x9e,0x22,0x38,0xb6,0x95,0x16,0xc5,
+    0x9b,0xb2,0x26,0x77,0x9f,0x3c,0x91,0x4d,0x5e,0xf0,0xf2,0xbc,0xcd,0x4f,0x41,0xcb,
+    0x0b,0x4a,0x16,0x54,0x84,0x92,0x4a,0xf7,0x6f,0x81,0xe7,0xf1,0x6f,0x89,0xbc,0xd6,
+    0x74,0x4c,0x13,0xd5,0xdf,0xda,0xd2,0x37,0x81,0x46,0x11,0x4e,0xb7,0xae,0xfc,0x30,
+    0x42,0x9b,0xe5,0xa6,0xde,0xdf,0xef,0xc0,0xe6,0x0f,0x6c,0x63,0xaa,0x37,0xf4,0xf7,
+    0x23,0xd7,0xf0,0xae,0x61,0xa4,0xc5,0x23,0x83,0x0d,0xfc,0x62,0x4f,0x0e,0xed,0x0c,
+    0x76,0x80,0xf6,0xc2,0xb6,0x57,0x63,0x29,0xd2,0x86,0x79,0x54,0x2b,0x02,0xad,0x11,
+    0x01,0x1a,0x6e,0xa4,0xad,0x56,0x6c,0x36,0xf7,0x3a,0x3b,0xb2,0x49,0x56,0xbd,0xb0,
+    0xf8,0x19,0xb5,0xc3,0x0b,0xaf,0x98,0x71,0xa6,0xa7,0xc8,0x9b,0x74,0x9e,0x46,0x82,
+    0x7f,0x4a,0x7d,0x04,0x11,0x31,0x35,0x0a,0xcb,0x8f,0xb4,0x09,0xa5,0xd1,0xc2,0x56,
+    0x8f,0x60,0x62,0x03,0x43,0x3b,0x24,0xfa,0xa0,0xac,0x55,0x45,0x30,0x84,0x65,0xb7,
+    0xce,0xd8,0x69,0xc2,0xb3,0x04,0xca,0x0a,0xca,0x4f,0xd1,0x1d,0x7c,0xfa,0xd1,0x79,
+    0xe1,0x68,0xaf,0xff,0x41,0x0e,0x76,0xbd,0x96,0x0c,0xd6,0xd2,0xd4,0xb7,0x6c,0xb7,
+    0xa0,0x29,0xf6,0x8d,0xda,0x3a,0xf3,0x0d,0xe4,0x5e,0xb5,0x97,0xf8,0xaa,0xd5,0x6a,
+    0x7d,0x5a,0xa3,0xa1,0x55,0xd0,0x22,0x7c,0xa0,0xe6,0x2e,0x8e,0xb5,0x66,0x33,0xdb,
+    0x46,0x9a,0xb6,0x3f,0xdd,0x02,0x04,0xc2,0xac,0x6b,0xc0,0x7d,0x88,0x66,0xf0,0x77,
+    0xe6,0x74,0x62,0x29,0x1b,0x72,0x96,0x5a,0xe4,0x3f,0x60,0xfd,0x9a,0x19,0x13,0x5b,
+    0xec,0x35,0x85,0x02,0x27,0x4e,0x2b,0xa5,0x26,0x25,0x42,0x60,0x35,0xd9,0xcf,0x83,
+    0xe2,0xb2,0x48,0x8e,0x37,0x12,0x07,0x18,0xec,0x8f,0x83,0x8b,0x43,0x7e,0x68,0xd1,
+    0x48,0x2f,0xe6,0x33,0x3b,0xd0,0x0e,0x2d,0xc0,0xbd,0xf4,0xd8,0x73,0x71,0x98,0x8b,
+    0x6a,0x30,0x2c,0xfc,0xf0,0x45,0xb3,0xa9,0x1d,0x1f,0x5e,0x7c,0xf7,0xfc,0x35,0x3a,
+    0xb4,0x34,0x9b,0x19,0x8c,0xb7,0x4d,0x79,0x68,0xd1,0x5c,0x03,0x5d,0x51,0xce,0xa5,
+    0xec,0x2e,0x60,0x8e,0x7a,0xf9,0x9b,0x20,0xa6,0x49,0xbc,0xeb,0x44,0x99,0xb4,0xd7,
+    0x37,0x76,0x80,0x79,0xef,0x78,0xf7,0xf3,0xe6,0x30,0x09,0x48,0x06,0x0c,0xc8,0x66,
+    0xe0,0xfb,0x68,0x1e,0x45,0xbe,0xa7,0x14,0xd1,0xa8,0x98,0xc6,0xa2,0x15,0x12,0x54,
+    0xc5,0xb0,0x64,0x1b,0x35,0x4e,0x2d,0x3a,0xcf,0x9f,0x0f,0x80,0xce,0x8f,0x03,0x3b,
+    0xbc,0x7a,0xba,0xc5,0x60,0xad,0x04,0x3e,0xcb,0x02,0xcf,0x3f,0xed,0x0e,0x7e,0x80,
+    0xe1,0x29,0x47,0x97,0xf6,0x38,0x30,0x82,0x60,0x90,0x6e,0x28,0x0f,0x69,0x53,0x53,
+    0x28,0x59,0xf7,0xfc,0x19,0x36,0x35,0x33,0x89,0x2f,0x3c,0xc8,0x58,0x20,0x59,0xea,
+    0x13,0xe9,0x9c,0x36,0x0e,0x2e,0x81,0xb7,0x73,0x61,0xf4,0x13,0x07,0xd6,0x23,0xb0,
+    0xad,0xdc,0xb2,0x37,0x86,0xcb,0x51,0x00,0x98,0x4e,0x28,0xbf,0x71,0x80,0x9b,0x2d,
+    0xa7,0x20,0x31,0x58,0x87,0xae,0xab,0xcd,0x19,0x7f,0x90,0x53,0x44,0x39,0x18,0x76,
+    0x77,0x06,0x29,0x16,0x2c,0x67,0x50,0x93,0x07,0x0c,0xea,0x0d,0x2c,0x25,0x66,0x87,
+    0xbb,0xf4,0x2d,0xe3,0x7e,0xd5,0x88,0x66,0xac,0x70,0xe9,0x98,0x64,0x51,0xe0,0x83,
+    0x0b,0x0b,0xca,0xc3,0x7c,0xaf,0xd3,0xab,0x30,0xb0,0xe0,0x01,0x03,0x3b,0x1c,0x55,
+    0x1f,0x97,0x31,0xaa,0x3a,0x2c,0xa3,0xea,0xb0,0xaa,0xac,0x97,0xf1,0x80,0x61,0x9d,
+    0x41,0xfb,0xda,0x61,0x10,0x38,0xd0,0xfd,0x70,0xd5,0xb8,0xdc,0xb2,0xce,0x32,0x04,
+    0x44,0x0f,0x75,0x0d,0xcb,0x69,0xd1,0x15,0xee,0x6a,0xdf,0xb5,0xca,0x87,0xd6,0x7b,
+    0xd1,0xce,0x0e,0xad,0x60,0x1f,0x82,0x50,0xac,0x4d,0x47,0xb9,0x7b,0xd0,0x8c,0x09,
+    0x63,0xde,0x27,0x41,0x01,0x7f,0xb4,0xed,0x6b,0xf7,0x5e,0x65,0x67,0xd3,0x05,0x51,
+    0x3e,0x93,0x53,0xa6,0x4e,0x76,0x0a,0xe8,0x95,0x64,0x84,0x84,0xfa,0x0b,0xb5,0x45,
+    0x50,0x93,0xf9,0x20,0xb1,0x93,0xe6,0x0a,0x84,0x58,0x6c,0x10,0x01,0xb2,0xf7,0xa9,
+    0x05,0x2c,0x5a,0xcd,0x8a,0xc3,0x21,0x6c,0xd4,0x43,0xed,0x62,0xe6,0x3a,0xd1,0xe7,
+    0x1b,0x4a,0x67,0x37,0x6f,0x28,0x33,0xc7,0x2e,0x1a,0x07,0x07,0x48,0xe7,0xb2,0x63,
+    0x37,0x5d,0x7b,0x22,0x41,0x66,0x7c,0x32,0x3a,0xed,0x42,0x17,0x17,0xe6,0x23,0x53,
+    0x10,0x87,0xbc,0x4a,0x17,0xb9,0x51,0x38,0xb5,0x45,0xd8,0xd4,0xfd,0x14,0x4c,0x22,
+    0x7e,0xfa,0xe8,0xca,0x36,0xaf,0x9b,0x8e,0x17,0x6a,0x79,0xdc,0x21,0x9f,0x01,0xe1,
+    0xaa,0x8f,0xa9,0x04,0x63,0x3e,0xaa,0x74,0xb1,0x54,0xc6,0x79,0xfd,0xb9,0xe8,0x71,
+    0xf9,0xc7,0xc4,0xde,0xc1,0xb4,0x9a,0xfe,0x1c,0xa9,0x51,0x5b,0x8b,0x18,0xf1,0xca,
+    0xb2,0x83,0xc9,0x61,0x0a,0xa7,0x74,0x06,0x05,0x1d,0xe2,0x50,0x5f,0xc0,0x89,0x0b,
+    0xef,0x55,0x36,0x81,0x5c,0x22,0x3f,0x51,0x99,0xa6,0xae,0x57,0xa0,0xa9,0x03,0x51,
+    0xde,0xd7,0x4c,0x39,0xa3,0xf7,0x76,0x24,0x3a,0x9c,0x25,0x7c,0x9f,0xb8,0x6f,0x8e,
+    0xed,0x99,0x11,0x44,0x53,0x24,0xe8,0x9f,0x40,0x0a,0x70,0x76,0xd0,0x37,0x1b,0x6d,
+    0x78,0xe1,0x46,0xd9,0x8c,0xc2,0xcf,0xd2,0xef,0x6a,0xdf,0xce,0x81,0x78,0x3e,0x74,
+    0x2b,0x4b,0x3b,0x89,0x32,0x07,0x39,0x25,0x98,0x01,0x23,0x51,0x06,0x4a,0x85,0x37,
+    0x13,0x0d,0x19,0xc2,0xe7,0xfe,0xdd,0x70,0x03,0x9d,0xf4,0xf6,0xba,0xf0,0x7f,0x24,
+    0x03,0xcc,0xde,0x61,0xc2,0xeb,0xde,0xee,0x86,0x66,0xde,0xb3,0xbf,0x01,0xfc,0x69,
+    0x6f,0x68,0x68,0x8f,0x02,0xe9,0xd0,0x87,0x0e,0x92,0xbf,0xc7,0x35,0xe6,0x53,0x56,
+    0x95,0x66,0xe2,0x35,0x53,0x43,0x0e,0x37,0x76,0x37,0xb6,0x1e,0x0e,0x93,0x34,0x6d,
+    0x59,0x88,0xe2,0x05,0x32,0xc9,0xc0,0xe3,0x19,0x00,0xae,0xb3,0xbf,0xdf,0xda,0x49,
+    0x7c,0xf0,0xc7,0x63,0xca,0x00,0x9d,0xfc,0x82,0x53,0x6b,0x1a,0x33,0x98,0x1a,0xd4,
+    0x29,0x32,0x9c,0x57,0x67,0x69,0x0b,0xb7,0xec,0xcd,0x24,0x35,0x59,0xe9,0x29,0xc5,
+    0xfd,0xa0,0xd4,0xa5,0x47,0x38,0x29,0xbf,0x4e,0x2d,0x56,0x0a,0x75,0x73,0x41,0x11,
+    0xb7,0x29,0xd4,0x21,0xbb,0x03,0x8d,0xb3,0x54,0x7d,0x2d,0x96,0xbd,0x82,0xe6,0x2c,
+    0x57,0x0e,0x67,0x4a,0x7b,0x76,0x44,0xb3,0x5d,0x3e,0x0a,0x62,0x40,0x8c,0x85,0x49,
+    0xc2,0x31,0x4a,0xe4,0xf9,0x7c,0x28,0xc8,0x31,0x24,0x61,0xb8,0xb9,0x30,0x98,0xfe,
+    0x5e,0x85,0x92,0xc2,0xdb,0x55,0xd4,0x9a,0xff,0x10,0xf2,0x12,0x06,0x00,0x5c,0xe4,
+    0xcb,0x4a,0xb1,0x90,0xc4,0x35,0x69,0x9f,0x26,0x20,0x9d,0x5a,0x30,0x4d,0xe8,0x4c,
+    0xfd,0xd8,0x98,0xce,0x60,0xda,0x4c,0xd3,0x0e,0x43,0x3e,0x08,0xd4,0xbe,0x69,0x2f,
+    0x0d,0x0f,0xa4,0x4f,0x24,0x1f,0xbf,0x92,0xb0,0x84,0xca,0xa0,0xcb,0x00,0xa4,0x63,
+    0x90,0xe1,0x0d,0x97,0x4b,0x4b,0x9d,0x17,0x4f,0x4e,0xda,0x03,0x8d,0xde,0x33,0xe1,
+    0xbe,0xba,0xc8,0x94,0x82,0x7d,0x68,0x59,0x38,0x10,0x0e,0xf8,0xc5,0x8b,0x36,0x88,
+    0x61,0xf0,0x8e,0x74,0x8b,0xeb,0x8b,0x47,0xe3,0x58,0x5e,0x4f,0x7d,0x88,0x0f,0x41,
+    0xb2,0xc2,0x74,0xd5,0x30,0xb5,0x7d,0xc6,0x63,0x10,0x1f,0x7a,0x70,0x61,0x1b,0x81,
+    0x09,0x22,0x20,0x7b,0x4a,0xab,0xa4,0xbd,0x59,0x4a,0x3f,0xc1,0xf4,0xd4,0x7c,0x56,
+    0x76,0xda,0xc7,0x42,0xe5,0xf4,0x94,0x82,0x12,0x35,0x0a,0x4a,0xdc,0x88,0xb7,0xe4,
+    0xbc,0x19,0x12,0xfc,0x0d,0x0d,0x58,0x11,0xd3,0x46,0xa6,0xd4,0x06,0x4a,0xf3,0xca,
+    0x98,0xda,0x9a,0x1f,0x68,0xa7,0xc7,0xad,0x56,0x0b,0x67,0x88,0x6a,0x43,0x5f,0xc9,
+    0x8d,0x8c,0xf4,0xac,0xb5,0x7a,0x2e,0xd5,0x4d,0x0d,0x52,0x8c,0xe2,0xdc,0x77,0x6d,
+    0x39,0x06,0x1e,0xb2,0x8c,0xed,0x8f,0x9b,0x81,0xef,0x32,0xfd,0xf3,0x15,0x86,0x4a,
+    0x66,0x9b,0x60,0x81,0xcd,0x1a,0xf0,0xda,0x73,0xf8,0xca,0x04,0x39,0x84,0x06,0x68,
+    0xc7,0x3e,0x89,0x22,0x07,0x17,0xd1,0xdc,0x22,0xc4,0xcb,0xbc,0x37,0xc6,0xe3,0xcc,
+    0x5b,0xae,0xa0,0x10,0x6f,0xb7,0x58,0xa7,0x2a,0x0d,0x26,0x3e,0x23,0xf3,0x87,0x84,
+    0x27,0xdf,0xba,0x43,0x02,0x98,0x51,0x76,0x48,0x47,0xfe,0x14,0xe6,0x1d,0xf6,0xd5,
+    0x85,0xe9,0xd8,0xa4,0x62,0x4e,0x15,0x38,0xf1,0x80,0x81,0xb2,0xed,0x00,0xd8,0x8b,
+    0xcc,0xb7,0x97,0x46,0x74,0x65,0xa3,0x91,0xc5,0xcc,0x02,0x7e,0x73,0x75,0x1f,0xe6,
+    0xbd,0xa7,0x59,0x01,0x06,0x27,0xe0,0x66,0x83,0xf2,0xe9,0xa9,0xbc,0x6b,0xd5,0x19,
+    0x88,0x82,0xb9,0xad,0xa8,0x44,0xb5,0x23,0x17,0x30,0x30,0xb9,0xb5,0x0a,0x76,0xd3,
+    0x9c,0xeb,0x15,0x91,0x94,0x71,0x9d,0x43,0x11,0x49,0x3c,0xbc,0xbc,0x3c,0x79,0x75,
+    0x7c,0xf8,0xea,0xe8,0x64,0x15,0x5d,0x54,0x35,0xfe,0x9f,0x46,0x1c,0xcf,0x31,0x75,
+    0xb3,0x15,0x72,0xda,0x78,0xe6,0x4f,0x04,0x65,0x54,0x4d,0x04,0xbf,0x0a,0x51,0xb4,
+    0xef,0xd0,0x1e,0x70,0x74,0xf1,0x83,0xa4,0x87,0xdb,0x27,0x38,0xb3,0x17,0x3f,0x54,
+    0xa6,0x83,0x46,0x3e,0xa9,0x05,0x7a,0x3e,0x37,0x5c,0x95,0xd6,0x76,0xf7,0xda,0x2f,
+    0x06,0xa4,0x22,0x83,0x05,0xb0,0x3f,0x2f,0x49,0x94,0x1b,0x0c,0x19,0x3d,0xb1,0xb5,
+    0x54,0xc2,0x85,0x09,0x25,0xd8,0xd2,0xc1,0xb2,0x35,0xd9,0x93,0x24,0x4e,0xa8,0x47,
+    0x8b,0xa7,0xba,0x96,0x11,0x7b,0x1e,0xb2,0x99,0xa9,0x99,0xd4,0x76,0xce,0x69,0x27,
+    0x67,0x47,0xff,0xd6,0xf6,0x72,0xfe,0xec,0x00,0xed,0x8c,0xe6,0x61,0xd1,0xcc,0x20,
+    0x3f,0xf6,0x19,0x66,0x86,0xb3,0x71,0xd9,0x01,0x8c,0x72,0x5f,0x9f,0x11,0x76,0xa4,
+    0x27,0xef,0xce,0x04,0xb2,0x60,0xad,0x37,0xca,0xe2,0x23,0x78,0xe7,0x2f,0x77,0x04,
+    0xd3,0x44,0x96,0x1d,0xc2,0xdf,0xa7,0x4f,0xe1,0x22,0x44,0x5f,0xbd,0xf9,0x12,0x42,
+    0x60,0x81,0x98,0x25,0x3b,0x45,0x84,0x4f,0xd1,0x11,0x03,0x45,0xab,0x20,0x9b,0x8b,
+    0xda,0x4c,0xb4,0xfe,0x24,0x51,0x1d,0x18,0x64,0x2d,0x60,0x44,0x75,0x95,0xa5,0x26,
+    0x42,0x65,0x1e,0x65,0xfd,0x83,0x3f,0x64,0xfe,0x7f,0x1a,0x05,0xf8,0xf3,0x00,0x66,
+    0xef,0xe9,0x16,0xfc,0xc5,0xdf,0x38,0xa3,0xf2,0x01,0x4f,0xdc,0xf8,0x81,0x70,0x8a,
+    0x3f,0x5c,0x3a,0x4a,0xb1,0x23,0xdf,0x1b,0x03,0xa1,0xa3,0x0d,0xcb,0x5f,0x89,0x4d,
+    0xc1,0x1f,0x0f,0xc9,0xf3,0x8a,0x3f,0x6f,0x61,0xb3,0x5b,0xa2,0x0b,0x94,0xfd,0x4e,
+    0xcc,0x08,0x3e,0xe0,0x5c,0xd1,0x5b,0xfc,0xcb,0xba,0xbb,0x9a,0xbf,0x3f,0x3f,0x79,
+    0xf3,0xfa,0xfc,0x72,0x25,0x87,0x2f,0x8d,0xc8,0x9f,0x76,0x8c,0x1d,0x7a,0x86,0x7b,
+    0x8f,0x84,0x86,0x1f,0x64,0xa7,0x5e,0x88,0xaa,0x2f,0xb1,0x04,0xd2,0xf6,0xbc,0xce,
+    0x49,0xc6,0xe9,0x46,0xe1,0x49,0x46,0xd2,0xd2,0x0c,0x08,0xfa,0x7d,0x98,0xa6,0x27,
+    0xbc,0xbd,0x5a,0x5d,0xe2,0x52,0x22,0x72,0x88,0xf6,0xa9,0x2a,0x33,0x26,0x09,0xce,
+    0x1e,0xea,0x71,0xc3,0x48,0xdb,0xd3,0x8e,0x01,0x76,0x9a,0x6a,0x88,0x52,0x9d,0x6d,
+    0x5e,0xac,0xb3,0x5d,0x5a,0x0e,0x05,0x70,0x36,0x14,0xdb,0x62,0x15,0x7a,0xed,0x64,
+    0x05,0x45,0x86,0xe3,0xf4,0xe7,0x01,0x36,0x1b,0x76,0x9c,0x9f,0xe3,0x1c,0x24,0xce,
+    0xf4,0xa3,0xed,0x81,0x76,0x42,0xdf,0xd6,0x3f,0x76,0x27,0xdd,0x72,0xfd,0x70,0xa1,
+    0x3e,0xc8,0x70,0x12,0x5a,0x61,0xad,0xf6,0xdc,0x08,0xea,0x15,0xb4,0x30,0x2b,0x54,
+    0xc2,0xdd,0x3c,0x3d,0x2a,0xb1,0x06,0x29,0x3d,0xea,0x0a,0x85,0x56,0x51,0xbf,0xd9,
+    0x1e,0xd5,0x8e,0xf1,0xfc,0x73,0x60,0xb2,0xf0,0x04,0xfc,0xd4,0x4e,0x0b,0xc1,0x2c,
+    0xa3,0xfc,0xed,0x96,0xf5,0xba,0x84,0x14,0x97,0x2d,0x89,0x18,0x88,0x32,0xf5,0x97,
+    0x01,0xfc,0xd2,0x6a,0x67,0xd0,0xed,0x7a,0x75,0x3d,0xd8,0x8a,0x85,0x68,0xe7,0x8d,
+    0x49,0x00,0xcb,0x6a,0xb4,0x1f,0xa2,0x31,0x2e,0xd6,0xd1,0xcf,0xd6,0x53,0x32,0x56,
+    0xa3,0xf8,0xb0,0x71,0xae,0x2b,0x90,0xfc,0x73,0x49,0xf2,0x0b,0x68,0x76,0x00,0x70,
+    0x4a,0x89,0xf6,0x03,0x51,0x13,0x7b,0xa1,0x5d,0xcc,0xa7,0x53,0x23,0xb8,0xff,0x6c,
+    0x83,0x56,0xd9,0x58,0x3e,0xc0,0x97,0x36,0xea,0x99,0xc2,0xea,0x03,0x66,0x1a,0xdb,
+    0x6a,0x03,0x2e,0x3a,0xab,0x64,0xfc,0xe9,0x8a,0xc3,0x2a,0xf6,0x3f,0xfa,0xb4,0xd3,
+    0x8a,0x8e,0xe7,0xc9,0x5c,0xf0,0xb8,0xaa,0x19,0x3f,0x76,0x59,0x5a,0x2d,0xb3,0xaa,
+    0x6a,0xa0,0xd0,0xb8,0xb1,0x45,0xdd,0x98,0xf8,0x3e,0x3f,0x19,0x68,0x17,0xc6,0x8d,
+    0x5d,0x49,0x52,0xa5,0xa0,0xdb,0x8d,0x82,0x36,0xf1,0x63,0x81,0xe3,0x1d,0x7c,0xa9,
+    0xe9,0xa1,0x49,0xd9,0x4a,0xf4,0x46,0x74,0xe5,0x84,0x75,0x61,0x0b,0xec,0x0c,0x12,
+    0xae,0x66,0x29,0xfa,0x9f,0x6d,0xa1,0x08,0x34,0x32,0x54,0x13,0x15,0x36,0x57,0x9e,
+    0xa1,0xf4,0x3a,0xf1,0x1c,0x36,0x8d,0x0f,0x86,0x6e,0xa2,0x0b,0x96,0x0a,0x1b,0x1d,
+    0xad,0x98,0x63,0x63,0xf3,0xe8,0xf0,0xe5,0x27,0x40,0xf6,0xfc,0xc8,0x19,0x27,0x61,
+    0xef,0x74,0xe0,0x40,0x7c,0x85,0xef,0x1d,0xe6,0x12,0x16,0x7e,0x02,0x7c,0x74,0x9e,
+    0x9d,0xcf,0x52,0x9d,0xc7,0x45,0x7f,0x4e,0x1f,0xaa,0x2d,0xfb,0x2c,0xe9,0x9b,0xc2,
+    0x16,0x32,0x1f,0x91,0xd3,0x2e,0x04,0x13,0x81,0xd7,0xc2,0xf4,0xab,0x21,0x1b,0xaa,
+    0xa5,0xf0,0xbb,0xd0,0xbe,0x41,0xb9,0xf2,0x0a,0x6d,0x1b,0x49,0x89,0x2e,0x88,0x34,
+    0xc6,0xe2,0xe6,0x48,0xd8,0xd4,0x61,0x76,0x0c,0x8c,0x27,0x28,0xe0,0xe1,0xd5,0x8f,
+    0x9c,0xfd,0x69,0xef,0xf5,0x81,0x03,0x3a,0x28,0xd5,0xd3,0x2b,0x2d,0x9d,0xc0,0x61,
+    0x55,0xb1,0x1d,0x1b,0xcd,0x0b,0x82,0x19,0xdb,0xef,0xb7,0xd7,0x68,0x85,0xcc,0xf4,
+    0x97,0xb1,0x45,0x7d,0x65,0x5b,0x64,0xaa,0x97,0x43,0xda,0x07,0x81,0xa4,0x7a,0x63,
+    0xdc,0xd5,0xe1,0x68,0x1e,0xf9,0xa8,0x52,0x5c,0xd9,0x16,0x77,0x77,0x90,0x43,0x6b,
+    0xe7,0x0d,0xad,0x9a,0xfd,0xae,0x14,0x61,0x3a,0x2f,0x7a,0x1d,0xc0,0x98,0x57,0x97,
+    0x6f,0x38,0xd3,0x8e,0xf3,0xfe,0xb3,0xef,0xd9,0x9f,0x03,0x63,0x10,0xea,0x85,0x1d,
+    0xdc,0xa0,0x02,0x3c,0x6f,0xc4,0x52,0x92,0xc5,0x11,0x7b,0xd1,0x4c,0x0e,0x77,0xe6,
+    0xfb,0x6e,0x0b,0x5e,0xb4,0xfc,0x60,0x52,0x7d,0x8e,0xbf,0x7d,0x79,0xa9,0xbd,0x26,
+    0x7b,0x94,0x56,0x03,0x72,0xef,0x7b,0x56,0x58,0xcf,0x6d,0x98,0x65,0x20,0x8d,0x9b,
+    0x9e,0x4c,0xe3,0x99,0xee,0xed,0xc2,0x44,0x27,0xc5,0x69,0x7c,0xa5,0x0d,0xb5,0xef,
+    0x2f,0x8f,0x36,0x3b,0xe5,0x6b,0xb0,0x8e,0xea,0x2d,0xbc,0xf7,0x4c,0x98,0x20,0x79,
+    0x4e,0xec,0xb4,0x81,0x26,0x5d,0xc0,0x4b,0x5a,0x8c,0x57,0xfe,0xed,0x03,0x7c,0xaa,
+    0x66,0x92,0x7c,0x10,0xb1,0xde,0x78,0x08,0x3a,0x1c,0xbe,0x48,0x90,0x74,0xed,0x8d,
+    0x81,0x8e,0xf4,0x91,0x74,0x80,0xfa,0x34,0x94,0x78,0x69,0x44,0xe6,0x55,0xbc,0xeb,
+    0x60,0xa1,0x1c,0x90,0xe5,0x8d,0xc0,0x89,0xee,0xeb,0xaa,0x05,0x0c,0x97,0x05,0x33,
+    0x61,0x31,0x57,0x99,0x1c,0x53,0x18,0x33,0x5a,0x1e,0xec,0xec,0x7c,0x2d,0x25,0xfc,
+    0x9c,0x95,0xa6,0x2c,0x8a,0x1b,0xda,0xd4,0xf1,0x86,0x1b,0xdb,0xb0,0xae,0x53,0xe3,
+    0x6e,0xb8,0xf1,0xa4,0x2d,0x57,0x7b,0x67,0x67,0x23,0xd1,0x9c,0xa2,0x2b,0xb1,0x7c,
+    0x73,0x8e,0x5c,0x51,0x6b,0x62,0x47,0x27,0x2e,0x59,0xa6,0x9e,0xdf,0x9f,0x5a,0x35,
+    0x5d,0xed,0x9a,0x5e,0x6f,0x21,0x16,0x1f,0xf1,0x1b,0x6e,0xf1,0x08,0x68,0x11,0xe8,
+    0x4d,0xfd,0x6b,0xbd,0x3a,0xe6,0xbe,0x74,0x3c,0x0d,0xfd,0xfd,0xb5,0x0b,0xe7,0x67,
+    0x10,0x94,0x66,0x77,0xd5,0xf0,0x16,0x86,0x85,0x29,0x69,0xe4,0x68,0xf6,0xdb,0xe9,
+    0xa1,0x76,0xd7,0x21,0x88,0xea,0xaa,0x1f,0xc1,0x0e,0xb4,0xfc,0x5b,0x4f,0xab,0x4d,
+    0x2b,0x6e,0x22,0x93,0xd7,0x88,0xe7,0xb6,0xdd,0x5e,0x8b,0xe6,0x63,0x48,0x0a,0x3b,
+    0xb5,0x82,0x69,0x08,0x28,0xf8,0xc7,0xb9,0x43,0x1e,0x7c,0x95,0xda,0x66,0xb5,0xe2,
+    0xb6,0xf9,0x44,0xf4,0xf8,0x3c,0xac,0x43,0xaa,0x5f,0x1a,0x77,0xb4,0x18,0xa1,0x86,
+    0xee,0xa8,0x2f,0x02,0xa3,0xe0,0x20,0xca,0xac,0x86,0x71,0x87,0xab,0x11,0x77,0xa2,
+    0xc3,0x3b,0xd1,0xe1,0x9d,0xd8,0x5f,0x49,0x3c,0x54,0x86,0x9d,0x67,0x8c,0x85,0x3a,
+    0x49,0x92,0x02,0x1f,0x00,0x49,0x59,0xb3,0x58,0x08,0x73,0x14,0x28,0x64,0x85,0x50,
+    0x90,0x8a,0x9e,0x81,0x04,0xdb,0x8a,0xfc,0xc9,0xc4,0xb5,0x6b,0xba,0xef,0x91,0x5f,
+    0xbb,0x20,0x29,0x45,0xde,0x30,0x39,0xd7,0x2b,0x80,0x20,0x89,0x29,0xde,0x62,0x6b,
+    0x87,0x86,0x7e,0xd1,0xd0,0xa0,0x46,0x67,0x3c,0x32,0x38,0xab,0x9c,0x5f,0xca,0xc6,
+    0x12,0x0f,0x64,0x34,0xff,0xf9,0x67,0x9c,0xcf,0x5f,0x73,0x28,0xcf,0xa9,0x8d,0xad,
+    0xb3,0x93,0x63,0x6d,0x6c,0xdb,0x16,0xb2,0x6e,0x38,0x92,0x40,0x65,0x61,0x3f,0xcf,
+    0x68,0x1c,0x2f,0xda,0xff,0x75,0xc7,0x82,0x66,0x01,0x60,0x1a,0x35,0x44,0x3a,0x6d,
+    0x62,0xb8,0xae,0x1d,0xdc,0x6b,0x63,0x1f,0x5d,0x05,0x83,0x89,0xad,0x85,0x4e,0x04,
+    0x28,0x5c,0xc3,0x7e,0x34,0x34,0x63,0x36,0x73,0x1d,0x78,0xa4,0x6c,0xb7,0x30,0x5c,
+    0x5a,0xba,0xfa,0xa7,0x8d,0x35,0x81,0x85,0xcc,0xed,0xd4,0xb4,0x7f,0xdd,0x21,0x5f,
+    0x5c,0x3b,0x33,0x36,0x5e,0x0b,0x4e,0x24,0xd2,0x9e,0x6a,0xb7,0x57,0x8e,0x8b,0x9e,
+    0x91,0x30,0x62,0xd3,0xf6,0x6c,0xcd,0x09,0x35,0x7b,0x3a,0x8b,0xee,0x35,0x03,0xb8,
+    0xc8,0x39,0xd7,0x08,0x5a,0xb9,0x6a,0xe0,0x75,0x0e,0x54,0x90,0x4f,0x1e,0x72,0x9c,
+    0x26,0xa5,0x18,0xed,0x82,0x62,0x4d,0x4a,0x26,0x5c,0xa4,0x79,0x41,0x29,0x95,0x12,
+    0xbd,0x1c,0xb0,0x2a,0xda,0xf7,0xe7,0x67,0x7d,0x0c,0x54,0xa3,0x77,0x70,0x80,0xda,
+    0xda,0xcb,0xbf,0x7f,0x73,0xf2,0xad,0xc6,0xa2,0x57,0xb4,0x60,0xee,0x85,0x88,0xc9,
+    0xa8,0xe3,0xd3,0xf6,0x3b,0x9a,0x3f,0xd6,0x70,0xfe,0x35,0x76,0xd9,0x7a,0x0b,0xbd,
+    0x4d,0x98,0xcf,0x85,0xe6,0x44,0x9a,0x41,0x0e,0x2b,0x04,0x8a,0x0d,0x8f,0x60,0x34,
+    0xe7,0x81,0x4b,0xbe,0x74,0xac,0x8d,0xcf,0x71,0xda,0x13,0xf1,0xa4,0x43,0x2d,0xcf,
+    0x10,0x84,0x44,0x73,0x8c,0xab,0x2d,0xad,0x3d,0x07,0xff,0xf8,0xc3,0xb7,0x87,0x5a,
+    0xad,0xd7,0x6d,0xdf,0x75,0xb7,0xdb,0xf5,0x8c,0x36,0x55,0xaa,0x50,0xa9,0xd8,0xee,
+    0x76,0xfb,0x6e,0x7b,0x3f,0x5b,0xec,0xe0,0x82,0x3e,0xef,0xb7,0xdb,0x77,0xc0,0xb9,
+    0xd5,0x57,0x58,0x76,0x4a,0xba,0x4f,0x13,0xfc,0x8f,0x73,0xc3,0x45,0xc7,0x95,0x5a,
+    0xa7,0x3d,0x1c,0xc1,0xc6,0xa9,0x76,0x1a,0xfe,0x34,0xb3,0x27,0x7f,0x8c,0x4f,0x82,
+    0xae,0x38,0x0a,0xc4,0xc1,0xbc,0xdb,0xab,0x7e,0x20,0xfd,0xd3,0xd1,0xd9,0x3f,0xc0,
+    0x39,0x04,0x07,0x22,0xec,0x30,0xe8,0xc8,0x77,0x3f,0x57,0xeb,0xc3,0x9d,0xe9,0x5e,
+    0xcb,0x2e,0x60,0xfc,0x77,0x7b,0xad,0x13,0xf9,0x05,0xbc,0xb9,0xd2,0xb6,0x34,0x20,
+    0x96,0xa9,0xd5,0x93,0x13,0xfd,0x3a,0xcf,0x3d,0x02,0x4e,0x8b,0xec,0x4b,0xf7,0xd6,
+    0xb8,0x0f,0xb5,0xd7,0xde,0xca,0xc5,0x78,0x30,0xe1,0xfd,0x35,0xe9,0xce,0x0f,0x76,
+    0x10,0x39,0xa6,0xe1,0x6a,0x63,0xd7,0xf9,0xe4,0xf3,0xee,0xd7,0xec,0xe8,0x77,0x7e,
+    0xe0,0x80,0xf4,0x86,0x41,0x10,0x53,0x27,0x08,0xfc,0xa0,0xa0,0xb3,0xab,0x2c,0x0a,
+    0x09,0x37,0x5b,0xf2,0x21,0x46,0x47,0xdb,0xcf,0x17,0x60,0x47,0x9e,0x6f,0xcf,0x99,
+    0x23,0x1e,0xfa,0x47,0x4a,0xc2,0xf8,0x09,0x22,0x0f,0xe9,0x79,0x1e,0x44,0xa3,0x4f,
+    0x90,0x46,0xe3,0xe5,0x15,0x69,0x9d,0xd0,0xdf,0xe0,0x0a,0x5f,0xa0,0x26,0xdf,0x22,
+    0xdb,0x8a,0xc2,0x92,0x85,0x4c,0x29,0xac,0xd1,0x15,0x1c,0xab,0x11,0x94,0x11,0xf0,
+    0x9c,0x55,0xce,0x5a,0xc5,0x0a,0x74,0x41,0x2f,0x41,0x46,0xfd,0x0e,0x56,0xb9,0x44,
+    0xb0,0x4f,0xc8,0xd0,0xe1,0x14,0xa4,0xf9,0x09,0xf6,0xae,0x65,0xfa,0xd3,0xea,0x44,
+    0x88,0x1a,0x7a,0x43,0x86,0xab,0x12,0x8a,0x27,0xb8,0xfe,0xfd,0xbd,0x35,0x20,0xc3,
+    0xdc,0x01,0x2f,0x74,0xc2,0x66,0x2c,0x07,0x38,0xcd,0x65,0x6a,0x18,0x06,0x7a,0x46,
+    0xfc,0x5d,0x68,0x5e,0xa1,0x82,0xc2,0xb6,0xe6,0x6b,0x28,0x80,0x66,0x33,0x10,0xa5,
+    0xd9,0x75,0x28,0xb9,0xcd,0x89,0xbb,0x52,0x52,0x2d,0x7e,0xeb,0xfb,0x80,0x33,0xc8,
+    0xc0,0x69,0xb2,0xc4,0xda,0x6e,0x9f,0x85,0x7b,0x86,0xe9,0x2e,0x1f,0xb4,0x69,0x50,
+    0xc3,0x79,0x6c,0x44,0x46,0x91,0xe7,0xe6,0x03,0x59,0x86,0x63,0x10,0x21,0xd1,0x7a,
+    0xab,0x89,0x38,0x0c,0x74,0x1e,0x10,0xf3,0x55,0xa0,0x5c,0x29,0x70,0x68,0x12,0xf8,
+    0x1d,0x27,0x94,0x51,0x7d,0x9c,0x64,0x43,0xaa,0xb3,0x53,0xd5,0xd5,0x24,0xd7,0xb3,
+    0x35,0xba,0x68,0x29,0x5d,0x34,0xb1,0x2e,0x3a,0x79,0x95,0x75,0x71,0xe7,0xb8,0xc3,
+    0x1d,0xdc,0x18,0xf4,0xfc,0xfe,0x55,0x61,0x24,0x0b,0x77,0x39,0x3a,0x0f,0x2a,0x24,
+    0xc4,0x85,0x1e,0x69,0x46,0x00,0xb4,0x24,0xf2,0x41,0xee,0x46,0x66,0x12,0x99,0xea,
+    0x8b,0x63,0x8d,0x0c,0x8e,0x8e,0x27,0x58,0xc6,0x83,0x2d,0x23,0xb2,0xb6,0xa0,0xf8,
+    0xfb,0x3f,0xc0,0x3f,0xcd,0x97,0x2f,0x9b,0xc7,0xc7,0x2d,0x33,0xbc,0x91,0x9c,0x23,
+    0x71,0x9b,0xa4,0xce,0x00,0x7e,0xc5,0x47,0x8b,0x3b,0x07,0x6c,0xdc,0x00,0x5c,0x23,
+    0x8c,0x01,0xbd,0x38,0x3c,0x3a,0x69,0x3d,0x3f,0x7d,0x95,0xac,0x4a,0xfe,0xc0,0x16,
+    0xa0,0xd6,0xc8,0x08,0xed,0x7e,0x5c,0xda,0x1a,0x6d,0x91,0x2f,0x72,0x2b,0xba,0x8b,
+    0xe2,0x1a,0xd2,0x5a,0xa3,0x94,0x04,0xee,0x67,0x4b,0xd8,0x89,0x5a,0x3f,0x85,0x24,
+    0xd5,0x89,0x06,0x8a,0x75,0xa6,0x68,0x85,0xfa,0xe5,0xdf,0xfe,0x44,0x19,0x4d,0x50,
+    0x68,0x08,0xb4,0xff,0xe4,0x83,0x40,0xc1,0x5e,0xfd,0x0d,0xfe,0x9f,0x5b,0xca,0x72,
+    0x36,0xae,0x58,0xf3,0x95,0xf7,0x76,0xe1,0xc5,0x04,0x2a,0x62,0x74,0x13,0xe4,0x3f,
+    0x77,0xfb,0x97,0xc7,0xaa,0xef,0x1e,0xb6,0x07,0xc9,0xd9,0xfb,0xd3,0xbf,0xa1,0x36,
+    0x05,0x70,0xea,0x5e,0x3b,0x07,0x19,0x31,0x43,0x24,0x66,0x39,0x27,0x5f,0xf5,0x2c,
+    0x99,0x2c,0xf3,0x71,0xfa,0xd4,0x3a,0x09,0x00,0x73,0x24,0x9e,0xe5,0xf5,0x38,0xea,
+    0x40,0x87,0x8d,0xec,0x0e,0x00,0x51,0x19,0x5e,0xda,0xa4,0x8c,0x02,0x64,0x25,0x85,
+    0x4e,0x83,0x36,0xc2,0x5c,0xc5,0xca,0x06,0x49,0x97,0x0c,0xa1,0x43,0x69,0x2d,0x14,
+    0xd2,0x19,0x26,0x15,0x52,0x37,0x4f,0x8b,0xe4,0x35,0x26,0x8a,0xa1,0xd6,0xe4,0x1e,
+    0x45,0x35,0x1c,0x0f,0x41,0x09,0xec,0x68,0x1e,0x80,0xf4,0x16,0xf9,0x1a,0x66,0x0f,
+    0xb0,0x91,0x17,0xa0,0x68,0x3f,0x67,0x4a,0xe9,0x66,0x22,0x1b,0xce,0x7a,0x9c,0x46,
+    0xcf,0x87,0xb2,0x23,0xdf,0x8f,0xb4,0x80,0x2b,0xc7,0x68,0xbb,0xa8,0xd4,0xaa,0x78,
+    0xc0,0x6c,0x89,0x2e,0x51,0x26,0x34,0x0d,0x0f,0x78,0x25,0x6d,0x04,0x63,0xf2,0x30,
+    0x53,0x5f,0x2b,0xee,0xb9,0x24,0x8a,0xf7,0xfe,0x3c,0x40,0xca,0xc8,0xc8,0xc2,0xd8,
+    0x09,0x42,0x90,0xd9,0xc6,0xf8,0x5a,0xf3,0x6c,0x1b,0x6f,0x34,0xb5,0xa7,0x2d,0x85,
+    0x0e,0xcd,0x56,0x32,0x97,0x56,0xda,0x41,0xd4,0xaf,0xe9,0x53,0x1f,0x73,0x6a,0x23,
+    0x6e,0x34,0x51,0x7f,0x10,0xe9,0x79,0x14,0xb1,0xca,0x35,0x25,0x89,0xd5,0x67,0xa6,
+    0xc9,0x17,0x4f,0x06,0x49,0xc4,0xa3,0x39,0xfc,0xd1,0x99,0xd9,0x1a,0xb9,0x4d,0xc3,
+    0x4a,0x2a,0xfd,0x5f,0xcd,0x77,0x2a,0xe6,0x6a,0x66,0xd2,0x46,0x72,0xb1,0xc5,0x63,
+    0xd0,0x69,0x2b,0x3e,0xdd,0xc2,0xe0,0x7b,0x28,0x42,0x9f,0xb8,0x42,0x93,0x05,0x37,
+    0xa0,0x1b,0x2c,0x2b,0xa3,0x6c,0xa9,0xa9,0x2f,0x72,0x10,0xf0,0xf0,0xf8,0x94,0xd9,
+    0x7b,0x9a,0x17,0x96,0xce,0x32,0x7d,0x26,0x8f,0xe6,0x69,0xc2,0x03,0x8f,0x83,0x53,
+    0x4e,0x6b,0x16,0x8c,0x20,0xa2,0xa2,0x79,0x44,0x02,0x8d,0x21,0xb9,0x54,0x22,0xe7,
+    0x65,0xe2,0xb0,0x82,0x67,0xbe,0x54,0x08,0x55,0x4f,0xe4,0xa4,0xc8,0x9e,0x4a,0xa9,
+    0x6e,0x31,0x9f,0x80,0x47,0xab,0xf9,0x81,0x22,0x19,0x74,0x0e,0x53,0x48,0xee,0x8c,
+    0xdf,0xac,0x30,0x21,0xcd,0xe9,0x16,0x82,0x14,0xf3,0x64,0xb7,0x26,0x2d,0xed,0xef,
+    0xfd,0x2b,0x0f,0x10,0xdb,0x2e,0x8d,0x16,0x53,0xda,0xa4,0x15,0x3b,0x3d,0xae,0xd0,
+    0xa2,0x63,0xe5,0xb5,0x77,0x71,0xf9,0x7d,0xb3,0xdd,0xee,0x54,0x6d,0xae,0x28,0xc0,
+    0x61,0xce,0x02,0x1c,0x7e,0xc5,0x20,0x85,0x07,0x7a,0x36,0xcf,0x99,0x5f,0xf3,0x6f,
+    0xc5,0x3d,0xb9,0xc8,0x2c,0x9a,0x8d,0x1f,0x2c,0x72,0xbb,0x89,0x15,0x79,0xc4,0xd4,
+    0x1c,0x19,0x33,0x20,0xd8,0xf6,0x03,0xfd,0xa8,0xd8,0xad,0x0a,0x5c,0x49,0xc3,0x1f,
+    0x94,0x05,0x51,0xbd,0xa9,0xe0,0x2b,0x13,0x9d,0x37,0x34,0x1e,0x94,0xd7,0xeb,0xb6,
+    0x37,0x34,0x76,0x06,0x0e,0x37,0xba,0x68,0xe5,0x49,0x45,0x04,0xab,0xb7,0x80,0xad,
+    0xba,0xaa,0x41,0x71,0xd3,0xca,0xc6,0x60,0x62,0xe3,0x58,0x08,0x80,0xc6,0xee,0x93,
+    0x9f,0x3d,0xb9,0x62,0x61,0x06,0xc2,0xfd,0xa2,0x00,0xd7,0x15,0x19,0x69,0xb3,0x12,
+    0x46,0x86,0xb9,0xd8,0x26,0x66,0x41,0xc9,0xe5,0x23,0x5c,0xa5,0x80,0xa9,0x07,0x92,
+    0xa7,0x31,0x37,0x07,0x96,0xc5,0x46,0xf1,0xa3,0xca,0x75,0x47,0xde,0x20,0xcb,0xdd,
+    0x0e,0x9c,0xa8,0x84,0x12,0xa1,0x3c,0x98,0xab,0xf3,0xe9,0xe2,0x7e,0x8c,0xdc,0xa5,
+    0x8c,0xd1,0x84,0x45,0x0c,0x8f,0xdc,0x8d,0xa4,0xb6,0x80,0x67,0xa1,0x8b,0x13,0xae,
+    0xed,0xe6,0xe5,0xdb,0x53,0xee,0x70,0xcd,0xcf,0xa4,0x36,0x02,0xdc,0xbd,0xd6,0x3a,
+    0xa1,0x4c,0xa1,0x26,0x63,0xaa,0xb5,0xb3,0xd3,0x1f,0x4e,0x56,0x6c,0xa8,0xa2,0xa8,
+    0xf4,0xbd,0x6c,0x8e,0xf8,0x6e,0x95,0x5b,0x50,0xd7,0x89,0x64,0xc1,0xf9,0xa1,0xdf,
+    0xb8,0x6a,0xa4,0xa4,0x57,0x2c,0xec,0xf8,0x0e,0x16,0xb2,0xa6,0x2a,0x9c,0x92,0xcb,
+    0xbb,0x76,0x7a,0x14,0xd1,0x1e,0x5f,0x71,0x55,0xd7,0x13,0x38,0x13,0xe0,0x7a,0xd9,
+    0xb1,0x8f,0xa2,0x1d,0xcc,0x07,0x7a,0xc0,0x59,0x02,0xd7,0xf6,0x07,0x82,0x27,0x40,
+    0x32,0x52,0xb9,0xed,0xbc,0xb1,0x62,0xaa,0xbc,0xd4,0x50,0xfd,0x19,0x1b,0x69,0xa2,
+    0xd9,0xee,0x0e,0xb2,0xe3,0x17,0xf0,0x31,0xa7,0x39,0x69,0x6b,0x67,0xdc,0x2e,0xf3,
+    0xbb,0x27,0x1c,0xfb,0x34,0xdf,0x7b,0x8e,0x39,0x85,0x22,0xd6,0x9b,0xc0,0x9f,0x04,
+    0x68,0x89,0xc0,0x7b,0xf7,0xd0,0x93,0xca,0xd3,0xac,0x39,0x1e,0x0e,0xdc,0x05,0x4a,
+    0xec,0xa6,0xb4,0x78,0xa3,0x74,0x75,0xc6,0x41,0x30,0x1d,0x5c,0x2e,0x11,0xcc,0xde,
+    0xf0,0x91,0xe6,0x36,0xf2,0xd0,0xb6,0xfc,0xd6,0xbd,0x1c,0xca,0x96,0xb9,0x22,0x37,
+    0x49,0x81,0x3e,0x29,0xe9,0x00,0x8f,0xcb,0x56,0xc6,0x1d,0x92,0x6f,0x32,0xcb,0x11,
+    0xc5,0x8e,0x21,0x98,0xb6,0x5f,0xfe,0xf4,0xbf,0x93,0x53,0xfe,0xe9,0x2d,0xa3,0xa6,
+    0x31,0x77,0xbe,0x67,0x26,0x26,0x3d,0xf8,0x3a,0xdd,0x5e,0x09,0x7d,0x13,0x09,0xb9,
+    0x93,0x1c,0xab,0x4c,0x54,0xad,0x99,0xf9,0x0d,0xe1,0xb7,0x94,0x2c,0x80,0xba,0x91,
+    0x75,0xf2,0x16,0xac,0xd6,0x80,0x9c,0x78,0x21,0xe2,0xd9,0xc4,0xf7,0x2d,0xcd,0x45,
+    0xf2,0x49,0x48,0xe8,0x31,0xb1,0x8f,0x04,0x38,0x93,0x25,0x33,0x0b,0xff,0x38,0x37,
+    0x02,0x10,0xc3,0x5a,0x1a,0x3b,0x23,0x84,0xa2,0x21,0xb1,0x9f,0x85,0x0c,0xe5,0xa3,
+    0x2c,0x89,0xb2,0x06,0x02,0x20,0xd3,0x9f,0x86,0x36,0x7a,0x62,0x72,0x40,0xb8,0xbc,
+    0x8f,0x4f,0x0b,0x01,0x06,0x0e,0x10,0xe6,0xc0,0x40,0xd4,0x58,0x63,0x99,0x2b,0x73,
+    0xc4,0x49,0x3c,0x04,0xb8,0xc1,0xaf,0x85,0xa9,0xfc,0x6c,0x23,0x22,0x83,0xaf,0xe5,
+    0x8c,0xc7,0x36,0x5e,0xaf,0x03,0x9d,0x9f,0xb8,0x36,0x89,0x92,0xce,0x14,0xe6,0x12,
+    0x8a,0x2b,0xa6,0x6d,0xd8,0x5f,0xe6,0x3c,0x30,0xcc,0xfb,0xd6,0x6a,0x1d,0xa1,0xcc,
+    0x63,0xbf,0xb1,0x2a,0x66,0x73,0x85,0xb0,0x70,0x84,0xa2,0xb5,0xbb,0xc2,0xbd,0xb2,
+    0xc8,0x99,0x56,0x04,0x54,0xa3,0xfb,0x6c,0x4e,0x20,0x75,0x36,0x1f,0x1a,0x13,0xd1,
+    0x88,0xcc,0x28,0x31,0xdd,0xab,0xe5,0xaf,0x28,0xc8,0x4b,0x9b,0xb6,0xbe,0x00,0x96,
+    0x89,0x29,0x57,0x7d,0x6a,0x78,0x7c,0xf9,0xfa,0x82,0x17,0xf5,0xee,0x73,0x49,0x5e,
+    0xb1,0x85,0x39,0x47,0x45,0x37,0xb1,0x3d,0x1b,0x13,0x26,0x58,0x82,0x24,0xb3,0x7d,
+    0x49,0x59,0x3d,0x6a,0x29,0x34,0x05,0xd2,0x1d,0x85,0xf5,0x16,0xae,0x0b,0xb3,0x35,
+    0x47,0xa8,0x9f,0x68,0xe2,0xba,0x71,0x25,0x8a,0x80,0x0c,0x1f,0x54,0x55,0x22,0x53,
+    0x7a,0x90,0x9a,0x01,0x99,0x7f,0x60,0x3a,0xa0,0xc0,0xf9,0xe1,0xcb,0x56,0x76,0x2b,
+    0x93,0x7b,0x01,0x8e,0xbe,0x89,0xf7,0x02,0x84,0xb9,0x5b,0x79,0xbb,0x50,0x67,0x45,
+    0x97,0x09,0x70,0x1f,0x85,0xb0,0x93,0x0a,0xb6,0x93,0x37,0x0d,0x88,0xb4,0x10,0x71,
+    0x66,0xce,0x0b,0xd4,0x90,0xe0,0xe8,0x89,0x0e,0x80,0x28,0x88,0x99,0x5b,0x50,0x03,
+    0x3a,0xb5,0xa7,0x7e,0x70,0x5f,0x66,0x17,0x52,0x5b,0xec,0x56,0x6f,0xf1,0xc7,0xc0,
+    0x89,0x64,0x83,0x89,0x89,0x13,0x93,0x56,0x13,0xba,0xd2,0x7a,0xd5,0xe6,0x7b,0xd5,
+    0x9b,0x3f,0xb7,0x81,0x47,0x64,0x19,0x0e,0x89,0xd8,0x40,0xa3,0xd0,0x34,0xb0,0xff,
+    0x70,0x16,0x56,0x6d,0x6e,0x7b,0x9d,0xe6,0x5c,0x9e,0x4f,0x91,0x52,0x2c,0x32,0x04,
+    0x50,0x09,0x95,0x4d,0x12,0xe3,0x0a,0x32,0x1f,0xe3,0x06,0xd0,0xd2,0xb9,0x1b,0xe5,
+    0xf3,0x01,0xd9,0xa4,0x3a,0x29,0xdc,0xc9,0xb9,0x13,0xab,0x28,0xeb,0x75,0xe2,0x86,
+    0x43,0x05,0xe7,0x44,0x96,0x34,0x4e,0x6d,0xb8,0x5a,0x70,0x4e,0xfe,0x16,0xe3,0x39,
+    0x90,0xfc,0x2f,0x50,0x4f,0x17,0x33,0x5c,0x02,0xa3,0x31,0x27,0x49,0x35,0xed,0x67,
+    0x09,0x57,0xf5,0x6b,0x11,0x70,0x49,0x74,0x8e,0xf0,0x65,0x75,0x02,0x2e,0xb8,0x54,
+    0x46,0x52,0x63,0xd8,0xc1,0x9c,0xa5,0xdf,0x90,0xf4,0x9c,0xf9,0x1b,0x33,0x5c,0x58,
+    0x83,0xae,0x1f,0x83,0x90,0x1f,0xd9,0xc2,0x51,0x70,0x35,0x69,0xb7,0x30,0x25,0x5b,
+    0x96,0xb0,0xc7,0x94,0x44,0xe4,0xf2,0xee,0xed,0xc7,0x4c,0x62,0x75,0x8d,0x5b,0x05,
+    0x6d,0x38,0xeb,0xf0,0x43,0xb5,0x6e,0xd0,0xff,0x87,0x90,0xfe,0x0a,0x49,0xa5,0x54,
+    0xc2,0x59,0x20,0x2b,0x77,0x73,0x6f,0xa2,0x57,0x6c,0x54,0x85,0xd2,0x60,0xea,0xe2,
+    0x84,0xf2,0xeb,0x3f,0xf7,0x11,0x26,0x9f,0x27,0xd5,0x31,0x09,0xf3,0xaf,0x32,0xb5,
+    0x5e,0xe1,0x34,0x4b,0x36,0xe9,0x59,0x95,0xae,0x54,0x4f,0x71,0x9f,0x34,0x37,0xec,
+    0x73,0xd5,0x79,0x00,0x07,0xc0,0x0d,0x32,0x58,0xdc,0x20,0xd0,0x48,0x52,0x6c,0x66,
+    0x16,0x48,0x99,0x15,0x78,0x20,0x32,0x7a,0x93,0x4e,0x0d,0x0f,0xd6,0xc0,0xfd,0x8b,
+    0x30,0x60,0x1c,0x6f,0xd6,0xe2,0xbf,0x12,0x66,0x4a,0xb6,0xc1,0xd8,0xaa,0xe0,0xa6,
+    0xe5,0xeb,0xf3,0x26,0x1e,0xc6,0x1a,0xbb,0x36,0xa9,0x89,0x3f,0x52,0xf9,0x88,0x95,
+    0x3b,0x38,0x61,0x22,0xa8,0xb6,0x97,0xb7,0xbb,0xe5,0x7b,0x39,0x87,0x2f,0x5a,0x67,
+    0x4b,0x17,0x1b,0xb4,0xd6,0xdb,0xdb,0x69,0xe3,0x47,0x76,0x97,0xaf,0x40,0x91,0x35,
+    0xb6,0x3a,0xbb,0x0e,0x03,0xef,0x5a,0x58,0xb5,0xe9,0xf7,0xcb,0x36,0x3d,0xda,0x55,
+    0xaa,0xec,0xb4,0x5e,0xce,0xa6,0x4f,0x5f,0x07,0x96,0xd7,0x08,0x6d,0xb3,0x5b,0x94,
+    0x0c,0x95,0xfd,0xa2,0xd9,0x68,0xd0,0xeb,0xff,0x7a,0x3b,0xbc,0xab,0xf2,0x09,0x78,
+    0x81,0x43,0xe6,0x76,0x3c,0xc5,0x68,0xda,0xde,0x2b,0xba,0x1b,0x50,0x29,0xd4,0x4d,
+    0x6b,0xdc,0x76,0xf3,0x2f,0x41,0xc9,0xdc,0xf5,0x97,0xe1,0x2b,0x76,0x06,0x5a,0x9e,
+    0xa9,0xbe,0x46,0x66,0xf8,0x6f,0xd0,0xf2,0x5e,0x4f,0x98,0x01,0x13,0xb5,0x12,0x96,
+    0x4c,0x32,0x5f,0x42,0xc5,0x98,0x95,0xcc,0xad,0x77,0xe2,0x45,0x4e,0x90,0x32,0x78,
+    0x42,0x2d,0xd5,0xfc,0x5e,0x50,0xf3,0x22,0x61,0x10,0x85,0x3a,0x19,0x43,0x7c,0x7d,
+    0x95,0x16,0x71,0xc5,0x52,0xe6,0xcd,0xd7,0xe5,0xfd,0xcc,0x5e,0x65,0xfa,0x2c,0xc2,
+    0x81,0xa4,0x29,0xb1,0x83,0xe0,0xce,0x4f,0x2e,0x4e,0x2e,0x63,0xe9,0x1b,0x58,0x53,
+    0x4e,0x0a,0x53,0xf8,0x97,0x6f,0x15,0xa2,0xad,0x2c,0x02,0x12,0x9a,0x54,0x26,0x65,
+    0x24,0xa2,0xee,0x52,0x23,0xda,0x15,0x48,0xed,0x1b,0x72,0x1a,0xb3,0x96,0x4f,0xba,
+    0xd2,0xc6,0xf9,0x19,0xbb,0x26,0x2f,0xf2,0xcb,0xb9,0x0e,0x2d,0xf7,0x96,0xa2,0x55,
+    0x63,0xed,0xe6,0xdd,0x2a,0x9d,0xc6,0xe2,0xed,0x7a,0xe9,0x46,0xd8,0xad,0xa7,0xf7,
+    0x78,0x3c,0x9a,0xd5,0x81,0x34,0x78,0xe2,0x24,0x28,0xa0,0x98,0x36,0xbd,0xde,0x12,
+    0x5a,0xcc,0x61,0x2d,0x8e,0xa9,0xf9,0x62,0x38,0xd4,0x69,0xde,0x90,0x52,0xfe,0xaa,
+    0x67,0x67,0x8a,0x2e,0x0f,0x0a,0x87,0x90,0xb3,0xda,0xd0,0x79,0xe6,0x8e,0xa6,0xeb,
+    0x83,0x4f,0x1b,0x3a,0xe6,0xbb,0x5a,0xff,0x00,0x17,0xfc,0x77,0x2e,0xf8,0x58,0x3d,
+    0x9c,0x39,0xe8,0xf9,0x99,0x46,0x47,0x9a,0xe2,0x99,0x94,0x32,0xbe,0x2b,0xa7,0x00,
+    0xb3,0xa5,0x9f,0x80,0x94,0x78,0x0f,0x6b,0xe4,0x4d,0xd6,0xe0,0x06,0x58,0x72,0x28,
+    0x35,0x39,0xc4,0x4a,0x26,0x60,0x4a,0x55,0x3e,0xcf,0xe9,0x5f,0xa8,0xba,0x61,0x29,
+    0xaa,0x78,0xef,0xe2,0x4c,0x55,0xeb,0x33,0xed,0xac,0xb7,0x9f,0x4b,0x65,0x93,0x35,
+    0x4e,0xaf,0x30,0x4d,0x43,0xf3,0xcd,0xf9,0x3a,0xd6,0xe9,0x95,0xe6,0xf7,0x1a,0x33,
+    0xb2,0x1a,0x6e,0xbd,0x42,0xd3,0x39,0x96,0x78,0x8a,0x21,0x1a,0xdb,0x91,0x79,0x85,
+    0x67,0x11,0xea,0x18,0x8e,0x9f,0x57,0x4c,0xb3,0xb5,0x3a,0xa5,0x17,0xb6,0x49,0x4f,
+    0xc5,0x00,0x2b,0xfa,0x1b,0x14,0x67,0xad,0xc2,0x36,0x28,0x6b,0xd5,0x5f,0x21,0xf9,
+    0x54,0x61,0x77,0x2b,0x04,0x49,0x63,0xbf,0x59,0x2c,0x79,0x35,0xad,0xb9,0x1a,0xbe,
+    0x0b,0x24,0x34,0x9e,0x0b,0x5c,0x62,0x23,0xb0,0x8d,0x78,0x95,0xf1,0xf3,0x86,0x16,
+    0xf8,0xb7,0x50,0x2d,0xf6,0x26,0x86,0x59,0xc1,0x83,0xe8,0x86,0xbb,0xcc,0xa7,0xf0,
+    0xe0,0xdc,0x36,0x42,0x54,0x71,0xfb,0x81,0xe6,0xf3,0xfd,0x45,0x39,0x23,0x38,0xf0,
+    0x83,0xbf,0x80,0x60,0x14,0xef,0xcd,0xb5,0x48,0xab,0xa1,0xea,0xa6,0xe7,0xa3,0xa9,
+    0x13,0x31,0x3a,0x81,0xa2,0xd1,0xe1,0x6c,0x06,0x4c,0x6a,0x7e,0x6a,0xbb,0x42,0x42,
+    0x28,0x75,0x58,0x74,0x97,0x9f,0x5c,0x9f,0x47,0x4f,0x43,0x33,0x70,0x66,0xd1,0xc1,
+    0x23,0x20,0xcc,0x61,0xa4,0x7d,0x37,0x94,0x6e,0xf5,0x7e,0xe0,0x00,0xf3,0x33,0x78,
+    0x04,0x27,0x39,0x0a,0x99,0x94,0x15,0x71,0xf8,0xf6,0x1d,0x7b,0x01,0xf2,0x1e,0xee,
+    0x54,0x3c,0x76,0xe8,0x99,0x71,0x7e,0x47,0x68,0xd4,0x1b,0x82,0xc8,0x42,0xff,0x6c,
+    0x6d,0x69,0x57,0xfe,0xad,0x06,0x33,0x70,0xaf,0xa1,0x62,0x4a,0x51,0xef,0x86,0x1a,
+    0xba,0x82,0x31,0x45,0x6e,0x68,0x87,0x21,0xb4,0xa7,0x80,0x01,0xf2,0x3e,0x1c,0x1b,
+    0x6e,0x68,0xab,0xb0,0x7f,0x34,0x48,0x69,0xc9,0x3f,0x10,0x74,0x43,0x1a,0xef,0x50,
+    0x58,0x9e,0x33,0x2d,0x2a,0xca,0xc4,0xb7,0x36,0xe9,0x97,0xc7,0x50,0xcd,0xbf,0xc5,
+    0x97,0x4e,0xa4,0x40,0xa2,0x6b,0x1b,0x86,0x3b,0x0c,0xb8,0x79,0x65,0x04,0x51,0x38,
+    0x5c,0x2c,0x07,0x8f,0x1e,0x01,0x48,0xee,0xeb,0x78,0x84,0x37,0x8c,0xfc,0xed,0xfa,
+    0x62,0xae,0xf5,0xff,0x47,0xe3,0xb9,0xc7,0x82,0xd7,0x60,0x8b,0x5c,0xd7,0xea,0x0b,
+    0xc0,0x0e,0xb6,0xd8,0xde,0xd0,0xb3,0x6f,0xd1,0x37,0x0d,0x24,0xee,0x01,0xbc,0x2d,
+    0x0e,0x42,0xc6,0xe9,0x48,0x45,0x1f,0x13,0xba,0x79,0xad,0xc8,0x3f,0xf3,0xf1,0x26,
+    0x69,0x24,0x0e,0x17,0x11,0x6a,0xf1,0x6b,0xba,0xed,0x35,0xbf,0x7d,0xae,0xd7,0x37,
+    0x75,0x4d,0xd3,0x37,0xe3,0x22,0xd8,0x50,0xb2,0x48,0x63,0x61,0x19,0xf7,0x7d,0xbd,
+    0xdb,0xb4,0x00,0xd5,0x22,0xbd,0x01,0xec,0x23,0x1c,0xa8,0x7a,0x78,0xe5,0x07,0xf0,
+    0x74,0x6f,0x1b,0x41,0x5f,0xf7,0xa0,0x4b,0x81,0x63,0xea,0x4b,0xe8,0xe2,0xf2,0x11,
+    0xb0,0x0b,0xa7,0xc8,0x84,0x02,0xd3,0x53,0xc3,0xe1,0x34,0xf0,0x62,0xf0,0xfa,0x80,
+    0x0f,0x2d,0xb1,0x86,0x17,0x3c,0x64,0xcf,0x93,0xd7,0x8b,0xfd,0xad,0x2f,0x28,0xdf,
+    0x83,0x6f,0x0e,0xbf,0x3d,0x79,0x7f,0x79,0x7a,0x79,0x76,0x72,0x31,0x5c,0xc8,0x4b,
+    0x63,0xfa,0xba,0xbc,0x7c,0x45,0xde,0xfc,0xa2,0x37,0x48,0x46,0xea,0xeb,0xa9,0xa4,
+    0xc6,0x7a,0x23,0x96,0xdf,0xfa,0x7a,0xcc,0xf8,0xe8,0x0d,0x9e,0x7c,0xad,0xaf,0xf3,
+    0x7c,0x65,0xda,0x63,0x4d,0x26,0x52,0xd3,0x1b,0x42,0x78,0xea,0xeb,0xa9,0xdc,0x34,
+    0x3a,0x6c,0x0f,0x89,0x46,0xe2,0xae,0x16,0xc7,0x22,0x5c,0x92,0x58,0xf3,0xc7,0x39,
+    0x30,0x67,0x17,0x74,0xa2,0xf8,0x01,0x88,0x83,0x35,0xbd,0x15,0xda,0x26,0xa0,0x0d,
+    0xd0,0xdf,0x13,0xc3,0xbc,0xaa,0x85,0xc3,0x03,0x35,0x40,0x85,0xa9,0xb7,0x6a,0x3a,
+    0x33,0xc4,0xeb,0xf5,0x24,0x0e,0xe6,0x40,0x83,0x95,0x54,0xa0,0x79,0xc3,0x03,0xaf,
+    0x32,0xb4,0x34,0x46,0x63,0x82,0x1e,0x7d,0x13,0x46,0xa0,0x40,0x00,0x71,0x39,0xae,
+    0x3e,0x50,0x76,0x49,0x21,0x14,0x8f,0xc1,0xc0,0xb2,0xce,0xb8,0xe6,0xd5,0xbd,0x32,
+    0x68,0x85,0x50,0xe2,0x8b,0x90,0x52,0x5b,0x4c,0x41,0x84,0xb7,0x8e,0xf5,0xee,0xe3,
+    0x47,0xc7,0xe2,0x4d,0x01,0x25,0x07,0xf1,0x44,0xb9,0xfb,0x2e,0x75,0x39,0x4f,0xa2,
+    0x18,0xbf,0xab,0x0e,0x8b,0xf0,0xe4,0xbe,0x89,0xcf,0xea,0x8d,0x3b,0xe9,0x94,0x8d,
+    0x89,0x82,0xf2,0x3a,0xb8,0x44,0xbe,0xbb,0x44,0x91,0xf8,0x02,0xb7,0x05,0x16,0x8a,
+    0xd3,0x13,0x15,0x0b,0x27,0x71,0x38,0x68,0x6a,0xf4,0x55,0x23,0xbd,0x06,0x4b,0xa0,
+    0x0b,0xca,0xbe,0xbf,0xc4,0x13,0xee,0xff,0x3d,0xda,0x8d,0xa3,0xaa,0x4d,0xc3,0x49,
+    0x83,0x78,0x2e,0xdd,0xd1,0x15,0x42,0x8e,0x57,0x3e,0xc2,0x19,0x06,0xfb,0x56,0x18,
+    0x87,0xf4,0x86,0x2d,0x1e,0x76,0xe0,0xc1,0x61,0x0f,0x9d,0xde,0x13,0x78,0xb8,0x65,
+    0x0f,0xa8,0x5b,0xc4,0x7d,0x2d,0x80,0x44,0x31,0x9e,0x9b,0x30,0xb1,0x91,0xcd,0x97,
+    0xa9,0xa6,0x03,0xa7,0xc0,0x50,0x38,0x62,0xf8,0xcd,0x4e,0x7e,0xea,0x11,0x10,0x78,
+    0xec,0x0f,0xfb,0xe8,0x78,0x9e,0x1d,0x7c,0x77,0xf9,0xf2,0x6c,0xa8,0x17,0x79,0x84,
+    0x90,0xcf,0x0a,0x6c,0x1a,0x6c,0xf2,0x2d,0xd6,0x7c,0xb7,0xa9,0xe7,0x5c,0xa8,0x21,
+    0x6f,0x8c,0xc5,0xc2,0xf0,0x07,0x0b,0x21,0xbf,0xa2,0x97,0x6e,0x24,0xc6,0xdb,0x00,
+    0x1a,0x19,0xb3,0x19,0xa0,0xf0,0xd1,0x95,0xe3,0x5a,0xb5,0x88,0x7a,0x0e,0x88,0x89,
+    0x27,0x14,0x5e,0x8b,0x57,0xab,0x0f,0x0f,0x16,0x51,0x8b,0xfa,0xd6,0x32,0xc3,0xf0,
+    0x12,0x70,0x6e,0xa8,0x57,0xb9,0x95,0x57,0xbd,0x60,0x1b,0xd5,0xee,0xad,0x5e,0xa8,
+    0x0f,0x52,0x90,0x25,0x21,0xaa,0x37,0x7a,0x5d,0x38,0x99,0x96,0x8d,0x1e,0x9d,0x50,
+    0x49,0x1c,0x65,0x02,0xe8,0x95,0xed,0xce,0x60,0x3f,0x6a,0xbf,0x55,0x9c,0xe4,0x8e,
+    0xf5,0x78,0x0e,0x14,0xad,0x49,0x0e,0x85,0xc5,0x5a,0x80,0x4e,0xcb,0x18,0x8e,0xe0,
+    0x97,0xd3,0x07,0x4a,0x29,0x2c,0x41,0xef,0x39,0x38,0x95,0x0a,0x49,0x87,0x90,0xc5,
+    0x7b,0x74,0x55,0x63,0x7e,0x33,0x6f,0xc8,0x51,0x6e,0x20,0x7d,0xd7,0x88,0x6c,0x94,
+    0x9d,0x36,0x53,0x5f,0x39,0x6c,0xfc,0xe1,0x81,0x8f,0xdd,0x3f,0xb9,0x81,0xd2,0xd8,
+    0x3e,0xba,0x2e,0x20,0x63,0x04,0x7c,0x07,0xec,0x35,0xc0,0x28,0x68,0xdd,0x6e,0x45,
+    0x98,0x0c,0x21,0x82,0x3e,0xf8,0x79,0x6d,0xfb,0xc5,0xdd,0x57,0xba,0xb5,0xac,0x27,
+    0xf9,0x98,0xc3,0x37,0xa7,0x1c,0x53,0x7e,0xab,0x44,0xed,0x91,0x81,0xe9,0x87,0x34,
+    0xb9,0xde,0xc6,0xcc,0xa9,0x01,0xbd,0x6f,0x80,0x18,0x1a,0xd2,0x8a,0x47,0xc1,0xfd,
+    0x82,0xf8,0x49,0x46,0x89,0x82,0xa1,0x71,0x0b,0xdc,0xbe,0x46,0x12,0x7c,0xed,0xbb,
+    0x4d,0x59,0x76,0x40,0x85,0x58,0x08,0x8b,0x16,0xe0,0xd3,0xd2,0xc4,0x14,0x3f,0x35,
+    0xbb,0xbe,0x60,0x04,0x52,0x7f,0x65,0x47,0xb7,0x7e,0x70,0xad,0xd9,0x18,0x8f,0xdc,
+    0x07,0xf2,0x64,0xb7,0xa6,0x20,0x60,0xc0,0x11,0xdb,0xd0,0xf1,0x20,0xe6,0x95,0x3d,
+    0x90,0x47,0xe2,0x83,0xe3,0x7f,0xfe,0x8f,0xdf,0xc9,0xff,0x71,0xb4,0xf1,0xbd,0x85,
+    0xbf,0xb3,0xb1,0xa3,0xb8,0x07,0xfb,0x2f,0x42,0xb5,0x4b,0x38,0x24,0x0c,0x60,0x52,
+    0x2a,0xbe,0xd4,0xb6,0x00,0x2b,0xb7,0xc8,0x4b,0xa2,0xa1,0x5d,0x63,0xea,0x4b,0x73,
+    0x1e,0x90,0x97,0xdb,0xe8,0x5e,0xe3,0xf7,0x30,0x69,0x36,0xee,0xfe,0x30,0x8d,0xce,
+    0x29,0xde,0x2b,0x3e,0x96,0x05,0x1e,0x23,0xbe,0xeb,0x31,0x7c,0x49,0xad,0xbe,0x08,
+    0xea,0x0c,0x1d,0xe3,0x43,0xd8,0xe2,0x55,0x02,0xb2,0x5f,0x30,0xee,0x2a,0xee,0x33,
+    0xb1,0x7f,0x01,0x85,0x12,0xd3,0x8b,0x1a,0xe3,0x3d,0x61,0x08,0x78,0x65,0x28,0x97,
+    0x65,0x49,0x02,0x76,0xfd,0x09,0xd6,0x84,0xb7,0xec,0xc2,0xb4,0x23,0xfc,0xc4,0xc1,
+    0xc1,0x4b,0xbc,0xfb,0xea,0xcc,0x9f,0xc4,0x2f,0x30,0xd9,0xe7,0x73,0x23,0x60,0x10,
+    0x61,0x57,0xc8,0xc1,0x25,0x5b,0x5b,0x94,0xf2,0xd4,0xec,0x82,0xc3,0x14,0x1b,0x67,
+    0xb5,0xe8,0xed,0xc7,0x8f,0x7a,0xbb,0xfc,0xf4,0x96,0xb7,0x09,0x66,0x00,0xf0,0xf7,
+    0x55,0x40,0xb0,0x4c,0x76,0x19,0x08,0xec,0x75,0x15,0x00,0x78,0xdc,0x67,0xaa,0xe3,
+    0x4b,0x59,0x99,0x73,0x4b,0xa4,0x44,0x90,0x83,0xeb,0xc4,0x5f,0xd0,0xa3,0x6d,0x88,
+    0x91,0x26,0x2d,0xb2,0x63,0xd4,0x6a,0x35,0x39,0x82,0x4d,0x06,0xaa,0xbe,0x45,0xb5,
+    0xea,0xdf,0x74,0x88,0x33,0x58,0x31,0x27,0xd9,0x0e,0xe1,0xab,0x4d,0xfd,0xeb,0x84,
+    0xd9,0x1f,0x4b,0xad,0x9a,0x9b,0x1c,0x50,0x4a,0x3f,0xc5,0x2c,0xb1,0xce,0x51,0xdf,
+    0xa8,0x91,0x11,0xa5,0xda,0x29,0x07,0x9e,0xb8,0xa8,0x2c,0xd5,0x44,0x76,0xf8,0x9b,
+    0x3a,0xbb,0x17,0x4c,0xe7,0xc8,0x8b,0x19,0x5f,0x35,0x76,0x59,0x93,0x9c,0x45,0x7c,
+    0x1c,0xd2,0x3d,0x4f,0x0d,0x7e,0xeb,0x13,0xbe,0x69,0xd6,0xf0,0xbf,0xdf,0xe0,0x40,
+    0xb6,0x56,0x4e,0x9e,0x72,0x07,0x14,0x74,0x09,0x40,0x80,0x64,0x43,0x49,0x96,0x6d,
+    0x92,0x3a,0x92,0x97,0x4a,0xe9,0xbc,0x99,0x0a,0x20,0x71,0x70,0xf9,0x2b,0x52,0x3e,
+    0x49,0x41,0x73,0x56,0x84,0xda,0x2b,0xea,0x19,0x05,0x08,0xbd,0xa2,0x9a,0x9b,0x8b,
+    0xc8,0x7c,0xd2,0x79,0xe6,0x69,0xc7,0xb3,0x30,0x03,0x85,0x1f,0x84,0x65,0xb0,0xc4,
+    0x15,0xc9,0x7a,0x5d,0x95,0x00,0xf0,0x96,0x3c,0x7d,0x13,0xd6,0xd7,0x8b,0x66,0x98,
+    0x4b,0xd0,0xb6,0x9e,0xe9,0x13,0xbd,0xaf,0x1b,0x2b,0x04,0x5e,0x71,0xab,0x72,0xa6,
+    0x7b,0x0a,0x1c,0xca,0xe6,0x48,0xbf,0x01,0xe0,0x2b,0x1f,0xd3,0x14,0xea,0x82,0x58,
+    0xbd,0x71,0x6c,0x46,0xcf,0xe4,0xfc,0x35,0xc4,0x8c,0x34,0x38,0x8a,0x11,0x11,0xcb,
+    0xa1,0xd3,0x09,0x6a,0x58,0x46,0xa9,0xd1,0xea,0xfd,0x9e,0x12,0xfa,0x3d,0xc3,0x74,
+    0xef,0xc3,0xbd,0x75,0xa9,0x36,0x47,0xe3,0xe8,0x6e,0x58,0xb2,0x6b,0xf8,0xed,0x92,
+    0x30,0x11,0xf0,0x8d,0xe6,0xe1,0x0e,0x78,0x98,0xae,0x25,0x1b,0x63,0x24,0xbd,0xc5,
+    0x8a,0xd5,0x13,0x4f,0x2d,0xcb,0x46,0x2c,0xbe,0xe7,0xcd,0xa9,0x9f,0x48,0xaf,0xc7,
+    0x06,0x09,0x1d,0x68,0x2c,0x50,0xd0,0xea,0xeb,0x23,0x23,0xd0,0x1b,0x68,0x62,0xef,
+    0x2f,0x48,0xcb,0x1e,0xf6,0x71,0xb2,0xf0,0x07,0xbd,0x05,0xe4,0x0f,0xfb,0x6f,0x89,
+    0xc3,0x62,0xdf,0xfb,0x3a,0x37,0x3a,0xf0,0x5a,0xf1,0x6c,0xc7,0x56,0xda,0x23,0x32,
+    0xc8,0xea,0x64,0xab,0x6d,0x37,0xba,0xbd,0x76,0xa3,0xd3,0xd9,0x6f,0xb4,0xf6,0xea,
+    0x7a,0x83,0x99,0x7b,0x79,0x81,0x2f,0xdb,0x6d,0x7b,0x77,0x6f,0x57,0xbc,0xfd,0x91,
+    0x59,0x9d,0xf9,0xd3,0x39,0xf3,0x59,0xd8,0x5e,0x36,0x12,0xad,0xa3,0x0d,0x43,0x36,
+    0x8d,0xab,0x5a,0xd0,0x2e,0xda,0x88,0x3b,0xfb,0xbd,0x46,0x3b,0xaf,0xdd,0xf1,0x78,
+    0xb4,0xd7,0x6e,0xaf,0xd5,0x2e,0x33,0xa9,0xc8,0x96,0x39,0x62,0x15,0xb7,0xcd,0xed,
+    0xd3,0x3b,0x39,0x6d,0xf7,0xac,0x9d,0xbd,0x15,0x6d,0x43,0xd3,0xef,0x96,0x0d,0x66,
+    0x91,0x09,0xfb,0x0b,0x98,0xe1,0x19,0xfc,0x80,0xf3,0xb9,0x8f,0x16,0xd9,0x06,0x06,
+    0xf9,0x46,0xf0,0xef,0x61,0x38,0x03,0xd9,0xe4,0x1c,0xf5,0x20,0x7d,0x52,0x81,0x37,
+    0x66,0xee,0x7c,0xe2,0x60,0x15,0xd7,0x9e,0xc0,0x31,0xd0,0x5f,0xc8,0xd8,0x12,0xfc,
+    0xbc,0xe4,0x83,0x0a,0x51,0xf3,0x0a,0x85,0xee,0xfa,0x0b,0x60,0x3e,0xcc,0x6b,0xdb,
+    0x62,0x70,0xd1,0x44,0xd5,0x5f,0x98,0xca,0x50,0x60,0xed,0xb6,0xf7,0x1b,0xfb,0x6d,
+    0x1a,0xc9,0xb2,0x81,0x1a,0xd5,0x50,0x96,0xf8,0x72,0x6f,0xff,0xc9,0x13,0x63,0x5f,
+    0x6f,0xa0,0x2c,0x0f,0xa0,0x58,0x78,0xc7,0x52,0xb4,0x22,0xfe,0xb9,0xff,0x95,0x5a,
+    0x81,0x7f,0x52,0x7c,0x49,0x82,0x0e,0xcc,0x1a,0x46,0xc3,0x55,0xb6,0xf3,0xaa,0x5d,
+    0x37,0x73,0xec,0x95,0x5b,0x0e,0xca,0xd4,0xe3,0x9f,0xb9,0x9b,0x0d,0xde,0xe7,0xef,
+    0x34,0xcb,0x9f,0x4f,0xae,0xbc,0x79,0x94,0xda,0x6e,0x6f,0xe3,0x0d,0x25,0x91,0x8c,
+    0x61,0xf9,0x3b,0x65,0x07,0x2e,0xa8,0xce,0x5b,0x1a,0xd3,0xbb,0x0c,0xda,0xbd,0x8d,
+    0xb7,0x52,0x8c,0x60,0x12,0xcd,0xdf,0xa5,0x30,0xb0,0x03,0xbb,0xb1,0x9b,0xc2,0xc0,
+    0xde,0xf2,0x1d,0x5f,0xb5,0x07,0x20,0x9d,0x39,0x8f,0xfc,0x79,0xd4,0xd7,0xf7,0xda,
+    0x5f,0xeb,0x2b,0x31,0x90,0x16,0x4d,0xae,0x89,0xef,0x86,0xc3,0x15,0xbd,0x8f,0x4b,
+    0xbb,0x23,0x2a,0x5d,0x38,0x5f,0x71,0x49,0xbc,0xf6,0x78,0xc8,0x67,0xab,0x5c,0xcd,
+    0xca,0xee,0xb5,0x85,0x85,0x8f,0xf5,0x54,0xd8,0x4c,0x6b,0x6a,0xcc,0x6a,0x35,0xb7,
+    0xe1,0xd4,0x87,0x07,0x1f,0x12,0x7a,0xab,0x55,0x81,0xa6,0x18,0x76,0xc8,0xae,0x84,
+    0xcd,0x46,0x49,0xee,0xc5,0x51,0x92,0x7b,0xd2,0xf7,0x45,0x8d,0x87,0x54,0x3c,0x5d,
+    0xbe,0x42,0xfc,0x0f,0xdf,0x3a,0xef,0x96,0x2c,0x5c,0x31,0xbc,0x0a,0x1c,0xef,0xba,
+    0xdf,0x96,0x7e,0xd8,0x5f,0x2d,0xdc,0xa5,0x56,0xfb,0x6a,0x81,0x63,0xc5,0x62,0x22,
+    0x97,0xe2,0x87,0x7a,0xeb,0x27,0xdf,0xf1,0x6a,0xba,0xce,0x76,0x07,0x49,0x38,0x8c,
+    0xb5,0x27,0x4b,0x5d,0xce,0x01,0x28,0x39,0xff,0x55,0x87,0xdf,0x33,0xb4,0x71,0x0f,
+    0x1f,0x63,0xf4,0xf5,0xf0,0x31,0x0b,0x05,0x83,0xbf,0x74,0x01,0xd0,0xb0,0xec,0x2c,
+    0xc4,0xba,0x79,0x42,0x0c,0xef,0x16,0x7e,0x6e,0xb1,0x7b,0xd6,0x6a,0xee,0xf0,0xc0,
+    0x6d,0x71,0xd0,0xc3,0xa1,0x5c,0xec,0x8f,0x1f,0xd5,0xb7,0x67,0x8c,0x69,0x0d,0x5d,
+    0xc7,0xb4,0xe1,0x88,0xe9,0x30,0xa6,0x8f,0x89,0x25,0x8a,0x18,0x93,0x95,0x59,0x72,
+    0x46,0x6a,0xbb,0xc5,0x64,0x41,0xdc,0x92,0xab,0xaa,0xfe,0x29,0x5e,0x70,0xc8,0xbb,
+    0x8e,0xaf,0x6d,0x57,0x41,0x1e,0xfa,0xda,0x72,0x6d,0x6f,0x12,0x5d,0x3d,0x63,0x0f,
+    0x88,0x4a,0x30,0xaa,0x0f,0x8f,0xf2,0x6e,0xe4,0x45,0xdc,0xc9,0xf5,0xb8,0xc0,0x8f,
+    0xc6,0xcd,0x06,0x2e,0x73,0x0b,0xd5,0xdb,0xad,0x10,0x6f,0x83,0xae,0xe9,0x1a,0x8c,
+    0x1b,0x21,0xa2,0xa5,0xe3,0x6d,0xfb,0x5d,0xbc,0xd8,0x72,0x36,0xba,0xf5,0x65,0xc6,
+    0xb6,0x7e,0x90,0x06,0x4d,0x0e,0x12,0x12,0xf8,0x32,0x7b,0x5d,0x03,0x16,0x62,0x51,
+    0xf6,0x58,0x08,0x7f,0x2d,0x57,0x04,0x96,0x63,0x0d,0x6e,0xe7,0xc7,0x12,0x58,0x0d,
+    0x1f,0x0b,0x60,0x53,0xae,0x63,0x2a,0x64,0xca,0x5b,0x8a,0x96,0xd9,0x68,0x67,0x25,
+    0x54,0x82,0x32,0xc3,0x7c,0xb5,0x98,0x5e,0x3f,0x37,0xac,0x89,0x5d,0x13,0xf8,0x50,
+    0x5f,0x16,0x5c,0xf0,0xa0,0x6c,0x84,0xbe,0x5e,0xed,0x96,0x63,0xd4,0xe8,0xfe,0x0a,
+    0xb7,0x1c,0xeb,0xd9,0x63,0x4a,0xca,0xd6,0x24,0xfd,0x13,0x3a,0x22,0xff,0xed,0x4c,
+    0x67,0xae,0xad,0x71,0x1a,0xc3,0xbc,0x54,0x84,0xca,0x81,0x0a,0x6a,0xbf,0xfc,0xe9,
+    0x5f,0x31,0x0b,0xcb,0x0c,0xe8,0x06,0xae,0x89,0x36,0x0a,0x6c,0xe3,0x9a,0xd2,0x24,
+    0x53,0x61,0x56,0x08,0x50,0x7d,0x06,0x23,0x8f,0x18,0xd0,0x1f,0x29,0x77,0x57,0xe0,
+    0xdf,0x61,0xac,0xb5,0xcd,0xca,0x91,0xe9,0x9d,0xe9,0x03,0x0a,0x91,0x5f,0x5e,0x82,
+    0x9c,0xa0,0x8e,0x7a,0x71,0x2c,0x7a,0xd5,0xa9,0x3a,0x63,0xa1,0x37,0xad,0x56,0x4b,
+    0x51,0xe0,0xaf,0x43,0x68,0x5a,0xd1,0x95,0xed,0xd5,0x82,0xe1,0x81,0x20,0x26,0xfc,
+    0x0d,0x91,0x99,0x03,0x55,0x6b,0x88,0x00,0xf0,0xcc,0x48,0x67,0x88,0x80,0x33,0x43,
+    0xc9,0x09,0x01,0x4f,0x4a,0x16,0x08,0x78,0xe2,0x79,0x1f,0xf0,0x88,0x49,0x64,0x7a,
+    0x60,0x67,0x8c,0x00,0x7e,0x15,0x4d,0x81,0x76,0x60,0x0b,0xb4,0x23,0x2d,0xd1,0xb4,
+    0x6c,0x3c,0xc8,0x52,0x36,0x1a,0xd1,0x70,0x68,0x71,0xb5,0xa5,0x2c,0x3a,0x1b,0x5a,
+    0xc1,0x43,0x48,0x20,0xa3,0x34,0x49,0x60,0x33,0x33,0x42,0x68,0x9c,0x08,0xa9,0xd2,
+    0xfc,0x6c,0x4b,0xbe,0x27,0x59,0xbe,0xdf,0x16,0x35,0x19,0xc5,0xfe,0x90,0x48,0x4f,
+    0x01,0x6b,0xdf,0x0c,0xfc,0xdb,0xa4,0xb7,0x1a,0xbd,0x25,0xde,0x05,0x37,0xa3,0xa5,
+    0x90,0x25,0xa0,0x46,0x39,0x7b,0x9d,0xca,0x8f,0x26,0x39,0x40,0x72,0x02,0x6c,0xbf,
+    0x5a,0x40,0xdf,0x97,0x5f,0x17,0x5f,0x22,0x43,0x15,0x29,0x04,0x98,0x17,0x55,0x0b,
+    0x7e,0x60,0x83,0x59,0xaa,0x07,0x20,0xbe,0x58,0x13,0xc3,0x71,0x59,0x3f,0x7e,0xfc,
+    0x0c,0x78,0x0e,0x24,0x01,0xd9,0x36,0x05,0xc9,0x97,0xb1,0xcd,0xe7,0xf7,0xa5,0x5e,
+    0xa6,0x6b,0x9e,0x7f,0x67,0xe3,0xc6,0xe1,0x4a,0xfb,0xba,0x76,0xeb,0x44,0x57,0x71,
+    0x14,0x36,0xee,0xb7,0xe0,0xbe,0x85,0x45,0x2e,0x59,0x5c,0xea,0x14,0xc8,0xd3,0x1d,
+    0x26,0xc6,0xc2,0xac,0x58,0x2c,0xf8,0xdf,0xb2,0x2d,0x2d,0x40,0x6e,0x91,0x27,0xcd,
+    0x06,0x62,0xe2,0x78,0x5a,0x4d,0x5a,0xf8,0x31,0x29,0x96,0x8d,0xbe,0x52,0x37,0x76,
+    0x60,0xb8,0x08,0x0b,0xea,0x89,0xe3,0x82,0x92,0xf5,0x86,0x70,0xb4,0x34,0x00,0xe8,
+    0x3c,0x44,0x87,0x27,0x40,0x7f,0xea,0xcb,0xdf,0x5f,0xbc,0x7e,0x55,0xab,0xb3,0x60,
+    0x59,0x32,0x7c,0xbc,0x7d,0xa7,0x85,0x8e,0xcb,0xe2,0x82,0x1e,0xb1,0x13,0x83,0xfa,
+    0xa7,0xcd,0x67,0x58,0xea,0x03,0x3e,0x38,0x76,0xf8,0x41,0xc3,0xf3,0x5c,0x0c,0x45,
+    0x23,0x8f,0x1c,0x74,0xfa,0x82,0x93,0x2a,0xf4,0x79,0x78,0x78,0x88,0x7e,0x61,0x94,
+    0x69,0x17,0x87,0x1e,0xb6,0xf2,0xd8,0x4d,0xe6,0x70,0xc0,0x81,0x0e,0x7b,0xa5,0x5c,
+    0x27,0xf7,0x53,0x88,0x59,0x4b,0x46,0x62,0xe1,0x37,0xaf,0x7f,0xd0,0xae,0x2f,0x58,
+    0x25,0x94,0xba,0xde,0xc0,0xe1,0xe6,0x84,0x76,0xcd,0xbf,0x1e,0x1e,0x28,0x46,0x58,
+    0x9f,0xfb,0x04,0x49,0x53,0x4f,0xa6,0x1b,0xcd,0x0e,0x1a,0xff,0x10,0x34,0xb7,0x19,
+    0x1d,0xf9,0x73,0xd7,0xd2,0x30,0x4b,0x19,0x85,0x09,0x53,0x3f,0xe8,0xf4,0xa5,0x53,
+    0x5e,0xa4,0x52,0x83,0x6e,0x7b,0xcc,0xa5,0x48,0x67,0xa6,0x24,0xc5,0x18,0x45,0x1b,
+    0x1e,0xb9,0x5c,0x60,0x06,0xe6,0xd2,0x51,0x8e,0x19,0xb6,0xd8,0x73,0x8a,0x23,0x8e,
+    0xed,0x56,0xb2,0xf8,0x92,0x1d,0xe1,0xa7,0x63,0x74,0x5f,0x9b,0xf8,0x18,0x5e,0xcf,
+    0x73,0x8b,0xd3,0x54,0x8f,0xe6,0x40,0xed,0x31,0x7f,0xad,0x3f,0x0f,0xdd,0x7b,0xed,
+    0x4a,0x74,0xb4,0xa1,0x39,0x91,0x0e,0x4b,0xe0,0x5c,0x63,0xe6,0x36,0xa8,0x73,0x71,
+    0xcc,0x00,0xf1,0xac,0x12,0xb8,0x12,0x4e,0x18,0xce,0x6d,0x1a,0x11,0x5b,0xeb,0x91,
+    0x3d,0xf6,0x03,0x1b,0x7a,0x87,0x09,0x28,0x00,0x5b,0x70,0x3d,0x59,0x53,0x2c,0xb8,
+    0xb5,0xc5,0x96,0x80,0x05,0x60,0xb0,0x33,0x04,0xce,0xa1,0xb6,0xf6,0xf8,0xb1,0x26,
+    0x97,0x02,0x1f,0x84,0x5b,0x20,0x2f,0x83,0xeb,0x43,0x93,0x52,0x65,0x91,0x9e,0xd0,
+    0x1a,0xa9,0x06,0xbd,0xdc,0x85,0xe2,0x13,0x2b,0x1d,0x10,0xa9,0x4f,0xb1,0x04,0xc0,
+    0xca,0x8b,0xaf,0xe5,0x6a,0x47,0x0a,0xff,0x2d,0xd4,0x62,0x66,0xc6,0xc2,0x74,0x99,
+    0x81,0x5e,0x05,0x68,0x56,0x99,0x99,0x05,0xf7,0xe1,0xab,0x45,0xea,0xe5,0x92,0xe2,
+    0x64,0x32,0xaf,0x0f,0x3a,0xcf,0xf4,0x10,0x9a,0xd6,0x97,0x34,0x25,0xb6,0xf5,0x81,
+    0x34,0xa0,0x94,0x1d,0x50,0x86,0xd8,0xe8,0x79,0x22,0x0f,0x9b,0x0d,0x44,0x17,0x65,
+    0xa3,0xa1,0x0e,0xa6,0x58,0xec,0x91,0x97,0x54,0xb3,0x71,0xe2,0x2f,0x55,0x3e,0x46,
+    0x53,0x35,0x67,0x2e,0xe8,0x37,0x32,0x3f,0xf3,0x3c,0x01,0x67,0x6e,0xa6,0x32,0xee,
+    0x9d,0x58,0x0e,0x91,0xa0,0x9a,0xfe,0xd5,0x62,0xce,0x24,0x0f,0x19,0x49,0x91,0xae,
+    0xca,0xa5,0x9f,0xf9,0x67,0x90,0x7e,0x14,0xa0,0x42,0xee,0x99,0xab,0x72,0x4f,0x7e,
+    0x51,0xbc,0xa3,0x1b,0x0b,0x3a,0x16,0x70,0x03,0xcd,0xa6,0x9e,0x2c,0x1c,0x0b,0x22,
+    0xf3,0x16,0xa6,0x49,0x83,0x32,0x3c,0x3f,0x1a,0x50,0x02,0x7c,0xa1,0xd7,0x97,0xe5,
+    0xc1,0x45,0x79,0x9c,0x84,0x22,0xee,0xf4,0x8a,0x33,0x4c,0x61,0xaf,0x90,0x77,0x81,
+    0x36,0xf5,0xd2,0x21,0x18,0x66,0x14,0x56,0xcd,0x65,0x74,0x17,0xaa,0x49,0x6c,0xd1,
+    0xa8,0xd9,0x42,0x07,0x04,0xd8,0xac,0x33,0x83,0xb9,0x4a,0xa2,0xb7,0x42,0xf1,0x22,
+    0xca,0xe0,0x05,0xfc,0x5e,0x39,0xb7,0x90,0xb5,0x5e,0xdb,0xc7,0x36,0xbf,0xd0,0x3b,
+    0xd3,0xb6,0x08,0x06,0x5e,0x91,0x46,0xb1,0x50,0x28,0x94,0x81,0x8a,0xc5,0xf9,0x69,
+    0xca,0x12,0x63,0x63,0xda,0x21,0xd8,0x8f,0xec,0x98,0x08,0x78,0x9e,0x43,0x38,0xbf,
+    0x41,0x12,0x14,0x29,0x5b,0x36,0x36,0xb5,0x43,0xcb,0xa2,0x28,0xec,0x0d,0x3c,0x56,
+    0xd9,0xae,0x6d,0xe5,0x8a,0x88,0xea,0xa5,0xf3,0x14,0x3e,0xc3,0x5c,0x9c,0x69,0x07,
+    0xd3,0xd9,0x87,0x56,0xa9,0xc5,0x5b,0x7d,0xce,0xaf,0x5f,0x06,0x9c,0x1b,0x53,0xb6,
+    0x3e,0xfa,0x81,0xb8,0xa1,0xbf,0x93,0x7e,0x2a,0x0e,0x4a,0x26,0x5c,0xd9,0x31,0x2c,
+    0x71,0xa4,0x19,0xa0,0xaf,0xca,0x84,0x08,0x20,0x08,0x18,0xa7,0xaf,0xde,0x7c,0x7f,
+    0xa9,0x3f,0xb3,0x65,0x2c,0x51,0x1f,0x76,0x21,0xbf,0xfd,0xe0,0x14,0x08,0xcb,0xdd,
+    0xb0,0x3d,0x58,0xb2,0x43,0x93,0x2b,0x46,0x4a,0x08,0x8a,0xe8,0x26,0x8f,0x4c,0x22,
+    0xf7,0xdf,0x5b,0x3b,0x38,0x32,0x42,0x5b,0xb5,0x8c,0x04,0xc5,0x20,0xf8,0xf0,0x38,
+    0x00,0xd5,0xcc,0x52,0x52,0x85,0x26,0x42,0xa9,0x92,0x77,0x3e,0x08,0xa9,0x0b,0x28,
+    0x18,0xe1,0x49,0xed,0x8b,0xf0,0xe3,0xc7,0x1a,0x43,0x2e,0xdc,0x60,0xf5,0x64,0x67,
+    0x81,0x10,0x9a,0x2e,0xec,0x73,0x90,0xdc,0xeb,0x54,0x8e,0xc8,0x43,0x59,0xa9,0xfa,
+    0xe3,0xc7,0x1c,0x70,0xf0,0xf1,0x23,0x23,0x16,0x30,0xbf,0x01,0xbc,0xae,0x7d,0x61,
+    0xe1,0x1b,0x29,0x13,0xd6,0x53,0x3a,0x2b,0xc4,0x78,0x40,0x19,0x96,0x83,0x66,0x51,
+    0x7e,0xe2,0x28,0x19,0x37,0xd3,0x3e,0x93,0x9b,0x71,0xe2,0xcd,0x57,0x70,0xfc,0x22,
+    0xb8,0x72,0xa3,0x24,0xcb,0x64,0xa9,0x86,0x91,0x95,0x97,0xc6,0x83,0x22,0x51,0x36,
+    0xe9,0xf9,0x0f,0x2f,0xde,0xcf,0x67,0x28,0xd1,0x9f,0xc4,0xef,0xcf,0x50,0x84,0x64,
+    0x6b,0xaf,0xe4,0x62,0x65,0x2e,0x5a,0xd9,0x59,0x90,0x34,0x07,0x3b,0xa6,0x9c,0x63,
+    0xf3,0xa1,0xb2,0x8c,0x20,0xe1,0xde,0x0d,0x0f,0xee,0x68,0xe5,0x60,0x3e,0xa9,0xa8,
+    0x60,0x1c,0xe7,0x8a,0x4e,0xf2,0x61,0xb3,0xf8,0xcb,0xbf,0xff,0x0b,0x91,0x36,0x4a,
+    0xac,0xa4,0x6f,0x22,0xf4,0x75,0x26,0x91,0x21,0x54,0xf5,0x89,0x14,0x88,0xc5,0x07,
+    0xc0,0xf0,0xa6,0x5e,0x52,0x57,0xdd,0x1e,0x43,0x56,0x5c,0xd6,0x45,0x0c,0x2b,0xab,
+    0xab,0xee,0x93,0x21,0x2b,0x9e,0x5e,0xc6,0x79,0x8b,0x78,0x8d,0x8f,0x1f,0x1f,0xba,
+    0x9e,0x29,0x41,0x20,0x4e,0xae,0xa4,0xc4,0x1e,0xe0,0xc2,0x55,0x9c,0xd0,0x16,0x70,
+    0x83,0x53,0x95,0x76,0x94,0x32,0x34,0xca,0xcc,0x2a,0x15,0x11,0x31,0xd8,0x36,0xff,
+    0x02,0xdd,0x0c,0x85,0xb7,0x18,0x46,0x9b,0xa1,0xbf,0xcc,0xe9,0x31,0x45,0x8c,0x88,
+    0x8c,0x8a,0xba,0xea,0x2c,0x46,0x74,0x0f,0xdd,0xfb,0xe2,0x19,0x78,0xda,0x79,0xfc,
+    0xf8,0x8b,0x24,0x3a,0x02,0x4d,0x99,0x27,0xd0,0x51,0x36,0xf2,0xc6,0xb5,0x31,0xa6,
+    0x99,0x55,0xd7,0x0c,0x90,0x32,0x6c,0x74,0x38,0xc2,0x00,0x18,0x8a,0x93,0x76,0xa6,
+    0xc6,0xc4,0xce,0xb6,0x08,0x2c,0xfc,0xf1,0x73,0x9a,0x3b,0x60,0xf6,0xd1,0xa1,0x95,
+    0xae,0xdc,0x61,0x50,0xde,0x8b,0xc0,0x17,0xe4,0xe9,0x31,0xae,0x17,0x65,0x06,0x4c,
+    0x27,0xc7,0x7c,0x29,0x1f,0x49,0xd1,0x86,0x02,0x03,0x18,0x06,0x6f,0xea,0x2c,0x57,
+    0x0c,0xb4,0xc4,0xa5,0xac,0x6c,0x06,0x2d,0xd2,0xce,0x11,0xf3,0x9e,0xf0,0x16,0x4f,
+    0x6f,0x51,0x79,0x34,0xcb,0x2d,0x2a,0xe2,0x81,0x56,0x22,0xbe,0x48,0xb2,0x91,0xda,
+    0x72,0xa2,0x9e,0x82,0x4f,0x94,0x52,0x22,0x0f,0x9d,0x52,0xb9,0x22,0xca,0x44,0x4a,
+    0x8b,0xca,0xbc,0xc7,0xc1,0x3d,0xa3,0xb5,0xd1,0x37,0x29,0x7b,0x86,0xfd,0xfd,0xf9,
+    0x29,0xea,0x09,0x7d,0x8c,0xf8,0xaf,0xf1,0xce,0xd7,0x05,0xa2,0x04,0x62,0xe9,0xf8,
+    0x07,0x98,0x39,0x06,0x08,0xe7,0xee,0x16,0x3a,0x95,0xc9,0x7c,0x31,0xc8,0x4e,0x5a,
+    0xca,0x2b,0x9d,0xe5,0x80,0x54,0x33,0x5c,0xfd,0x06,0xfc,0x36,0xe3,0x55,0x2f,0x24,
+    0x02,0xd5,0x8c,0x2b,0xe9,0xa4,0x8f,0x52,0xca,0xb7,0xdd,0xba,0xed,0x26,0x30,0x41,
+    0xd9,0x65,0x28,0x83,0xfd,0xf2,0xef,0xff,0x8a,0x4e,0x9c,0xf1,0x4b,0x58,0x8c,0x78,
+    0x12,0x41,0x6e,0x53,0xcb,0x0b,0xc1,0x89,0x42,0x8f,0x30,0xc2,0x0c,0x1f,0x92,0xe8,
+    0x9b,0xf1,0xca,0x5d,0x48,0xe2,0x97,0x8c,0x30,0xe3,0xcb,0x77,0xe6,0x7b,0x93,0xe6,
+    0x0c,0xbe,0xf6,0x49,0x4a,0xe6,0xba,0x00,0x0c,0x30,0x04,0x59,0x0c,0x38,0x2e,0xa1,
+    0x7c,0xd1,0xa0,0x7d,0xc7,0x4d,0x86,0xa4,0x45,0xc6,0xb5,0xed,0x69,0x35,0x3f,0x40,
+    0x40,0x9d,0xb6,0x16,0xd2,0xa5,0x1a,0xf5,0x06,0xaa,0x50,0xe2,0xd8,0x34,0x83,0x6f,
+    0x6a,0x42,0x0a,0xd3,0x0f,0xa3,0x90,0x48,0x83,0x80,0x8b,0x7e,0xbf,0x1c,0x66,0x4b,
+    0x09,0x62,0x3b,0x9f,0x7b,0x78,0xdc,0xa6,0xb6,0xc6,0x7b,0xec,0x29,0x1b,0x1d,0xf3,
+    0xef,0xa9,0x31,0x4f,0x33,0x65,0x8f,0x40,0xbd,0xcd,0x4d,0x09,0x83,0x7b,0x40,0x1a,
+    0x80,0xba,0xfe,0x4c,0xc3,0x5c,0x14,0x14,0x29,0xc9,0x2c,0x07,0x38,0x18,0x8c,0x59,
+    0xc4,0x00,0x6e,0x31,0x2c,0xe0,0xaa,0x42,0xae,0xe8,0xc0,0xd2,0x43,0x82,0x8f,0x8b,
+    0x49,0x37,0xa3,0xd5,0x12,0x33,0xf9,0xf8,0x31,0xb6,0x36,0x1c,0xca,0xd6,0xea,0x79,
+    0x5e,0xbe,0xf1,0x6e,0xe5,0xb4,0x8d,0x29,0xbe,0x9f,0xe1,0x47,0xd8,0xaf,0xd8,0xca,
+    0xa6,0xfe,0x38,0x62,0x9a,0x83,0x21,0xea,0x76,0xda,0x42,0xf9,0x82,0x7b,0x75,0xee,
+    0x7d,0xa1,0xb6,0x10,0x1f,0xfd,0x52,0x8b,0x94,0x75,0xc4,0x56,0xa8,0x6c,0x99,0x0b,
+    0x0f,0x4d,0xcd,0xf7,0xe2,0x52,0xb7,0x3e,0xcc,0x07,0xef,0x45,0x43,0xf3,0x83,0x04,
+    0x3a,0x18,0xa8,0x3e,0xd2,0x42,0xd7,0x47,0x5b,0x10,0x61,0x87,0x46,0xbe,0x55,0x2d,
+    0xd1,0x0f,0xab,0x25,0x43,0x1b,0x1f,0x3f,0xb6,0x5a,0x34,0x75,0xc3,0x21,0xfe,0xa9,
+    0xb3,0x76,0x49,0xb7,0x56,0xdb,0xe6,0x3e,0x6d,0x1a,0x9b,0x5c,0x56,0x90,0xbd,0x78,
+    0x8f,0x16,0xc6,0xc4,0xd2,0x5a,0x0d,0xb6,0xb8,0x4c,0x47,0xc2,0xd0,0x55,0xa6,0x3b,
+    0xe5,0x0b,0x88,0xf8,0x80,0x9d,0x05,0x24,0xfb,0xc0,0x7a,0xf0,0x81,0x79,0xb1,0x36,
+    0x70,0xc1,0xcc,0x2b,0xd4,0x27,0xc2,0x0c,0xa0,0xaa,0x8f,0xd2,0xee,0xb7,0xd4,0x9d,
+    0x52,0xd4,0x20,0x97,0x4c,0xbe,0x48,0x2c,0xb6,0x98,0x79,0x36,0x6b,0xa8,0x4c,0x33,
+    0x45,0xce,0x50,0x3a,0xa1,0x68,0xce,0x0c,0x17,0x33,0xbf,0xdd,0x6b,0x98,0xf7,0x37,
+    0xbc,0xb2,0xad,0x98,0xb5,0x07,0x94,0x67,0xb8,0xd4,0x8c,0x07,0x1d,0x9b,0x38,0x54,
+    0x77,0x4a,0x2c,0x5a,0xd9,0x81,0x32,0x2f,0xd3,0x27,0x6a,0x10,0x28,0xf8,0x83,0xe5,
+    0xb9,0x06,0xf8,0x2b,0x5d,0xf7,0x72,0x32,0x93,0xa6,0x0e,0x30,0x05,0x4a,0x72,0xb9,
+    0x51,0x71,0xc6,0xf1,0x1e,0xe6,0xe5,0x24,0xa6,0xff,0x30,0xeb,0x33,0xca,0x71,0xc4,
+    0xf4,0x72,0x98,0xa9,0xe8,0xfb,0x53,0xbe,0xd4,0x69,0x84,0xa5,0xd7,0x2a,0x11,0xdc,
+    0x5c,0x61,0xee,0xc8,0x4b,0x5d,0x2b,0xc7,0xcd,0x6d,0x8e,0x43,0x1d,0x73,0xd6,0xe9,
+    0xd5,0x20,0xc5,0xc9,0x60,0xd3,0xcc,0xb2,0x9a,0x1a,0x56,0x5f,0xb3,0x5b,0x39,0xcb,
+    0xa1,0xb7,0xbf,0x5e,0x17,0x4a,0x76,0x35,0x2a,0x00,0x51,0xf2,0x2a,0xab,0x69,0x30,
+    0x38,0xf1,0x5f,0xa3,0x6a,0xa2,0xdd,0xdc,0xec,0xcb,0xbc,0x2b,0xa5,0x8c,0xb4,0xe4,
+    0xd8,0x78,0x9e,0x4c,0xa6,0xe5,0xfb,0x82,0xd4,0x08,0x53,0x54,0xd6,0xf2,0x64,0xab,
+    0xb0,0x89,0x4c,0x96,0x39,0x1c,0x78,0xb9,0x56,0xcc,0xcb,0x31,0xdd,0xb1,0x72,0x87,
+    0x47,0x60,0x8f,0xf1,0xda,0xe3,0xf8,0x36,0x11,0x54,0xed,0x09,0xe5,0x3d,0xaa,0x66,
+    0xe9,0x25,0x32,0x96,0x46,0x80,0xa4,0x4a,0x2a,0xf5,0x05,0x30,0x54,0xfd,0xfb,0x18,
+    0xe3,0x0f,0xef,0xe9,0x26,0x2a,0x20,0x73,0x37,0xa4,0x2d,0xf6,0x19,0xe7,0x48,0x5f,
+    0xa6,0x14,0xc9,0xc4,0x69,0x07,0x11,0xae,0x64,0x98,0xe1,0x12,0xf8,0x02,0x28,0xba,
+    0xf8,0x5c,0x48,0xc6,0xf2,0xd5,0x02,0x4b,0x80,0x64,0x00,0x8e,0x79,0x7f,0x8c,0x21,
+    0x68,0x48,0x0d,0x36,0x75,0x81,0x80,0x82,0x18,0xd2,0x4c,0x33,0xa5,0xb9,0x7d,0xdb,
+    0xd7,0x78,0xc0,0xe0,0x33,0x9e,0x69,0x7e,0xd8,0xc1,0xc4,0x00,0xb7,0x06,0x66,0x4b,
+    0x53,0xb2,0xef,0xe2,0x35,0x8c,0x21,0x9e,0xe6,0xfe,0x9c,0xd2,0x47,0x80,0x74,0x80,
+    0xb0,0x66,0xf3,0x28,0xe4,0x24,0x3f,0x22,0xbd,0x08,0xd7,0xc7,0x62,0x54,0x00,0xb2,
+    0x01,0x78,0x87,0x81,0x1e,0x6a,0xff,0xd4,0x64,0x97,0xf9,0x5e,0x01,0x99,0xc3,0x84,
+    0x6d,0x7c,0xbe,0x47,0xfe,0x9d,0x4d,0x39,0x4f,0x11,0x94,0x15,0x18,0xb7,0x1e,0xe3,
+    0xda,0x1d,0x20,0x70,0x50,0x12,0x47,0x31,0xb2,0x71,0x74,0x23,0x20,0xa1,0x94,0xfc,
+    0xb3,0xc6,0xf2,0x96,0x36,0x19,0xbb,0x6a,0xd5,0xc5,0x0d,0x49,0x94,0xe2,0x97,0x31,
+    0x02,0xd0,0xe1,0xc3,0x91,0x1f,0x44,0x2c,0x94,0x41,0x21,0xdc,0x57,0x56,0x70,0x02,
+    0x94,0x72,0x54,0x5f,0xc0,0x00,0x6b,0x58,0xd4,0x01,0x5e,0xc1,0xd9,0xec,0x3d,0x1d,
+    0x09,0x23,0xb2,0xb3,0xb9,0x59,0x07,0x3a,0x35,0x7a,0xeb,0xbc,0x03,0x02,0xd5,0xe9,
+    0x3d,0x7e,0x0c,0x3f,0x37,0x3b,0xf4,0xd0,0x66,0x0f,0x5d,0xf5,0x4b,0x8f,0x7d,0xe1,
+    0x44,0x5e,0x73,0x84,0x71,0xa5,0xd9,0x51,0x03,0xb9,0xde,0xe3,0xd0,0x68,0x02,0x6a,
+    0xe6,0x5d,0xc3,0x92,0x07,0x05,0x48,0xb7,0x5f,0x58,0x4c,0xa8,0x54,0xfd,0x85,0xee,
+    0x5a,0x98,0x15,0x8b,0xbc,0xd2,0x86,0xdd,0x01,0x3c,0xa2,0xd6,0x6d,0xa8,0x8f,0xf0,
+    0xf8,0xc4,0x94,0x5e,0x9a,0xd4,0xc7,0x31,0xea,0xcc,0x20,0x48,0x5d,0xd7,0x38,0x69,
+    0xff,0x37,0x87,0x63,0x90,0xa3,0x91,0x67,0xfc,0xb2,0xdb,0x35,0x77,0x76,0x80,0xf9,
+    0xc3,0x17,0x4f,0xf1,0x85,0x3d,0xde,0x86,0x7f,0x80,0x1b,0xfc,0xd2,0x36,0x46,0xbd,
+    0xf6,0x3e,0xdf,0x91,0xd0,0x24,0x73,0x04,0xbf,0x20,0xc5,0xa0,0x49,0x7d,0x70,0xf0,
+    0xbc,0x63,0x8f,0x31,0xf4,0xb7,0x77,0x8d,0xfb,0xc6,0x6d,0xe3,0xea,0x1d,0x34,0x82,
+    0x59,0x91,0x64,0xcd,0x73,0x40,0x86,0x1a,0xff,0xc8,0x37,0x62,0x62,0xd2,0x9f,0x76,
+    0x70,0xe6,0x87,0xdd,0x3a,0x07,0x4d,0xe5,0xc7,0x2d,0x77,0x0a,0x33,0xdf,0xec,0x34,
+    0xd8,0x2f,0x98,0x78,0xf8,0xdd,0x6b,0xf4,0xea,0xaa,0xcf,0x41,0x24,0x06,0x84,0xe5,
+    0x91,0x52,0x7c,0xfc,0xa8,0xf3,0x0c,0xbf,0x21,0x88,0x22,0x75,0x39,0xbc,0xef,0xbd,
+    0x6b,0xcf,0xbf,0xf5,0x18,0xb3,0xcb,0x19,0x8e,0x48,0x34,0x88,0xe1,0x8d,0xb5,0xa8,
+    0x71,0xd7,0xa0,0x33,0x74,0x6a,0xdc,0xd5,0x3a,0xdd,0xc6,0x7d,0x73,0x9b,0x49,0x3b,
+    0xcc,0x4a,0x9d,0xe2,0x22,0x81,0xa7,0x7a,0xcd,0xf6,0x08,0xbb,0x28,0x11,0x83,0xb5,
+    0x54,0xef,0xca,0x9b,0x12,0xe7,0x4a,0x79,0x8d,0x84,0x5e,0x6f,0x98,0x77,0x43,0xf3,
+    0x26,0xe3,0x66,0xd9,0x88,0x2c,0xf2,0x9a,0xc4,0x8e,0x1d,0xdb,0x88,0xdd,0x01,0x97,
+    0xed,0x25,0x3e,0xc3,0x57,0xfa,0x85,0xf5,0x88,0x10,0xf2,0x12,0xe9,0x38,0x31,0x6b,
+    0x58,0x53,0x23,0xc5,0x30,0x4e,0x6c,0x11,0x3a,0x13,0xcf,0x70,0xfb,0x02,0x58,0x8b,
+    0x3d,0x2f,0xeb,0xf5,0x16,0x66,0xbc,0xc1,0xde,0x9c,0xd3,0xde,0xac,0x49,0x46,0x0b,
+    0x6d,0x6b,0x63,0x6a,0xf4,0x7b,0xbc,0xbf,0xf8,0x30,0x08,0x80,0x13,0x6b,0x2b,0x8b,
+    0x39,0x18,0xd4,0x93,0xde,0x1e,0x0b,0xd2,0x2e,0x34,0x90,0x04,0x2d,0x05,0xdf,0x68,
+    0xb5,0x90,0xb5,0x01,0xa8,0x78,0xfc,0xc3,0x87,0x3a,0xb9,0xeb,0x24,0xbd,0x35,0xbc,
+    0x51,0xba,0x19,0x68,0x99,0x6f,0xc9,0x4d,0xa6,0xb1,0x60,0x0f,0xf5,0x81,0x37,0xc2,
+    0x88,0x05,0xfc,0x2e,0x7f,0xb3,0x46,0xe3,0x1a,0xf5,0x01,0xf5,0x7b,0x24,0xda,0x48,
+    0x75,0x55,0xba,0xae,0xd8,0x43,0x49,0x11,0x10,0x1a,0xf4,0xef,0xca,0x7e,0xda,0x4e,
+    0xf6,0x4f,0x16,0xb6,0x82,0x61,0x64,0xb5,0x2c,0x5a,0x17,0xea,0x5d,0x38,0x1f,0x19,
+    0x6c,0x46,0x1a,0x57,0x20,0x22,0x37,0xa6,0xc3,0x2d,0x4e,0x95,0x9b,0x67,0xd4,0x8d,
+    0xfe,0x3f,0x87,0xdf,0xd4,0xfe,0xd9,0xda,0xac,0x6f,0x39,0x2d,0xfb,0xce,0x36,0x6b,
+    0x00,0xa3,0x1e,0xc3,0xc5,0xfd,0x3f,0xad,0x2f,0xb0,0xab,0x09,0x70,0x57,0xf6,0xe6,
+    0x36,0x26,0xf4,0x02,0xb1,0xc9,0x9b,0xdb,0x83,0x65,0xaa,0x23,0x20,0xa5,0x4c,0xdf,
+    0x76,0xde,0x61,0x6f,0xe3,0x11,0x3f,0xc5,0x4a,0x9b,0x5e,0x7e,0xd7,0x7f,0x9a,0x4d,
+    0x58,0x0b,0x64,0x1d,0xc2,0x92,0x0d,0x5e,0x7c,0x90,0xdb,0x38,0x7e,0x90,0x20,0x10,
+    0x0b,0x88,0xba,0x30,0x62,0xca,0x20,0x8e,0x87,0x5b,0x9c,0x9e,0xd3,0x18,0x5b,0xdf,
+    0x14,0x0f,0x71,0x5c,0x5f,0x20,0x72,0x32,0x10,0x68,0x74,0x6f,0xc1,0x81,0x10,0xda,
+    0xb5,0x31,0x8c,0x41,0xb5,0xf6,0x2e,0xd3,0xe3,0x1c,0x4d,0x67,0x1c,0x83,0x58,0xd0,
+    0xf5,0x29,0x2a,0x83,0x9e,0x3b,0x11,0x59,0xbe,0x00,0x57,0x9e,0xbb,0xfe,0xa8,0xf6,
+    0x16,0xc6,0xf6,0x4e,0x38,0x17,0x93,0xba,0x68,0x0b,0xaf,0xfc,0xd5,0x97,0xf5,0x64,
+    0x2f,0x60,0xb7,0x11,0x13,0x05,0x12,0x11,0xc0,0x65,0xbf,0x3f,0x7e,0x84,0xb7,0xcc,
+    0x13,0x95,0xbf,0x66,0x0f,0xf5,0x85,0x28,0x1d,0x97,0x1d,0xc8,0xa2,0x4a,0x41,0x75,
+    0x69,0xee,0x5a,0x48,0xe1,0xa9,0x8f,0x35,0x28,0xd1,0x68,0x37,0x60,0x9f,0x60,0x51,
+    0x62,0x08,0x6a,0x4a,0x6f,0x92,0x47,0x01,0x23,0xfd,0xe2,0x2b,0x03,0xb8,0x4c,0x84,
+    0x6f,0x2e,0xf3,0xf4,0x86,0xf2,0x4a,0x8d,0x85,0xd4,0x4b,0x65,0xa4,0x45,0x34,0xc0,
+    0x3e,0x63,0x79,0x16,0x86,0x1d,0xd5,0x79,0xb3,0x2a,0x99,0x22,0x63,0x41,0x9a,0xe2,
+    0x55,0x4c,0x3e,0x10,0xf3,0x12,0xbc,0xe5,0x9b,0x34,0x8b,0x3d,0xa2,0xd4,0x29,0xe5,
+    0xc1,0x53,0xf1,0xed,0x37,0x25,0x2c,0x7a,0x69,0x75,0x71,0x61,0x4b,0xb6,0x3e,0x3a,
+    0x14,0x97,0xd7,0x5f,0xc5,0x08,0x97,0x56,0x94,0x37,0xa1,0xa4,0x53,0xc9,0x55,0xa8,
+    0xc9,0xee,0x15,0xc9,0x6d,0x33,0x96,0x9e,0x18,0xac,0x3c,0xdc,0xe0,0x01,0xd3,0x88,
+    0x1a,0xb9,0x02,0x53,0x05,0x7c,0x69,0xc7,0x4e,0xff,0xfc,0xb8,0x80,0x5d,0x21,0x0e,
+    0x0e,0x03,0xff,0x0b,0xa0,0x92,0x6c,0xd6,0x72,0xd5,0x52,0x08,0xb4,0x7a,0xd8,0x42,
+    0x16,0xe2,0xc1,0xea,0x75,0x2c,0xc7,0x83,0xd5,0xcd,0x17,0x2e,0x67,0x55,0x4c,0xc8,
+    0xae,0x67,0x25,0x44,0xc8,0xc1,0xbd,0x35,0xeb,0x55,0x94,0xc0,0x3e,0x97,0xb0,0x9c,
+    0x49,0x52,0x95,0xc5,0xce,0xd4,0xf5,0x3c,0x7f,0x3d,0xb3,0x47,0xec,0x1a,0x3b,0xac,
+    0x68,0x13,0x2a,0x36,0x96,0x9c,0x78,0x64,0x56,0x54,0x4c,0x26,0x24,0xf6,0xa5,0x2d,
+    0x17,0xdc,0x74,0xc1,0xd6,0x52,0xe3,0xae,0x00,0xea,0xed,0x92,0x20,0x3f,0xa2,0x4c,
+    0x86,0x3a,0x10,0xcb,0x9f,0x43,0xa1,0x26,0x9f,0xae,0xbf,0x3c,0xa6,0x74,0x7b,0x2f,
+    0x7a,0x03,0x2d,0xa5,0xc1,0x78,0xb4,0x52,0x43,0xc9,0x01,0x3e,0x83,0x05,0xc9,0x35,
+    0x28,0xc0,0xa4,0x6d,0xea,0x8f,0x8b,0x0d,0x0e,0x64,0x36,0x81,0x12,0xb4,0x2e,0x05,
+    0x26,0x89,0x59,0x54,0xcf,0xb8,0xc2,0xc1,0xbc,0x26,0xf2,0x1b,0x70,0xd5,0x11,0x08,
+    0x89,0x38,0x1b,0x7f,0x6b,0xfa,0x8e,0xa4,0x6b,0x1c,0x9b,0xd2,0x69,0x38,0x91,0x8a,
+    0x56,0x12,0x09,0xc4,0x18,0xf1,0xc3,0x70,0xa8,0x3f,0xff,0xfe,0xe2,0x0f,0x3a,0x1f,
+    0xad,0xf0,0xce,0xe3,0x9a,0xe7,0x30,0xc2,0x3c,0xcd,0x20,0x1a,0x8b,0x7d,0xda,0xd0,
+    0x66,0xcc,0xb2,0x86,0xf0,0x70,0xe9,0x98,0x71,0xe6,0x6f,0x79,0x1a,0xb8,0xeb,0x3f,
+    0xa6,0xc5,0x9b,0xa9,0x17,0x53,0xd1,0xfd,0xae,0x74,0x57,0xd8,0x8c,0x91,0x96,0x54,
+    0x9c,0xf9,0xce,0x00,0xeb,0x4d,0x91,0x59,0xb2,0x43,0xed,0xe4,0xd5,0xf9,0xeb,0xb3,
+    0xb3,0xf7,0x47,0xaf,0x5f,0xbd,0x38,0x3d,0x7f,0xf9,0xfe,0xf2,0xf4,0xe5,0xc9,0x85,
+    0x46,0x9e,0x24,0xc1,0xf4,0x16,0x95,0x0c,0x9f,0x4c,0xeb,0x2a,0x70,0x2d,0x6b,0xa8,
+    0xf2,0x1e,0xae,0xf6,0xe1,0xba,0x65,0xca,0xe0,0xc8,0x72,0x4a,0x93,0xf6,0x05,0x48,
+    0xac,0xd0,0xf5,0x48,0xda,0x24,0xf5,0xaa,0x34,0x8f,0xb6,0x45,0xb6,0x7b,0xd2,0xc4,
+    0x13,0xe2,0x00,0x72,0x38,0x0c,0x39,0x72,0x99,0x05,0x35,0x33,0xa0,0x34,0x69,0x24,
+    0xcd,0x42,0x82,0xd4,0x14,0xd9,0x58,0x52,0x29,0x7e,0xd8,0x8d,0x3c,0xec,0xca,0x91,
+    0xdf,0x76,0xea,0x29,0xb4,0xc9,0xd2,0x68,0x98,0xcd,0x97,0x76,0xe7,0x5b,0x3d,0x0a,
+    0x3b,0x30,0xa7,0x51,0xd8,0xa5,0xff,0xf6,0xe8,0xbf,0xdb,0x0f,0xf3,0x44,0x52,0x93,
+    0x4a,0xe1,0x3d,0x2e,0x3a,0xbc,0x4b,0x24,0xe4,0xa9,0xe9,0x2d,0x79,0xc1,0x4b,0x1e,
+    0x15,0xc7,0xeb,0x5e,0xf4,0xc1,0xb2,0xdc,0x14,0xa0,0xde,0xde,0xf2,0x50,0xfe,0x88,
+    0x5f,0x53,0xb2,0x2e,0x6f,0x24,0xaa,0x25,0x3a,0xce,0xae,0x25,0xe1,0x57,0x92,0xe8,
+    0x29,0xe3,0x37,0xaf,0x91,0xc7,0x5b,0xc4,0x57,0x9b,0x2c,0xaa,0xb6,0x9b,0x49,0xcc,
+    0x25,0xae,0xd9,0x9e,0xe1,0x3d,0x54,0xf2,0x22,0x22,0x52,0xef,0xb6,0x5a,0xad,0x07,
+    0xcc,0xc3,0xca,0x73,0xb8,0xc4,0xf9,0xd6,0xd0,0x1f,0xe4,0x61,0xab,0x9f,0xdb,0xac,
+    0x1f,0x4a,0xa7,0xb9,0x77,0x1a,0xde,0xde,0x34,0x2c,0x44,0x51,0x2c,0x98,0xd4,0xd1,
+    0x51,0x05,0x55,0x35,0xaa,0xba,0x31,0x33,0xcb,0xdc,0x6e,0xbb,0xbd,0xe9,0x7c,0xd3,
+    0x95,0xf6,0xb9,0x95,0x36,0x6f,0x82,0xf9,0xd6,0x79,0x27,0x8c,0x37,0x6e,0x61,0x6e,
+    0x40,0xf8,0xb4,0x1e,0xb6,0x1f,0xb7,0x07,0xfc,0x6c,0xc9,0xb7,0x1d,0x26,0xda,0x4a,
+    0xe7,0x45,0x1c,0x64,0x7b,0x42,0x96,0xf2,0xf5,0xfb,0x41,0x79,0xe6,0xc4,0xf1,0xfe,
+    0xc0,0x6d,0x57,0xe1,0xa0,0x51,0xee,0x2f,0x2a,0xf7,0xb1,0xde,0xd4,0xb9,0x4f,0xa6,
+    0xbc,0x3b,0x4b,0x7f,0x28,0x4a,0x4e,0xf4,0xcf,0xe1,0xf4,0x0d,0x1d,0x62,0x46,0x02,
+    0xe6,0xc6,0xad,0x3f,0x8c,0x4e,0xc8,0xfb,0x9e,0x8e,0x05,0x89,0x52,0x2d,0x45,0x53,
+    0xe5,0x12,0xa8,0xf8,0x02,0x2f,0x61,0x17,0x52,0x3d,0x1f,0x18,0x96,0x4c,0xc3,0xfa,
+    0x42,0xe4,0xc0,0x52,0xfc,0xf3,0x83,0x84,0x7b,0x7e,0xd0,0x80,0x62,0xe8,0xc2,0xf2,
+    0x3b,0x0c,0x5f,0x3a,0xbc,0xbc,0x3c,0x79,0x75,0x7c,0xf8,0xea,0xe8,0xe4,0x77,0x36,
+    0xf8,0x9c,0xe8,0x1d,0x35,0x15,0x68,0x2c,0xc3,0x52,0xbc,0x66,0x21,0x1e,0x1b,0x51,
+    0x44,0xe9,0xd1,0x73,0xdc,0x77,0x4b,0xa5,0x50,0xaa,0x97,0x92,0x43,0x05,0x39,0x37,
+    0x56,0xd4,0xc3,0x12,0x39,0xf5,0x30,0x82,0xb4,0xbc,0x5e,0xc2,0x53,0x59,0x71,0x39,
+    0x30,0x02,0x63,0x1a,0x0e,0x3f,0xd0,0x48,0xbf,0xc2,0x84,0x0c,0xf6,0x92,0x09,0x6b,
+    0x5f,0x2d,0x8a,0x84,0xb5,0xa5,0x88,0x5d,0xfd,0x0a,0x53,0x60,0x44,0x4b,0x11,0xc2,
+    0x9a,0x5b,0x03,0xbb,0x56,0x5f,0x7e,0x18,0xac,0x8a,0xc1,0xd7,0x37,0x59,0x57,0xd6,
+    0x8f,0xb7,0x2f,0x1d,0x77,0x5e,0x9a,0x26,0x0a,0x5f,0x95,0x74,0x8b,0x5f,0x23,0xa5,
+    0x1c,0xaa,0x68,0x3d,0x29,0x9f,0x4d,0x2c,0xc1,0x58,0x6c,0xb2,0xb4,0x28,0x51,0x24,
+    0x31,0xe8,0x67,0xf4,0x5b,0x84,0xc9,0x3f,0x8d,0xf8,0xbd,0x2e,0x4f,0x23,0x2b,0x75,
+    0x9f,0x9f,0xd5,0x9c,0xe5,0xde,0x8d,0xc4,0xae,0xa9,0xa5,0x60,0xf2,0xb9,0x63,0x2d,
+    0x45,0xee,0xd0,0x2d,0x00,0x20,0x20,0x25,0x60,0xa8,0x71,0xef,0xd8,0x08,0xfc,0xab,
+    0x04,0xb9,0xab,0x6f,0x70,0x91,0x93,0x70,0xd4,0x38,0x8e,0xbc,0xc8,0x0c,0x19,0xf4,
+    0x9e,0x53,0xa9,0xea,0x3d,0x7f,0x39,0x71,0xf1,0x0a,0xb4,0x82,0x18,0x78,0xb5,0x44,
+    0xe9,0xa5,0xd8,0x89,0x4b,0xd7,0xaa,0x47,0x84,0xd0,0x3d,0x01,0xe7,0xb6,0x89,0xa1,
+    0x17,0x6c,0x9e,0xe1,0x40,0x91,0x93,0x14,0x5f,0x34,0x01,0x87,0x12,0xbb,0x53,0x20,
+    0x2f,0x09,0xbd,0xe8,0x26,0xfc,0x0d,0x52,0xb1,0x18,0xf0,0x82,0xd6,0xc9,0x77,0x71,
+    0xf5,0x86,0x1b,0xfb,0x1b,0x15,0xe3,0xf5,0x2b,0x45,0xe3,0xa6,0xa2,0xfa,0x29,0x58,
+    0x43,0x5c,0x8b,0x36,0x46,0x1f,0x22,0x12,0x27,0xd1,0x98,0x2e,0x62,0x1c,0x78,0x0c,
+    0x46,0xc8,0x10,0x02,0xfb,0xab,0xe7,0x71,0xde,0xf1,0xbc,0xc0,0x94,0x60,0xc6,0x16,
+    0xbb,0xd4,0xf9,0x94,0xa5,0xfe,0x7f,0xaf,0xe4,0x57,0x6e,0x2c,0xa6,0x76,0x74,0xe5,
+    0x5b,0x7d,0xfd,0xcd,0xeb,0x8b,0x4b,0xbd,0xc1,0xbc,0x04,0xc2,0xfe,0x42,0x17,0x26,
+    0x35,0xbc,0xae,0x07,0x33,0x68,0xcd,0x66,0xae,0xc3,0xec,0x0e,0x5b,0x77,0xcd,0xdb,
+    0xdb,0xdb,0x26,0x26,0xa4,0xc5,0x24,0xc9,0xdc,0x1f,0x40,0x5f,0x36,0x70,0x93,0xf5,
+    0x3f,0x40,0x4f,0x80,0xc4,0xe0,0x12,0x3d,0x4e,0x50,0x2b,0x4e,0x8c,0xf8,0x95,0x0f,
+    0xe4,0x3e,0x37,0x7c,0x4c,0x97,0x28,0x88,0x77,0x9b,0x37,0x8e,0xb1,0x89,0x49,0x9c,
+    0x0d,0xf7,0xc3,0x32,0xe3,0xfa,0xaa,0xbf,0x34,0x82,0x6b,0x74,0x7f,0x08,0xf9,0x12,
+    0x0b,0x9e,0x22,0x93,0x22,0x7a,0x99,0x3b,0x53,0x08,0xf8,0xe8,0xe2,0x87,0x87,0x9c,
+    0x1b,0xcf,0x18,0x39,0x16,0x1e,0xf1,0xb7,0x8e,0x67,0xf9,0xb7,0xad,0xd8,0x0e,0x13,
+    0xd8,0xe3,0xe1,0x77,0x9b,0xdc,0xc1,0xd7,0xbf,0xf5,0xb0,0x47,0xef,0xcd,0xf0,0x86,
+    0x25,0x12,0xd0,0x37,0x2d,0x4a,0x72,0xc6,0x98,0x17,0x8c,0xb8,0x65,0x79,0xab,0xf5,
+    0x50,0xbb,0xbd,0xf2,0x5d,0x1b,0x1d,0x2a,0x1d,0x9f,0x06,0x46,0x1e,0xd8,0x8e,0x6b,
+    0x0f,0x54,0x5f,0x3e,0xd4,0x63,0x30,0x7f,0x18,0x7f,0xa8,0xd5,0x28,0xb3,0x43,0x5d,
+    0xf1,0x8a,0x63,0x23,0x3b,0x47,0x8f,0xc0,0xcc,0xf0,0xee,0xc3,0xe1,0x66,0xad,0x38,
+    0x1f,0xdb,0xac,0x89,0x45,0x94,0xf1,0xf5,0xda,0x8a,0x8e,0x16,0x1d,0xf6,0xe2,0x7c,
+    0xfc,0xf8,0x9f,0x96,0xe7,0xdf,0xd6,0xea,0xcd,0x1a,0xd6,0x6a,0x76,0xea,0xdf,0xec,
+    0xef,0x6e,0xdb,0x3b,0x18,0x7c,0x72,0x7a,0xf1,0x9a,0xe7,0xd1,0xcf,0xe4,0x45,0xa9,
+    0x3e,0x59,0xd4,0x9e,0xbe,0x89,0x7f,0x72,0x9d,0xac,0x5d,0x38,0xbe,0xce,0x7c,0xcc,
+    0xdd,0x2d,0xbc,0x38,0xb8,0xdf,0x75,0x4d,0x3f,0xc2,0x6f,0x2c,0xe9,0xc5,0x3f,0xc3,
+    0xb4,0x26,0xef,0x0a,0x7b,0xa6,0xd7,0xb3,0xf9,0xd1,0x1e,0xb6,0xf2,0x45,0x1b,0x8b,
+    0xfa,0xf6,0x3e,0xce,0x1d,0xc1,0x96,0x3c,0x8b,0xc2,0xd8,0x7d,0x36,0x10,0xe9,0xb9,
+    0x5d,0x09,0x7b,0x73,0xef,0x28,0x5a,0x24,0xf5,0xda,0xe4,0xd5,0x53,0x45,0xb7,0xcd,
+    0x6e,0xef,0x88,0x8f,0xd1,0xa8,0x24,0x9f,0x7c,0xc9,0x45,0x4d,0x74,0xac,0x46,0x5e,
+    0x56,0xe2,0xc6,0x97,0x49,0x9d,0x99,0x33,0xab,0xa2,0xca,0xe6,0xed,0xbc,0x67,0xb7,
+    0x4e,0xa5,0x28,0x13,0xd2,0x03,0x9e,0x9b,0x91,0x1c,0x13,0x99,0x97,0x17,0xbb,0xf3,
+    0x05,0x29,0x0b,0x6e,0xaa,0x09,0xc8,0x19,0x2e,0x2a,0x30,0xfd,0xb1,0x06,0x42,0x03,
+    0x3a,0x91,0x96,0xa6,0x23,0x2c,0xbf,0xbc,0x2a,0x15,0x8e,0x90,0xbe,0x13,0xeb,0x51,
+    0x4a,0x13,0x1e,0x8b,0x40,0x74,0x35,0x22,0x73,0x9f,0x1c,0x1b,0x8e,0x4b,0x8a,0xbf,
+    0x7f,0x05,0xd9,0x46,0x51,0x93,0x17,0xc7,0x6b,0x0b,0x47,0x9b,0x5c,0x95,0x34,0x7a,
+    0xe8,0xea,0xaf,0xff,0x41,0x8f,0x95,0xef,0xe7,0xdc,0xa7,0x8e,0x51,0x4d,0x16,0x55,
+    0x3f,0xa6,0x4b,0x7b,0x58,0xf4,0x34,0x4d,0x0d,0x13,0xcc,0xd5,0x0b,0x53,0x58,0xbb,
+    0x71,0x38,0xda,0xdb,0x77,0x19,0x97,0x3f,0x65,0x14,0xc2,0x2f,0xb4,0x45,0x57,0xea,
+    0xd1,0x25,0x7a,0xb7,0xce,0xcc,0xb6,0xf0,0x12,0xf6,0x26,0xa9,0x24,0xb9,0x98,0x0b,
+    0xcd,0x8f,0xec,0x89,0xe3,0xb5,0x54,0xc5,0x37,0xf5,0x92,0xc2,0xd8,0xe3,0xdc,0x01,
+    0xa8,0x5d,0x66,0x55,0x58,0x72,0x81,0x64,0x3c,0x3f,0x80,0x41,0x4d,0x08,0x48,0x8e,
+    0x98,0xbd,0x9f,0x9b,0x11,0xd2,0xf9,0xd2,0xd3,0xf7,0x0b,0x24,0x22,0x1d,0x1a,0x1d,
+    0xa1,0x17,0x49,0x78,0xfb,0x95,0xac,0x11,0x26,0x66,0x8e,0xe4,0xaa,0x2c,0x25,0xaa,
+    0x45,0xe8,0xe9,0xc8,0xb7,0x15,0xb9,0x3c,0xd1,0x51,0xed,0xc1,0xaa,0x90,0x72,0x2c,
+    0x0f,0xdd,0x0b,0x6f,0x08,0xd3,0xb3,0x71,0x2b,0xec,0x0e,0x1d,0x45,0x8d,0x29,0x74,
+    0xec,0x40,0xc9,0x94,0xbb,0x50,0xca,0x49,0x6c,0xb1,0x56,0x80,0x5f,0x0c,0x25,0xd1,
+    0x9a,0xe0,0xa6,0x14,0x7b,0xe2,0x3e,0xa0,0x5c,0x9b,0x76,0xe2,0xa2,0x1f,0x25,0xf2,
+    0xad,0xcc,0xf0,0xc7,0x6f,0xdf,0x2a,0xb4,0xfd,0x95,0x5b,0x1c,0xc5,0x05,0x5a,0xc5,
+    0xa6,0xc3,0x52,0xd2,0x9d,0x1e,0x72,0x55,0xa1,0x4d,0xdc,0x6f,0x95,0xad,0x47,0x8c,
+    0x4a,0x69,0x3d,0x2c,0x91,0xad,0xc7,0x58,0x9b,0xf2,0x71,0x62,0x91,0xb4,0x99,0x73,
+    0xae,0x18,0x38,0xf9,0x75,0x67,0x25,0x51,0x60,0x8a,0x28,0xc4,0x39,0xaf,0x1c,0xe1,
+    0x0e,0x41,0x2e,0x99,0xf5,0x2f,0xf7,0x3b,0x59,0xff,0xf2,0xd9,0x35,0x21,0x3b,0xd2,
+    0x2c,0x7c,0xb5,0x20,0xf1,0x82,0x73,0x6d,0xf9,0xa0,0xf0,0xd3,0x0a,0x41,0xf2,0x2f,
+    0xc0,0x86,0xaa,0xec,0x63,0x01,0x49,0x45,0x7a,0xda,0x22,0xd3,0x4c,0xf8,0xa3,0x13,
+    0x5d,0xd5,0x88,0xb0,0xca,0x99,0x17,0x97,0x59,0x25,0x22,0xd4,0xf2,0xae,0xd1,0xca,
+    0x39,0xc0,0x91,0xe2,0x48,0x13,0xb5,0xc8,0xfa,0xce,0x89,0xcb,0xf2,0x77,0x9a,0xe2,
+    0xfd,0xfc,0xe4,0xcd,0xeb,0xf3,0xcb,0x8b,0xff,0xaf,0xc1,0x92,0xd7,0xd4,0xa4,0xf8,
+    0x74,0xf2,0xce,0x3b,0x45,0xdd,0xcd,0x4a,0x76,0x9d,0xd1,0x8b,0x3a,0xb2,0xeb,0x83,
+    0x35,0x12,0x06,0x23,0x53,0x7a,0x1f,0xae,0x99,0x34,0x18,0xd6,0xeb,0x39,0xb0,0xd6,
+    0x94,0x5f,0x54,0xcd,0x66,0xda,0x29,0x4d,0x67,0x8a,0x89,0x7d,0x57,0xa5,0x33,0x85,
+    0x32,0xf5,0xf8,0x67,0x6e,0x3a,0x53,0x78,0x9f,0x4c,0x67,0xda,0xf9,0x2b,0x64,0x0e,
+    0xde,0x7d,0x48,0xe6,0xe0,0xde,0xa7,0x67,0x0e,0xde,0x7d,0x48,0xe6,0xe0,0xde,0x5f,
+    0x31,0x73,0x70,0xef,0xe1,0x99,0x83,0xa9,0xcf,0x99,0xe4,0xad,0x7c,0x65,0x57,0xe7,
+    0xe2,0xcd,0x24,0x16,0xfe,0x0c,0x59,0x7e,0x9f,0x2c,0xa1,0xbf,0x77,0xe7,0x7e,0x44,
+    0x87,0x4d,0x7f,0x7b,0x27,0x27,0xb3,0xf0,0xe7,0x4d,0x26,0x4c,0x9b,0xed,0x8d,0x63,
+    0x33,0xec,0xd7,0x98,0x11,0x3f,0xac,0xc7,0x8c,0xc8,0x2c,0x4e,0xcf,0xde,0x02,0x66,
+    0x60,0x0e,0xa7,0x4d,0xcd,0x68,0x8c,0x80,0x1b,0x36,0x36,0x47,0x8d,0x76,0xbd,0x11,
+    0x19,0x32,0x11,0x7b,0x41,0x01,0x97,0xa7,0x5c,0xcf,0xfd,0x9c,0x48,0x12,0xde,0x5d,
+    0x95,0xaf,0xb8,0x5b,0x25,0x61,0x71,0x57,0xc9,0x58,0xdc,0x2d,0x4a,0x59,0xdc,0x4d,
+    0x6e,0xf2,0xee,0xe7,0x4c,0x5a,0x1c,0xcd,0x60,0x56,0x60,0xdc,0x7f,0xb3,0x79,0x8b,
+    0x77,0x77,0xf2,0xf2,0x16,0xcf,0x7c,0x7e,0xab,0x93,0xce,0xae,0xfa,0xd6,0x1b,0xd5,
+    0x36,0x43,0x43,0x2a,0x27,0xbb,0x09,0xb4,0x3a,0x73,0x3c,0x89,0x57,0x8a,0x76,0xe4,
+    0xeb,0x7a,0xe2,0x92,0x88,0x50,0x41,0x30,0xca,0x41,0x3c,0xa3,0x1c,0xc4,0x0b,0xe9,
+    0xf8,0x33,0x9c,0x6d,0x0a,0x04,0x7b,0xeb,0xbc,0xe3,0xb7,0x27,0xc0,0x2f,0x11,0x7c,
+    0x03,0x45,0xd4,0x94,0x8f,0xb5,0x59,0x5c,0x84,0xae,0x98,0x10,0x79,0x1f,0x97,0x49,
+    0x5c,0xeb,0x95,0xe2,0x1a,0x86,0xe4,0xac,0xc4,0x35,0x2c,0x54,0x57,0x7e,0xe7,0xe2,
+    0x1a,0x7e,0x48,0xe2,0x5a,0x4f,0xe0,0x1a,0x35,0xb2,0xf2,0x44,0x91,0x64,0x55,0x99,
+    0x42,0x5e,0x8b,0xe6,0x2f,0x7b,0x50,0xec,0x8c,0xc7,0x7a,0xf1,0x19,0xd3,0x7d,0xd2,
+    0x40,0xaa,0xdb,0x6a,0xc7,0x69,0xe2,0x19,0x6a,0x75,0x1b,0x94,0x43,0xf5,0x79,0xba,
+    0xa2,0x04,0x49,0x9f,0x05,0xe1,0x6d,0x40,0x6f,0xf0,0xc6,0xd2,0x7e,0x6b,0xbb,0x81,
+    0xda,0x42,0xc2,0xbd,0x4f,0x41,0x4e,0x4e,0xe8,0x3e,0x95,0x22,0xff,0xc5,0x69,0xf2,
+    0xe7,0xa4,0xca,0x8d,0xa9,0xe3,0xf5,0xdb,0xd8,0x20,0x5e,0x46,0xaf,0x6e,0xa6,0x73,
+    0xc3,0xbb,0x66,0x1e,0x71,0x25,0xd7,0x72,0x78,0xd7,0xdc,0xfc,0xa4,0x98,0x9d,0xa4,
+    0x35,0x5e,0x08,0xf0,0xbb,0x2c,0xa1,0x58,0x6d,0xce,0x73,0x7d,0x73,0x33,0x44,0xc2,
+    0x62,0xf3,0xd5,0xc2,0x79,0xda,0x7b,0xa6,0x33,0x13,0x83,0x31,0x1d,0xd9,0x41,0x1d,
+    0x04,0x21,0x6e,0x71,0xe8,0xc2,0x78,0x98,0xed,0xa3,0xf7,0x25,0x14,0xdc,0xec,0x48,
+    0x13,0x52,0xda,0xe6,0x34,0xcf,0xd8,0x9c,0x6a,0x71,0x1e,0xaf,0x7a,0x26,0x93,0x2a,
+    0x07,0x52,0x66,0xef,0xda,0x6d,0x6f,0xd2,0x5e,0x1f,0xbb,0xbe,0x1f,0xd4,0xd8,0xb6,
+    0x37,0x3c,0xcb,0x07,0x69,0xfd,0x9b,0xde,0x4e,0x1d,0xd3,0xa3,0x0a,0xe3,0xc5,0x87,
+    0x64,0x56,0x54,0xd4,0x5a,0x62,0xfe,0xe0,0x70,0x3e,0x9d,0x1a,0xc1,0xfd,0xa3,0x5f,
+    0x35,0x61,0xee,0x8a,0x04,0xac,0xe9,0x35,0x52,0x52,0xea,0xda,0x33,0x65,0x4d,0x52,
+    0xd3,0x09,0x1f,0xd5,0xb9,0xcc,0xc9,0xe7,0x14,0xa7,0x56,0xb2,0x67,0x22,0x55,0x6e,
+    0xe9,0xc4,0x32,0xa3,0xdc,0xa7,0xcc,0xec,0xef,0x52,0xb2,0xbc,0x38,0xb9,0xbc,0x3c,
+    0x7d,0xf5,0xed,0xef,0x4d,0xb4,0x4c,0x5e,0x7e,0x1b,0x19,0xa3,0x9a,0x63,0x35,0x46,
+    0x91,0xb7,0xfa,0x06,0xdc,0x99,0x72,0x8b,0x20,0x60,0xf8,0xec,0x53,0x2e,0xc0,0x0d,
+    0xa1,0x61,0x05,0xdc,0x68,0x78,0x30,0x7a,0xe8,0x0d,0xb8,0x2b,0xae,0xbe,0x45,0x35,
+    0x6b,0xe1,0xe7,0xfc,0xab,0x75,0xe2,0xcb,0x5e,0x4b,0x6f,0x40,0x93,0x37,0xc4,0xae,
+    0x27,0x19,0x53,0x52,0x05,0xd2,0x1f,0xa1,0x5e,0xba,0x38,0xc1,0x95,0x39,0x9e,0xb0,
+    0x28,0x16,0xa9,0x85,0x55,0xaa,0x29,0xd9,0x19,0x2c,0x02,0x53,0x16,0x4e,0x03,0x80,
+    0xa0,0x98,0x02,0x86,0x57,0x92,0x40,0x90,0xd5,0x62,0x50,0x4a,0x81,0xb8,0xaa,0x4a,
+    0x38,0xae,0x25,0xc1,0x30,0x06,0x6f,0xf5,0xa8,0xe4,0xd5,0x66,0x02,0x52,0x5c,0x51,
+    0xc2,0xc2,0x0b,0x94,0xec,0xe0,0x06,0x0e,0xad,0x52,0x50,0x50,0x4c,0x81,0x23,0x2b,
+    0x49,0x30,0x93,0x69,0xf4,0x9a,0x6e,0xc3,0xba,0xb0,0xcd,0x2f,0x86,0x43,0x60,0x88,
+    0xec,0x31,0x9c,0x07,0x56,0x39,0x54,0xa8,0xa5,0x40,0x55,0x61,0x48,0xc0,0xb1,0x9f,
+    0x43,0xf1,0x95,0xa1,0x04,0x0b,0x0b,0x2a,0xc0,0xe2,0x7a,0x83,0x95,0xd5,0x9a,0x37,
+    0x39,0x77,0xd0,0xc5,0x00,0x28,0x4b,0xc7,0x52,0x74,0x68,0x34,0xff,0xf9,0x67,0x8c,
+    0xd3,0x21,0x9b,0x5a,0x62,0xa8,0x8b,0xcc,0xad,0xb8,0x19,0xc7,0xc4,0x89,0xdb,0x64,
+    0xf5,0x01,0x99,0x53,0xa0,0x9e,0x45,0x99,0x6b,0x4f,0x3d,0xbd,0xde,0x8f,0xf2,0x6e,
+    0x00,0x65,0xb7,0xa1,0x0a,0x6c,0x00,0x41,0xe5,0xa5,0x6f,0xd9,0x0f,0xe8,0x0b,0x56,
+    0xa5,0x9e,0x08,0x18,0x0f,0xee,0xc4,0xc4,0xc0,0x98,0xeb,0xfb,0x53,0x2f,0xda,0x7f,
+    0x40,0x3f,0x30,0xba,0x99,0xfa,0xa1,0x80,0x79,0x70,0x57,0x80,0x21,0xa4,0x28,0xd2,
+    0x72,0xd4,0x83,0x52,0xe4,0x69,0xa9,0xa0,0x8c,0xa8,0x28,0x71,0x8f,0x89,0x5a,0xa6,
+    0xfd,0x2d,0x6c,0xc0,0x07,0x8c,0x4a,0x54,0xa7,0x91,0xa9,0xb0,0xd6,0x1f,0x5a,0x7e,
+    0x86,0xbc,0x3c,0xfa,0x49,0x96,0x06,0x0a,0x19,0x3f,0x3f,0xbb,0x20,0x7f,0xb2,0x37,
+    0xe4,0x0f,0x56,0x63,0x16,0x36,0x49,0xd8,0xfa,0x2b,0x08,0x59,0x82,0x22,0x36,0x78,
+    0x36,0x19,0x8b,0xd7,0xac,0x4e,0x04,0x59,0x4d,0x41,0xc1,0xfa,0xab,0x6a,0xaa,0x94,
+    0x8f,0x55,0x8d,0x49,0x56,0x5f,0x5b,0x83,0xd8,0xb1,0xca,0x92,0x4e,0xad,0x1a,0xad,
+    0x42,0xde,0x58,0x4d,0x95,0x16,0xf5,0xab,0xd2,0xb0,0x86,0xf0,0xf3,0xe6,0x84,0x63,
+    0x45,0x8f,0x55,0x8a,0xc5,0xaa,0x26,0x08,0x42,0xbf,0x12,0x19,0x51,0x70,0x06,0x23,
+    0xe3,0x41,0x5a,0x0c,0x19,0xd6,0x3c,0xd3,0x3b,0x20,0x86,0xb4,0x75,0x3e,0x8d,0x7c,
+    0x83,0x97,0xae,0x40,0x4c,0x12,0x2a,0x42,0x55,0xb6,0x6b,0xbf,0xc2,0x06,0xaf,0x08,
+    0x55,0xec,0xc3,0x95,0xd8,0x92,0xde,0xc3,0x5c,0x4d,0xa9,0xec,0xb4,0x7e,0xc5,0x0d,
+    0xba,0xb2,0x67,0x3c,0xf1,0x45,0x05,0x2e,0xe5,0xf3,0x7b,0x6c,0x91,0x6f,0x64,0xe4,
+    0x0b,0xeb,0x72,0x05,0xd3,0x59,0xd6,0x6e,0xf6,0x8c,0x9b,0xbb,0x04,0xc9,0x50,0xcd,
+    0x66,0x7d,0xf1,0x0d,0xc3,0x4b,0x32,0xd6,0xf6,0x5c,0xe2,0x03,0x4f,0xaf,0x2e,0xdf,
+    0x30,0xba,0x23,0x6a,0xc3,0x3b,0x0c,0xbc,0x82,0xf7,0x18,0x5b,0x21,0x83,0xa7,0x0a,
+    0x27,0x0c,0xca,0xbf,0xa7,0x7d,0xb7,0x7a,0x38,0xd4,0x42,0xc4,0x6c,0x7c,0xa9,0x2c,
+    0x89,0xe4,0xea,0xf8,0xdb,0xbc,0xed,0x3a,0x16,0x11,0x84,0xc7,0x26,0x60,0x71,0x03,
+    0xd5,0x5d,0x43,0x9d,0x59,0x77,0x75,0x85,0xb0,0x83,0xc4,0x3b,0x5c,0x70,0xc5,0x6a,
+    0x5f,0x1f,0xcd,0xf4,0x06,0xd3,0xad,0xa2,0xad,0x45,0x6f,0xa0,0x7a,0x15,0x7e,0xb9,
+    0x7a,0x83,0xfb,0xde,0xc1,0x03,0x88,0xe5,0x3c,0xe9,0x38,0x3c,0x60,0xd4,0x2d,0x48,
+    0x21,0xe3,0x31,0xfe,0x06,0x2c,0x25,0x49,0x1c,0x7f,0x1b,0xfa,0x52,0x89,0x17,0x36,
+    0x7d,0xa5,0x91,0x5f,0xfe,0xfc,0x2f,0x71,0x2b,0xbf,0xfc,0xf9,0xbf,0x8b,0x66,0x7e,
+    0xf9,0xf3,0x7f,0x28,0xed,0xfc,0xf2,0xe7,0xff,0xa6,0x34,0xf4,0xcb,0x9f,0xff,0x8b,
+    0x6c,0xe8,0x97,0x3f,0xff,0x57,0xd9,0xd0,0x2f,0xff,0xeb,0x3f,0xb3,0x86,0xc4,0x5d,
+    0x32,0xaa,0xef,0xee,0x88,0x16,0xf1,0xab,0x05,0x8c,0xf1,0x2d,0xcc,0xc1,0x3b,0x4a,
+    0x5d,0x8e,0x82,0x36,0xf4,0x27,0x7e,0x41,0xb7,0x99,0x09,0xff,0xdd,0x0f,0xa9,0xe0,
+    0x39,0x46,0xe7,0xc9,0xf9,0xe0,0xb7,0x19,0x3c,0xc7,0x5d,0x0f,0x45,0x44,0xa6,0x76,
+    0x1b,0x38,0x91,0x9d,0x76,0x95,0x0b,0x35,0x76,0x59,0x87,0x83,0x29,0x1f,0x6f,0x3d,
+    0x36,0xdc,0x90,0x08,0x83,0x56,0xfb,0x03,0xfc,0xd3,0x7c,0xf9,0xb2,0x79,0x4c,0xd7,
+    0x74,0xdf,0x5e,0xd9,0x1e,0x6e,0x46,0x4c,0x2b,0x69,0xdc,0xc0,0xae,0xc6,0x43,0xa5,
+    0xa1,0x6d,0x78,0x3e,0x9e,0x76,0x1b,0xec,0xbb,0xe7,0x47,0xf5,0x96,0x46,0x0d,0x8f,
+    0x02,0xff,0x16,0x33,0xba,0x62,0xec,0x89,0x69,0xb8,0x0c,0xb4,0x69,0x78,0x94,0x7f,
+    0xca,0x19,0x8f,0x79,0x6e,0xaa,0x5b,0x5b,0x5c,0xe1,0x41,0x19,0x74,0xb8,0x53,0x6c,
+    0x3c,0xf7,0xdc,0x73,0x48,0xc3,0xbd,0x2e,0xd2,0x5f,0x8d,0x8d,0xb9,0x1b,0x71,0x8f,
+    0x59,0x04,0x27,0x9c,0x69,0x95,0xb1,0x81,0x98,0x2a,0x32,0x5f,0x45,0xb7,0xbe,0x68,
+    0x02,0x76,0xc1,0x3d,0x3a,0x56,0x22,0xad,0x60,0x19,0xac,0x58,0x53,0xc7,0xe4,0xc3,
+    0xa7,0x67,0x92,0x59,0x52,0x97,0x2e,0x64,0x91,0x5a,0x95,0xab,0xe2,0x05,0xf9,0xc6,
+    0x4a,0xef,0x99,0x67,0x4a,0x9c,0x2a,0xb2,0xe5,0x5f,0xa7,0x12,0xf9,0xc8,0x04,0x42,
+    0x82,0x3a,0xd5,0x15,0x07,0x18,0x99,0xba,0x91,0x5f,0xcb,0x30,0xdc,0x51,0x72,0xeb,
+    0x28,0x5d,0xb7,0x12,0x39,0x58,0x2a,0xb8,0x39,0xd6,0x2b,0x07,0x4f,0xa8,0xb0,0x45,
+    0xe0,0xb0,0x81,0xeb,0x8c,0x9e,0xaa,0xce,0x58,0x60,0x04,0x66,0x5b,0x94,0x58,0x21,
+    0x66,0x9e,0xe5,0x6c,0xc3,0xcc,0x50,0x61,0xa2,0x7f,0xe8,0xd5,0xc6,0xd0,0x46,0x57,
+    0xc6,0x53,0x25,0x8b,0x6b,0xdc,0xbb,0x81,0x52,0x4f,0x66,0x71,0x65,0xa1,0x5d,0x4c,
+    0xaf,0x3e,0xd4,0x3b,0xb3,0x3b,0xe8,0x89,0xeb,0x58,0x5a,0x42,0x97,0xaa,0xd6,0x14,
+    0x49,0x98,0x61,0x10,0x73,0x2f,0xee,0x3f,0xfa,0xef,0x29,0xc8,0x44,0x88,0x38,0x05,
+    0xd4,0x61,0x78,0xcb,0x6f,0x4a,0x33,0x5c,0xfc,0xce,0xd0,0x54,0xf5,0x7f,0x8b,0xf3,
+    0xcb,0x14,0xe5,0x99,0xa1,0x99,0x7c,0x01,0xbc,0x8e,0x86,0x86,0x02,0xf2,0xa2,0x63,
+    0x9b,0x85,0xb5,0x04,0xb3,0xca,0xf6,0x02,0x9e,0x9d,0x78,0xdf,0x46,0xe4,0x04,0xb6,
+    0x7b,0xcf,0x95,0x15,0xf1,0xb2,0xf3,0xb9,0x53,0xf0,0xa0,0xaa,0x03,0xd9,0xaf,0x80,
+    0x26,0x71,0x2f,0xd4,0xfc,0x77,0xbf,0x33,0xd5,0xe4,0xd9,0xe9,0x0f,0x27,0xda,0xc9,
+    0x0f,0x27,0xaf,0x2e,0x2f,0xb4,0x1a,0x4b,0xd7,0x80,0x8e,0xb8,0x61,0xfd,0xf7,0x37,
+    0x17,0x47,0xe2,0x7a,0xc2,0x86,0x92,0x5b,0x38,0xce,0x9b,0x40,0x4e,0xa5,0x2c,0xad,
+    0x6d,0x48,0x34,0x9e,0xfb,0xbe,0x33,0x3e,0x85,0x32,0xa1,0xcf,0xe6,0x94,0x9f,0x15,
+    0x73,0x03,0x13,0xe1,0xbf,0xe7,0x49,0xc8,0xe1,0x7c,0xf9,0x11,0x33,0xfd,0x8a,0xeb,
+    0x90,0x6c,0xab,0x41,0xd4,0x46,0xa6,0x9b,0x04,0xd9,0x2e,0x08,0xb5,0x91,0xed,0x02,
+    0xa9,0xf2,0x3d,0x4c,0x44,0x39,0xf7,0x10,0x86,0x81,0xb0,0x42,0x7c,0x1b,0x1a,0xb0,
+    0xc1,0xee,0xd1,0x45,0x17,0x80,0x9d,0xe0,0x12,0x5d,0xf8,0xf3,0x00,0x2f,0xb1,0xb7,
+    0x39,0x50,0xa8,0x7f,0x8f,0xa7,0xa2,0xed,0x8e,0xb5,0x1a,0x30,0x2c,0x68,0x63,0xd5,
+    0xce,0x80,0x58,0x34,0xa9,0x78,0xf3,0xf4,0x18,0x36,0x12,0x80,0x83,0xbd,0xaa,0x78,
+    0xee,0x23,0x27,0x82,0x47,0x2a,0x46,0xc5,0xde,0x6b,0x78,0xe9,0x03,0x4b,0x75,0x4b,
+    0x79,0x79,0x79,0x36,0xe6,0x3a,0x1e,0x79,0x74,0x10,0xc1,0x01,0xc3,0x73,0x2d,0xf0,
+    0xb4,0xca,0x37,0x11,0xde,0x18,0x2a,0x22,0xba,0xf1,0x15,0x6c,0x33,0xe6,0x4b,0x9b,
+    0xce,0xb0,0x18,0xda,0xe6,0x21,0x69,0x43,0x51,0x8d,0x2a,0xc2,0x29,0x0b,0x77,0x2b,
+    0x94,0x6e,0xea,0x9b,0x49,0x85,0x6b,0x2c,0x97,0x48,0xb5,0xea,0x52,0xbd,0xcd,0x87,
+    0xdc,0xdc,0x58,0x13,0xc2,0xff,0x3e,0x6e,0x54,0x97,0xae,0xbd,0x40,0x24,0xd2,0x9e,
+    0xb9,0x99,0xc2,0xfc,0x5a,0xad,0x7a,0x2a,0x31,0x67,0xb2,0x90,0xe2,0x1d,0xc8,0x4a,
+    0x26,0x7c,0xec,0x92,0x8e,0xb4,0x1e,0x61,0x97,0xe3,0xd5,0x4c,0xd1,0x35,0x18,0x56,
+    0x84,0xb9,0x10,0xc2,0xc7,0x8f,0x4d,0x8a,0x11,0xc2,0xdc,0xc6,0xe2,0x5d,0xcb,0x8a,
+    0xa9,0x25,0x3b,0x63,0xae,0x87,0x66,0xce,0x9d,0x87,0xcf,0x74,0x6e,0x0c,0xd7,0xfb,
+    0x66,0xfa,0xf2,0xc3,0x67,0x3a,0xe9,0x12,0x40,0xcc,0x62,0x7a,0x01,0x9e,0xba,0x4f,
+    0x34,0xf1,0xf6,0xfa,0xdd,0xb0,0xa6,0x3e,0x7d,0xfc,0xd8,0xae,0x6f,0x76,0x24,0xb1,
+    0x2d,0x98,0x3a,0xe6,0x93,0x4d,0x75,0xe2,0xda,0xd2,0x23,0x19,0xad,0xdd,0xb9,0x57,
+    0x33,0x66,0x7a,0xc7,0x07,0xc7,0xef,0x89,0x6d,0xcd,0xbd,0xf0,0xca,0x19,0x47,0x30,
+    0x3d,0x03,0xf5,0xbd,0xb8,0x47,0x36,0xf7,0x38,0x28,0xed,0xa1,0x72,0xcd,0xad,0x74,
+    0x96,0x3e,0xc4,0x54,0xa1,0x78,0x8b,0xc0,0x58,0xb9,0x8b,0xd4,0x60,0xd9,0x5a,0x2d,
+    0x1f,0x9d,0x20,0x31,0xba,0x25,0xa2,0x03,0x95,0xa1,0x53,0xab,0x7c,0xd1,0x17,0x14,
+    0x28,0x21,0x9c,0xbe,0x25,0xea,0xd7,0x07,0xf1,0x2e,0x50,0x9c,0xc2,0x93,0x28,0xd2,
+    0xe8,0xec,0xa0,0x03,0xf8,0x32,0x85,0x27,0x3c,0x3d,0x46,0x58,0x9e,0xa8,0x20,0xb4,
+    0x0a,0xef,0xe4,0x0a,0x5b,0xa1,0x55,0xed,0x1a,0x2e,0x00,0x92,0x0d,0xc7,0xe6,0xf5,
+    0x2f,0x8e,0x35,0x10,0x9a,0xfb,0xf8,0x97,0x85,0x03,0x60,0x7a,0xf8,0xff,0xf3,0x1f,
+    0xd0,0x80,0xe2,0x3c,0x11,0xb6,0x40,0xb4,0x9f,0x6d,0x75,0xda,0xdd,0x6d,0xfc,0xfc,
+    0x0f,0xcf,0x81,0xcf,0xb0,0x57,0x64,0x84,0xb8,0x75,0xc6,0x4e,0x49,0xdf,0x81,0xc3,
+    0x62,0x9d,0x37,0x56,0x74,0x9e,0xe0,0x64,0xbb,0xcf,0x21,0x20,0x7b,0x84,0xe2,0x38,
+    0x08,0xf8,0x74,0x0f,0x18,0x3c,0xa7,0x5c,0xdb,0x49,0x3d,0x40,0x94,0x51,0x89,0xd6,
+    0xe1,0x91,0x40,0x0a,0x7d,0xcd,0xd8,0x59,0x30,0xdb,0x21,0xf0,0x2c,0x4a,0x11,0xc9,
+    0x41,0xb3,0x93,0x93,0xf5,0xdb,0x0e,0x5b,0xbe,0x87,0x2e,0xec,0x43,0x0a,0x05,0x10,
+    0x84,0x92,0x02,0x50,0x96,0xb2,0x00,0x4d,0x6d,0xb2,0x04,0x23,0xa5,0xa2,0x88,0x61,
+    0x59,0xd4,0x12,0xd2,0x3f,0xdb,0xc3,0x3b,0xa5,0x4c,0x46,0x47,0xf4,0x86,0x3d,0x3c,
+    0x88,0xa9,0x8a,0x92,0x3d,0xd1,0x46,0xda,0x61,0xd4,0xeb,0xf5,0x42,0x10,0x2c,0x45,
+    0x0b,0x41,0xc8,0xe6,0x2b,0xcf,0x42,0x6a,0x28,0x79,0x5e,0x4a,0xa0,0x72,0x79,0x9d,
+    0xf5,0xab,0x10,0x58,0x5d,0x58,0xd7,0x2f,0x7c,0x54,0x12,0xe1,0x19,0xc5,0x53,0xc5,
+    0xc3,0x2e,0x84,0xad,0x78,0x4b,0x12,0x17,0xf2,0xe6,0x33,0xe4,0x3e,0x29,0x75,0x91,
+    0x6b,0x98,0x2c,0x13,0x3a,0x7c,0x9c,0x3a,0x21,0x88,0xdc,0xec,0x8c,0x0a,0x5b,0xc5,
+    0x93,0x44,0x20,0xf5,0x86,0x7a,0x28,0x14,0x77,0x1d,0xa8,0x14,0xe0,0x4a,0xa6,0x74,
+    0x42,0xba,0x3e,0xf5,0x9c,0xe8,0x37,0x29,0x56,0xe7,0x08,0xda,0x1c,0xcd,0xb3,0x13,
+    0x71,0xfc,0xfa,0x25,0xdf,0x48,0x67,0x2c,0xfb,0x42,0x83,0xc4,0x4b,0x42,0xd0,0x07,
+    0x46,0x7e,0x94,0xb1,0xed,0x71,0x24,0x44,0xfd,0x01,0x01,0x22,0x28,0x91,0x90,0xd0,
+    0xa1,0x0a,0xdf,0x94,0x5d,0x8d,0xd2,0x18,0xa1,0x3b,0x94,0x26,0x98,0x7e,0x94,0x58,
+    0x22,0x45,0xb7,0x00,0x32,0xbe,0xb8,0x08,0x94,0x3e,0x5f,0xdb,0xf7,0x0c,0xa2,0x90,
+    0x03,0x93,0x72,0x39,0x13,0xdc,0x85,0x4c,0x2e,0x52,0x4a,0x51,0xf2,0x6f,0x7f,0x42,
+    0xe1,0x90,0x3c,0x15,0x35,0xaa,0x2c,0xa0,0x26,0x34,0xd7,0x92,0xd9,0x14,0x33,0x22,
+    0xb9,0xd8,0x01,0x91,0x81,0x09,0xdc,0x00,0xc5,0x9d,0xc8,0x31,0x5c,0x76,0x21,0x28,
+    0x76,0x40,0xde,0x76,0xea,0x84,0x9e,0x1e,0x01,0x0f,0x39,0x9d,0xd2,0x5d,0x69,0x06,
+    0xbb,0x09,0xc7,0xc7,0x5e,0x91,0xfd,0x78,0xc2,0x2e,0x4b,0xc8,0xe1,0x66,0x52,0xa1,
+    0x48,0x0a,0x1b,0xd3,0xd0,0x76,0x79,0xdc,0x51,0x82,0x02,0xf2,0x3e,0x1d,0xce,0x23,
+    0xbf,0xc9,0xd9,0xd2,0x3e,0xee,0xb2,0xe0,0x5e,0xeb,0xe1,0x25,0x1c,0x5b,0x5a,0x67,
+    0x47,0x0b,0x65,0x7e,0x73,0x3c,0x96,0xf9,0x26,0x6c,0xf0,0x62,0x3b,0x1a,0x8a,0xce,
+    0x58,0xa0,0xc5,0xef,0xba,0x20,0x27,0x26,0x76,0xbf,0x15,0xf4,0xe7,0x14,0x23,0x93,
+    0x61,0x09,0x6b,0x02,0x9b,0x34,0x56,0x40,0xa4,0xe5,0x47,0x91,0x98,0xd1,0xc0,0xc7,
+    0x8f,0xe9,0xc3,0xd7,0xdd,0x76,0xfa,0x66,0x0a,0xfe,0x1e,0xaf,0x07,0x78,0xfc,0xb8,
+    0x3a,0x6f,0xb7,0x26,0xe3,0x06,0xfc,0x02,0x1d,0xce,0x38,0x4d,0x14,0xd4,0xa7,0x98,
+    0xec,0x27,0x38,0xa5,0xf5,0x45,0x6e,0xc8,0xa8,0xbe,0xc5,0xbe,0xa3,0xa9,0xf4,0xe9,
+    0x56,0x68,0x06,0xce,0x2c,0x3a,0x80,0x5f,0xa8,0xbd,0xc6,0xbf,0x78,0x71,0xf2,0xc1,
+    0xa3,0xff,0x0b,0xdc,0x95,0xbd,0x6c,0xc1,0x4d,0x01,0x00,
+};
+static const WebAsset web_index_html = {
+    "/", "text/html; charset=utf-8", web_index_html_gz, sizeof(web_index_html_gz), 85441,
+    "\"2207062bc7580e66\"", false };
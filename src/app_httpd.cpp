@@ -8,13 +8,24 @@
 #include "img_converters.h"
 #include "fb_gfx.h"
 #include "sdkconfig.h"
-#include "camera_index.h"   // login_html
-#include "main_page.h"      // index_html  (FaceGuard Pro portal)
+#include "web_assets.h"     // portal and login page (gzip'd, from web/)
 #include "esp_log.h"
 #include "fd_forward.h"
 #include "fr_forward.h"
 #include "global.h"
 #include "sd_card.h"
+#include "attendance_journal.h"
+#include "match_stats.h"
+#include "capture_broker.h"
+#include "recognition_pipeline.h"
+#include "frame_pool.h"
+#include "frame_decode.h"
+#include "stream_broadcast.h"
+#include "mjpeg_part.h"
+#include "snapshot_cache.h"
+#include "event_hub.h"
+#include "long_poll.h"
+#include "esp_heap_caps.h"
 #include "esp_task_wdt.h"
 
 #include <sys/time.h>
@@ -39,6 +50,7 @@ const char *myFilePath = "/FACE.BIN";
 // ─── Face detection / recognition config (defined here, extern in global.h) ──
 mtmn_config_t     mtmn_config       = {0};
 face_id_name_list id_list            = {0};
+FaceGallery       faceGallery;
 int8_t            detection_enabled  = 0;
 int8_t            recognition_enabled = 0;
 volatile int8_t   is_enrolling        = 0;  // volatile: read by ATD/stream task, written by HTTP task
@@ -48,13 +60,17 @@ volatile int8_t   enroll_samples_left = 0;  // counts down ENROLL_CONFIRM_TIMES
 // Set by api_enroll_capture_handler; read by run_face_recognition.
 EnrollContext enrollCtx = {};
 
-// ─── MJPEG streaming constants ────────────────────────────────────────────────
-#define PART_BOUNDARY "123456789000000000000987654321"
-static const char *_STREAM_CONTENT_TYPE =
-    "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
-static const char *_STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
-static const char *_STREAM_PART =
-    "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n\r\n";
+// ─── MJPEG streaming ──────────────────────────────────────────────────────────
+// Every /stream viewer is served by the broadcaster (stream_broadcast.h); the
+// render hook below runs once per camera frame for all of them.
+//
+// /stream?overlay=1: camera JPEGs go out untouched and detection results ride
+// along in each part's X-Faces header for the portal to draw.  Detection runs
+// on a half-scale decode at most every STREAM_OVERLAY_DETECT_MS – enrolment
+// samples are taken at that rate too – and frames in between carry the last
+// result.
+#define STREAM_OVERLAY_DETECT_MS   250
+#define STREAM_OVERLAY_MAX_FACES   4
 
 httpd_handle_t stream_httpd = NULL;
 httpd_handle_t camera_httpd = NULL;
@@ -124,14 +140,59 @@ static void draw_face_boxes(dl_matrix3du_t *im, box_array_t *boxes, int fid) {
     }
 }
 
+// ─── esp-face enrolment list reset ────────────────────────────────────────────
+// Frees every node of an esp-face list (the enrolment accumulator).
+static void clear_face_id_list(face_id_name_list *l) {
+    face_id_node *p = l->head;
+    while (p) {
+        face_id_node *next = p->next;
+        if (p->id_vec) dl_matrix3d_free(p->id_vec);
+        dl_lib_free(p);
+        p = next;
+    }
+    l->head  = nullptr;
+    l->tail  = nullptr;
+    l->count = 0;
+}
+
+// ─── JSON-safe names ──────────────────────────────────────────────────────────
+// Names come from the enrol form as typed and go between JSON quotes
+// unescaped: replace what would break the string.
+static void json_safe(char *s) {
+    for (char *c = s; *c; c++)
+        if (*c == '"' || *c == '\\' || (uint8_t)*c < 0x20) *c = '_';
+}
+
+// {"enrolling":0|1,"left":N,"total":N,"name":"..."} – /api/enroll_status and
+// the `enroll` event.
+static void enroll_status_json(char *out, size_t len) {
+    char name[sizeof(enrollCtx.name)];
+    snprintf(name, sizeof(name), "%s", enrollCtx.name);
+    json_safe(name);
+    snprintf(out, len, "{\"enrolling\":%d,\"left\":%d,\"total\":%d,\"name\":\"%s\"}",
+             (int)is_enrolling, (int)enroll_samples_left, ENROLL_CONFIRM_TIMES, name);
+}
+
+// Enrolment progress moved: tell event clients and parked
+// /api/enroll_status?wait= requests.
+static void enroll_changed() {
+    char j[160];
+    enroll_status_json(j, sizeof(j));
+    Events::publish("enroll", "%s", j);
+    LongPoll::notify();
+}
+
 // ─── Face recognition runner ──────────────────────────────────────────────────
+// Returns 1 recognised (name copied to label if given), -1 unknown, 0 no
+// verdict (enrolling, or the face could not be aligned).
 static int run_face_recognition(dl_matrix3du_t *im, box_array_t *net_boxes,
-                                 const char *enrollName) {
+                                 const char *enrollName, FrameArena &arena,
+                                 char *label = nullptr, size_t labelLen = 0) {
     char cname[ENROLL_NAME_LEN];
     strncpy(cname, enrollName, ENROLL_NAME_LEN-1);
     cname[ENROLL_NAME_LEN-1] = '\0';
 
-    dl_matrix3du_t *aligned = dl_matrix3du_alloc(1, FACE_WIDTH, FACE_HEIGHT, 3);
+    dl_matrix3du_t *aligned = arena.matrix(FACE_WIDTH, FACE_HEIGHT, 3);
     if (!aligned) return 0;
     int matched = 0;
 
@@ -144,16 +205,37 @@ static int run_face_recognition(dl_matrix3du_t *im, box_array_t *net_boxes,
             if (left == 0) {
                 is_enrolling        = 0;
                 enroll_samples_left = 0;
-                Bridge::write_face_id_name_list_sdcard(&id_list, myFilePath);
-                Serial.printf("[ENROLL] Enrolled '%s' – saved to SD\n", cname);
+                // id_list only accumulates the capture average; move the
+                // finished face into the gallery and append it to FACE.BIN.
+                face_id_node *done = id_list.tail;
+                int row = (done && done->id_vec)
+                        ? faceGallery.add(done->id_name, done->id_vec->item)
+                        : -1;
+                if (row >= 0)
+                    Bridge::appendFaceGallery(faceGallery, done->id_name, done->id_vec->item,
+                                              myFilePath);
+                clear_face_id_list(&id_list);
+                if (row >= 0) {
+                    Serial.printf("[ENROLL] Enrolled '%s' – saved to SD (%u faces)\n",
+                                  cname, (unsigned)faceGallery.count());
+                } else {
+                    Serial.printf("[ENROLL] Out of memory storing '%s'\n", cname);
+                }
             } else {
                 Serial.printf("[ENROLL] %d captures left for '%s'\n", left, cname);
             }
+            enroll_changed();
         } else {
-            face_id_node *node = recognize_face_with_name(&id_list, face_id);
-            if (node) {
+            FaceGallery::Match m;
+            faceGallery.match(face_id->item, matchThreshold(), &m);
+            MatchStats::record(m.best, m.second, m.row >= 0);
+            if (m.row >= 0) {
+                const char *name = m.name;
                 matched = 1;
-                rgb_print(im, FACE_COLOR_GREEN, "Recognised");
+                if (label && labelLen) {
+                    strncpy(label, name, labelLen - 1);
+                    label[labelLen - 1] = '\0';
+                }
 
                 // Only log attendance when NOT in an admin portal session.
                 // When `authenticated` is true, the stream is being used for
@@ -163,7 +245,7 @@ static int run_face_recognition(dl_matrix3du_t *im, box_array_t *net_boxes,
                 // attendanceTask to hit "already logged today".
                 if (!authenticated) {
                     UserRecord user;
-                    bool found = Bridge::getUserByName(node->id_name, user);
+                    bool found = Bridge::getUserByName(name, user);
 
                     AttendanceRecord rec = {};
                     if (found) {
@@ -171,101 +253,182 @@ static int run_face_recognition(dl_matrix3du_t *im, box_array_t *net_boxes,
                         strncpy(rec.name, user.name, sizeof(rec.name) - 1);
                         strncpy(rec.dept, user.dept, sizeof(rec.dept) - 1);
                     } else {
-                        strncpy(rec.uid,  node->id_name, sizeof(rec.uid)  - 1);
-                        strncpy(rec.name, node->id_name, sizeof(rec.name) - 1);
+                        strncpy(rec.uid,  name, sizeof(rec.uid)  - 1);
+                        strncpy(rec.name, name, sizeof(rec.name) - 1);
                     }
-                    Bridge::logAttendance(rec);
+                    rec.setConfidence(m.best);
+                    Journal::post(rec);
                 }
             } else {
-                rgb_print(im, FACE_COLOR_RED, "Unknown");
                 matched = -1;
             }
         }
         dl_matrix3d_free(face_id);
     }
-    dl_matrix3du_free(aligned);
     return matched;
 }
 
-// ══════════════════════════════════════════════════════════════════════════════
-//  STREAM HANDLER (port 81)
-// ══════════════════════════════════════════════════════════════════════════════
-static esp_err_t stream_handler(httpd_req_t *req) {
-    camera_fb_t    *fb           = NULL;
-    struct timeval  ts;
-    esp_err_t       res          = ESP_OK;
-    size_t          jpg_len      = 0;
-    uint8_t        *jpg_buf      = NULL;
-    char            part_buf[128];
-    dl_matrix3du_t *image_matrix = NULL;
-
-    httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-
-    while (true) {
-        esp_task_wdt_reset();   // stream can run for minutes; feed WDT each frame
-        fb = esp_camera_fb_get();
-        if (!fb) { res = ESP_FAIL; break; }
-        gettimeofday(&ts, NULL);
-
-        if (!detection_enabled || fb->width > 400) {
-            if (fb->format != PIXFORMAT_JPEG) {
-                bool ok = frame2jpg(fb, 80, &jpg_buf, &jpg_len);
-                esp_camera_fb_return(fb); fb = NULL;
-                if (!ok) res = ESP_FAIL;
-            } else { jpg_len = fb->len; jpg_buf = fb->buf; }
-        } else {
-            image_matrix = dl_matrix3du_alloc(1, fb->width, fb->height, 3);
-            if (!image_matrix) {
-                // Must return the framebuffer before marking failure —
-                // previously fb was leaked here when alloc failed.
-                esp_camera_fb_return(fb); fb = NULL;
-                res = ESP_FAIL;
-            } else {
-                if (!fmt2rgb888(fb->buf, fb->len, fb->format, image_matrix->item)) {
-                    res = ESP_FAIL;
-                } else {
-                    box_array_t *boxes = face_detect(image_matrix, &mtmn_config);
-                    if (boxes) {
-                        int fid = 0;
-                        if (recognition_enabled)
-                            fid = run_face_recognition(image_matrix, boxes,
-                                                       enrollCtx.name);
-                        draw_face_boxes(image_matrix, boxes, fid);
-                        if (boxes->score)    dl_lib_free(boxes->score);
-                        if (boxes->box)      dl_lib_free(boxes->box);
-                        if (boxes->landmark) dl_lib_free(boxes->landmark);
-                        dl_lib_free(boxes);
-                    }
-                    if (!fmt2jpg(image_matrix->item, fb->width*fb->height*3,
-                                 fb->width, fb->height, PIXFORMAT_RGB888, 90,
-                                 &jpg_buf, &jpg_len)) {
-                        ESP_LOGE(TAG, "fmt2jpg failed");
-                    }
-                }
-                dl_matrix3du_free(image_matrix);
-                esp_camera_fb_return(fb); fb = NULL;
-            }
-        }
+static void free_boxes(box_array_t *boxes) {
+    if (boxes->score)    dl_lib_free(boxes->score);
+    if (boxes->box)      dl_lib_free(boxes->box);
+    if (boxes->landmark) dl_lib_free(boxes->landmark);
+    dl_lib_free(boxes);
+}
+
+// ─── X-Faces JSON ─────────────────────────────────────────────────────────────
+// The first n boxes (frame coordinates) as
+//   {"seq":N,"w":320,"h":240,"faces":[{"box":[x,y,w,h],"lm":[x,y,…],"id":1,"label":"…"}],
+//    "enroll":left}
+// id is 1 recognised, -1 unknown, 0 no verdict; fid / label belong to the
+// first face, the only one recognised.
+static void faces_json(const Capture::Frame *fr, const box_array_t *boxes, int n,
+                       int fid, char *label, char *out, size_t outLen) {
+    json_safe(label);
+
+    size_t len = snprintf(out, outLen, "{\"seq\":%u,\"w\":%u,\"h\":%u,\"faces\":[",
+                          (unsigned)fr->seq, (unsigned)fr->width, (unsigned)fr->height);
+    for (int i = 0; i < n && len < outLen; i++) {
+        const fptp_t *b = boxes->box[i].box_p, *l = boxes->landmark[i].landmark_p;
+        len += snprintf(out + len, outLen - len,
+            "%s{\"box\":[%d,%d,%d,%d],\"lm\":[%d,%d,%d,%d,%d,%d,%d,%d,%d,%d],\"id\":%d",
+            i ? "," : "", (int)b[0], (int)b[1], (int)(b[2] - b[0] + 1), (int)(b[3] - b[1] + 1),
+            (int)l[0], (int)l[1], (int)l[2], (int)l[3], (int)l[4],
+            (int)l[5], (int)l[6], (int)l[7], (int)l[8], (int)l[9], i ? 0 : fid);
+        if (len < outLen)
+            len += snprintf(out + len, outLen - len, i == 0 && label[0] ? ",\"label\":\"%s\"}" : "}",
+                            label);
+    }
+    if (len < outLen)
+        len += snprintf(out + len, outLen - len, "],\"enroll\":%d}",
+                        is_enrolling ? enroll_samples_left : 0);
+    if (len >= outLen)      // too many faces for the buffer: send none rather than broken JSON
+        snprintf(out, outLen, "{\"seq\":%u,\"faces\":[]}", (unsigned)fr->seq);
+}
 
-        if (res == ESP_OK)
-            res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
-        if (res == ESP_OK) {
-            size_t hlen = snprintf(part_buf, 128, _STREAM_PART,
-                                   jpg_len, (int)ts.tv_sec, (int)ts.tv_usec);
-            res = httpd_resp_send_chunk(req, part_buf, hlen);
+// ─── Overlay detection ────────────────────────────────────────────────────────
+// Detects (and, in enrol mode, recognises) faces in a camera JPEG without
+// touching it: half-scale decode for face_detect(), face-region decode for
+// alignment – as the attendance pipeline does.  Matrices come from `arena`;
+// the caller releases it.
+static void overlay_detect(const Capture::Frame *fr, FrameArena &arena,
+                           char *out, size_t outLen) {
+    int shift = FRAME_DETECT_SHIFT;
+    dl_matrix3du_t *im    = FrameDecode::decodeScaled(fr->buf, fr->len, shift, &arena);
+    box_array_t    *boxes = nullptr;
+    if (im) {
+        mtmn_config_t cfg = mtmn_config;
+        cfg.min_face = mtmn_config.min_face >> shift;    // same faces, smaller image
+        boxes = face_detect(im, &cfg);
+    }
+    int n = boxes ? std::min(boxes->len, STREAM_OVERLAY_MAX_FACES) : 0;
+    FrameDecode::mapBoxes(boxes, n, (float)(1 << shift), 0, 0);
+
+    int  fid = 0;
+    char label[ENROLL_NAME_LEN] = "";
+    int  x, y, w, h;
+    if (n && recognition_enabled &&
+        FrameDecode::faceRegion(boxes, 1, fr->width, fr->height, &x, &y, &w, &h)) {
+        dl_matrix3du_t *faceIm = FrameDecode::decodeRegion(fr->buf, fr->len, x, y, w, h, &arena);
+        if (faceIm) {
+            FrameDecode::mapBoxes(boxes, 1, 1.0f, (float)-x, (float)-y);
+            fid = run_face_recognition(faceIm, boxes, enrollCtx.name, arena,
+                                       label, sizeof(label));
+            FrameDecode::mapBoxes(boxes, 1, 1.0f, (float)x, (float)y);
         }
-        if (res == ESP_OK)
-            res = httpd_resp_send_chunk(req, (const char*)jpg_buf, jpg_len);
+    }
+    faces_json(fr, boxes, n, fid, label, out, outLen);
+    if (boxes) free_boxes(boxes);
+}
 
-        if (fb)      esp_camera_fb_return(fb);
-        else if (jpg_buf) free(jpg_buf);
-        jpg_buf = NULL; fb = NULL;
+// ─── Annotated frame ──────────────────────────────────────────────────────────
+// The original /stream look: full-size decode, detection, recognition, boxes
+// and verdict drawn in, re-encoded at `quality` (90 unless a viewer's rate
+// controller asked for less) into p.encoded.  Also writes X-Faces for any
+// overlay viewers.
+static bool annotate_frame(Broadcast::Part &p, int quality, FrameArena &arena,
+                           char *faces, size_t facesLen) {
+    const Capture::Frame *fr = p.frame.get();
+    dl_matrix3du_t *im = arena.matrix(fr->width, fr->height, 3);
+    if (!im || !fmt2rgb888(fr->buf, fr->len, (pixformat_t)fr->format, im->item)) return false;
+
+    box_array_t *boxes = face_detect(im, &mtmn_config);
+    if (boxes) {
+        int  fid = 0;
+        char label[ENROLL_NAME_LEN] = "";
+        if (recognition_enabled)
+            fid = run_face_recognition(im, boxes, enrollCtx.name, arena, label, sizeof(label));
+        faces_json(fr, boxes, std::min(boxes->len, STREAM_OVERLAY_MAX_FACES), fid, label,
+                   faces, facesLen);
+        if (fid > 0)      rgb_print(im, FACE_COLOR_GREEN, "Recognised");
+        else if (fid < 0) rgb_print(im, FACE_COLOR_RED, "Unknown");
+        draw_face_boxes(im, boxes, fid);
+        free_boxes(boxes);
+    } else {
+        char none[1] = "";
+        faces_json(fr, nullptr, 0, 0, none, faces, facesLen);
+    }
+
+    size_t len = 0;
+    if (!fmt2jpg(im->item, fr->width * fr->height * 3, fr->width, fr->height,
+                 PIXFORMAT_RGB888, quality, &p.encoded, &len)) {
+        ESP_LOGE(TAG, "fmt2jpg failed");
+        return false;
+    }
+    p.quality  = (uint8_t)quality;
+    p.plain    = p.encoded;
+    p.plainLen = len;
+    return true;
+}
+
+// ══════════════════════════════════════════════════════════════════════════════
+//  STREAM (port 81)
+// ══════════════════════════════════════════════════════════════════════════════
+// Broadcaster render hook: runs on its producer task, once per camera frame
+// however many viewers are connected, so a second viewer costs no codec or
+// detection work.  Only this task touches the statics.
+static bool stream_render(Broadcast::Part &p, const Broadcast::Want &want) {
+    static FrameArena arena;                            // per-frame matrices
+    static char       faces[BROADCAST_FACES_MAX] = "";  // last X-Faces JSON
+    static uint32_t   lastDetectMs = 0;
+    const Capture::Frame *fr = p.frame.get();
+
+    esp_task_wdt_reset();
+    if (!detection_enabled || fr->width > 400) {
+        faces[0] = '\0';
+        if (fr->format == CAPTURE_FORMAT_JPEG) return true;     // sent as captured
+        size_t len = 0;
+        int    q   = std::min(80, (int)want.quality);
+        if (!fmt2jpg(fr->buf, fr->len, fr->width, fr->height, (pixformat_t)fr->format, q,
+                     &p.encoded, &len))
+            return false;
+        p.quality  = (uint8_t)q;
+        p.plain    = p.clean    = p.encoded;
+        p.plainLen = p.cleanLen = len;
+        return true;
+    }
 
-        if (res != ESP_OK) break;
+    bool ok = true;
+    if (want.plain || fr->format != CAPTURE_FORMAT_JPEG) {
+        ok = annotate_frame(p, want.quality, arena, faces, sizeof(faces));
+        lastDetectMs = millis();
+        if (fr->format != CAPTURE_FORMAT_JPEG) { p.clean = p.plain; p.cleanLen = p.plainLen; }
+    } else if (millis() - lastDetectMs >= STREAM_OVERLAY_DETECT_MS) {
+        lastDetectMs = millis();
+        overlay_detect(fr, arena, faces, sizeof(faces));
     }
+    FramePool::release(arena);
+    if (want.overlay) memcpy(p.faces, faces, sizeof(p.faces));
+    return ok;
+}
+
+// ─── Session end ──────────────────────────────────────────────────────────────
+// httpd frees the session context when a viewer's socket closes, whoever
+// closed it.
+static void stream_session_closed(void *ctx) {
+    Broadcast::removeViewer((int)(intptr_t)ctx - 1);
+    if (Broadcast::viewers() > 0) return;
 
-    // ── Client disconnected (ECONNRESET / browser tab closed) ─────────────────
+    // ── Last viewer gone (ECONNRESET / browser tab closed) ────────────────────
     // If the browser closed the tab or navigated away during enrollment, the
     // enroll_mode?active=0 cleanup call never runs.  Reset state here so the
     // system isn't permanently stuck in enroll mode until reboot.
@@ -275,33 +438,106 @@ static esp_err_t stream_handler(httpd_req_t *req) {
         detection_enabled   = 0;
         recognition_enabled = 0;
         memset(&enrollCtx, 0, sizeof(enrollCtx));
+        enroll_changed();
         Serial.println("[STREAM] Client disconnected – enroll state auto-reset");
     }
+}
 
-    return res;
+// Broadcaster gave up on a viewer that stopped reading.
+static void stream_stalled(int fd) {
+    httpd_sess_trigger_close(stream_httpd, fd);
+}
+
+// GET /stream[?overlay=1][&latency=ms]
+// Hands the socket to the broadcaster and returns, so the stream server is
+// free for the next viewer at once.  `latency` overrides the per-part send
+// time the viewer's rate / quality controller aims for (0 turns it off).
+// The response head is written raw as the broadcaster's prologue: the body
+// is an endless multipart stream that ends when the connection does, so no
+// chunked encoding (mjpeg_part.h).
+static esp_err_t stream_handler(httpd_req_t *req) {
+    static const char *head =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: " MJPEG_CONTENT_TYPE "\r\n"
+        "Access-Control-Allow-Origin: *\r\n"
+        "Cache-Control: no-store\r\n"
+        "Connection: close\r\n"
+        "\r\n";
+    char     query[48], val[8];
+    bool     overlay  = false;
+    uint32_t targetMs = BROADCAST_TARGET_MS;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        overlay = httpd_query_key_value(query, "overlay", val, sizeof(val)) == ESP_OK &&
+                  val[0] == '1';
+        if (httpd_query_key_value(query, "latency", val, sizeof(val)) == ESP_OK)
+            targetMs = (uint32_t)atoi(val);
+    }
+
+    int id = Broadcast::addViewer(httpd_req_to_sockfd(req),
+                                  overlay ? Broadcast::OVERLAY : Broadcast::PLAIN, head, targetMs);
+    if (id < 0) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, "Too many viewers", HTTPD_RESP_USE_STRLEN);
+    }
+    req->sess_ctx = (void *)(intptr_t)(id + 1);
+    req->free_ctx = stream_session_closed;
+    return ESP_OK;
 }
 
 // ══════════════════════════════════════════════════════════════════════════════
 //  PAGE HANDLERS
 // ══════════════════════════════════════════════════════════════════════════════
 
-static esp_err_t send_progmem_html(httpd_req_t *req, const char *html) {
-    httpd_resp_set_type(req, "text/html");
-    const size_t CHUNK = 2048;
-    size_t total = strlen(html);
-    size_t sent  = 0;
-    while (sent < total) {
-        size_t to_send = std::min(CHUNK, total - sent);
-        esp_err_t r = httpd_resp_send_chunk(req, html + sent, (ssize_t)to_send);
-        if (r != ESP_OK) return r;
-        sent += to_send;
+// True when the request's Accept-Encoding allows gzip (RFC 9110 12.5.3):
+// no header means anything goes; otherwise "gzip" or "*" must be listed
+// without q=0, and an explicit "gzip" entry overrides "*".  A header too
+// long for the buffer is taken as accepting gzip.
+static bool accepts_gzip(httpd_req_t *req) {
+    char ae[128];
+    if (httpd_req_get_hdr_value_str(req, "Accept-Encoding", ae, sizeof(ae)) != ESP_OK)
+        return true;
+    int gzip = -1, any = -1;                 // -1 unlisted, 0 refused, 1 accepted
+    char *save = NULL;
+    for (char *tok = strtok_r(ae, ",", &save); tok; tok = strtok_r(NULL, ",", &save)) {
+        while (*tok == ' ' || *tok == '\t') tok++;
+        size_t len = strcspn(tok, " \t;");
+        const char *q = strstr(tok + len, "q=");
+        int ok = !(q && atof(q + 2) <= 0.0);
+        if (len == 4 && strncasecmp(tok, "gzip", 4) == 0)   gzip = ok;
+        else if (len == 1 && tok[0] == '*')                 any  = ok;
     }
-    return httpd_resp_send_chunk(req, NULL, 0);
+    return gzip >= 0 ? gzip == 1 : any == 1;
+}
+
+// Sends a web/ asset exactly as the build gzip'd it, in one response with
+// a Content-Length, or a 304 when the browser's copy has the same ETag.
+// Pages are revalidated on every load ("/" is the login page or the portal,
+// depending on the session); versioned assets are cached for a year.
+// There is no uncompressed copy in flash, so a client that refuses gzip
+// gets a 406.
+static esp_err_t send_asset(httpd_req_t *req, const WebAsset &a) {
+    char inm[64] = "";
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+    if (!accepts_gzip(req)) {
+        httpd_resp_set_status(req, "406 Not Acceptable");
+        httpd_resp_set_type(req, "text/plain");
+        return httpd_resp_send(req, "gzip required", HTTPD_RESP_USE_STRLEN);
+    }
+    httpd_resp_set_hdr(req, "ETag", a.etag);
+    httpd_resp_set_hdr(req, "Cache-Control",
+                       a.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK &&
+        strstr(inm, a.etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    httpd_resp_set_type(req, a.type);
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    return httpd_resp_send(req, (const char *)a.gz, (ssize_t)a.gzLen);
 }
 
 static esp_err_t index_handler(httpd_req_t *req) {
-    if (!authenticated) return send_progmem_html(req, login_html);
-    return send_progmem_html(req, index_html);
+    return send_asset(req, authenticated ? web_index_html : web_login_html);
 }
 
 static esp_err_t login_post_handler(httpd_req_t *req) {
@@ -348,6 +584,116 @@ static esp_err_t send_json(httpd_req_t *req, const String &json) {
     return httpd_resp_send(req, json.c_str(), (ssize_t)json.length());
 }
 
+// ══════════════════════════════════════════════════════════════════════════════
+//  SNAPSHOT
+// ══════════════════════════════════════════════════════════════════════════════
+
+// GET /capture[?max_age=ms]
+// One JPEG, no older than max_age (default SNAPSHOT_MAX_AGE_MS), from the
+// snapshot cache – usually the frame the attendance loop just captured, so
+// pollers never hold a camera subscription.  If-None-Match with the
+// current frame's ETag gets a 304.
+static esp_err_t capture_handler(httpd_req_t *req) {
+    char     query[32], val[8];
+    uint32_t maxAge = SNAPSHOT_MAX_AGE_MS;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "max_age", val, sizeof(val)) == ESP_OK)
+        maxAge = (uint32_t)atoi(val);
+
+    Capture::FrameRef fr = Snapshot::get(maxAge);
+    set_cors_headers(req);
+    if (!fr) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, "No frame", HTTPD_RESP_USE_STRLEN);
+    }
+
+    char tag[SNAPSHOT_ETAG_LEN], inm[96] = "";
+    Snapshot::etag(*fr.get(), tag, sizeof(tag));
+    httpd_resp_set_hdr(req, "ETag", tag);
+    httpd_resp_set_hdr(req, "Access-Control-Expose-Headers", "ETag, X-Timestamp");
+    // Caches may keep it but must ask again: the next frame is ~40 ms away.
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK &&
+        Snapshot::notModified(inm, tag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    char ts[32];
+    snprintf(ts, sizeof(ts), "%d.%06d", (int)fr->ts.tv_sec, (int)fr->ts.tv_usec);
+    httpd_resp_set_hdr(req, "X-Timestamp", ts);
+    httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=capture.jpg");
+    httpd_resp_set_type(req, "image/jpeg");
+    return httpd_resp_send(req, (const char *)fr->buf, (ssize_t)fr->len);
+}
+
+// ══════════════════════════════════════════════════════════════════════════════
+//  LIVE EVENTS
+// ══════════════════════════════════════════════════════════════════════════════
+
+// Journal writer, once per check-in written (SD mutex held).  The portal
+// bumps its counters by `status` and prepends the row to its live log.
+static void publish_checkin(const AttendanceRecord &r) {
+    char uid[sizeof(r.uid)], name[sizeof(r.name)], dept[sizeof(r.dept)];
+    snprintf(uid,  sizeof(uid),  "%s", r.uid);
+    snprintf(name, sizeof(name), "%s", r.name);
+    snprintf(dept, sizeof(dept), "%s", r.dept);
+    json_safe(uid);
+    json_safe(name);
+    json_safe(dept);
+    Events::publish("checkin",
+        "{\"uid\":\"%s\",\"name\":\"%s\",\"dept\":\"%s\",\"date\":\"%s\",\"time\":\"%s\","
+        "\"status\":\"%s\",\"confidence\":\"%s\"}",
+        uid, name, dept, r.date, r.time, r.status, r.confidence[0] ? r.confidence : "-");
+}
+
+// Periodic `status` event, on the hub's sender task.
+static void events_status(char *out, size_t len) {
+    snprintf(out, len, "{\"heap\":%u,\"psram\":%u,\"sd\":%s,\"ntp\":%s,\"uptime\":%lu}",
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+             Bridge::sdIsOk() ? "true" : "false", ntpSynced ? "true" : "false",
+             (unsigned long)(millis() / 1000));
+}
+
+static void events_session_closed(void *ctx) {
+    Events::removeClient((int)(intptr_t)ctx - 1);
+}
+
+// Hub gave up on a client that stopped reading.
+static void events_stalled(int fd) {
+    httpd_sess_trigger_close(camera_httpd, fd);
+}
+
+// GET /api/events  – Server-Sent Events: checkin, enroll, changed, status
+// (event_hub.h).  Hands the socket to the hub and returns, as /stream does.
+// A reconnecting browser sends Last-Event-ID and gets what it missed, or a
+// `resync` when that is no longer in the ring.
+static esp_err_t events_handler(httpd_req_t *req) {
+    static const char *head =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/event-stream\r\n"
+        "Access-Control-Allow-Origin: *\r\n"
+        "Cache-Control: no-store\r\n"
+        "Connection: close\r\n"
+        "\r\n"
+        "retry: 3000\n\n";
+    char     last[16];
+    uint32_t lastId = 0;
+    if (httpd_req_get_hdr_value_str(req, "Last-Event-ID", last, sizeof(last)) == ESP_OK)
+        lastId = (uint32_t)strtoul(last, nullptr, 10);
+
+    int id = Events::addClient(httpd_req_to_sockfd(req), head, lastId);
+    if (id < 0) {
+        // EventSource gives up on a non-200; the portal keeps polling.
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, "Too many event clients", HTTPD_RESP_USE_STRLEN);
+    }
+    req->sess_ctx = (void *)(intptr_t)(id + 1);
+    req->free_ctx = events_session_closed;
+    return ESP_OK;
+}
+
 // ══════════════════════════════════════════════════════════════════════════════
 //  DASHBOARD / STATUS API
 // ══════════════════════════════════════════════════════════════════════════════
@@ -365,6 +711,50 @@ static esp_err_t api_storage_handler(httpd_req_t *req) {
     return send_json(req, Bridge::getStorageJSON());
 }
 
+// GET /api/match_stats[?reset=1]  – recognition score histogram
+static esp_err_t api_match_stats_handler(httpd_req_t *req) {
+    char buf[32], val[4];
+    if (httpd_req_get_url_query_str(req, buf, sizeof(buf)) == ESP_OK &&
+        httpd_query_key_value(buf, "reset", val, sizeof(val)) == ESP_OK && val[0] == '1') {
+        MatchStats::reset();
+    }
+    return send_json(req, MatchStats::toJSON());
+}
+
+// GET /api/perf  – recognition pipeline, frame pool, presence gate, capture broker,
+//                  stream, snapshot, event hub and long-poll counters
+static esp_err_t api_perf_handler(httpd_req_t *req) {
+    Capture::Stats cs = Capture::stats();
+    char cap[160];
+    snprintf(cap, sizeof(cap),
+        "{\"captured\":%u,\"grabFailed\":%u,\"allocFailed\":%u,"
+        "\"subscribers\":%u,\"maxCopyUs\":%u}",
+        (unsigned)cs.captured, (unsigned)cs.grabFailed, (unsigned)cs.allocFailed,
+        (unsigned)cs.subscribers, (unsigned)cs.maxCopyUs);
+    String out = "{\"pipeline\":";
+    out += Pipeline::toJSON();
+    out += ",\"framePool\":";
+    out += FramePool::toJSON();
+    out += ",\"presenceGate\":";
+    out += gSettings.presenceGate ? "true" : "false";
+    out += ",\"presence\":";
+    out += presenceGate.toJSON();
+    out += ",\"capture\":";
+    out += cap;
+    out += ",\"stream\":";
+    out += Broadcast::toJSON();
+    out += ",\"snapshot\":";
+    out += Snapshot::toJSON();
+    out += ",\"events\":";
+    out += Events::toJSON();
+    out += ",\"longPoll\":";
+    out += LongPoll::toJSON();
+    out += ",\"faceRows\":";
+    out += Bridge::faceRowsJSON();
+    out += '}';
+    return send_json(req, out);
+}
+
 static esp_err_t api_sync_ntp_handler(httpd_req_t *req) {
     Bridge::syncNTP();
     set_cors_headers(req);
@@ -393,34 +783,19 @@ static esp_err_t api_users_handler(httpd_req_t *req) {
     return send_json(req, Bridge::getUsersJSON());
 }
 
-// Runtime face-list deletion helper
-static int8_t delete_face_runtime(face_id_name_list *l, const char *name) {
-    if (l->count == 0) return -1;
-    face_id_node *p = l->head, *prev = NULL;
-    while (p) {
-        if (strcmp(p->id_name, name) == 0) {
-            if (p->id_vec) dl_matrix3d_free(p->id_vec);
-            if (!prev) { l->head = p->next; if (p == l->tail) l->tail = NULL; }
-            else       { prev->next = p->next; if (p == l->tail) l->tail = prev; }
-            dl_lib_free(p); l->count--;
-            if (l->count == 0) { l->head = nullptr; l->tail = nullptr; }
-            return 0;
-        }
-        prev = p; p = p->next;
-    }
-    return -1;
-}
-
 static esp_err_t api_delete_handler(httpd_req_t *req) {
     char buf[128];
     if (httpd_req_get_url_query_str(req, buf, sizeof(buf)) == ESP_OK) {
         char name[64] = {0};
         if (httpd_query_key_value(buf, "name", name, sizeof(name)) == ESP_OK) {
             Bridge::deleteUserFromDB(name);
-            if (delete_face_runtime(&id_list, name) == 0) {
-                Bridge::write_face_id_name_list_sdcard(&id_list, myFilePath);
-                Serial.printf("[DB] Deleted user '%s'\n", name);
-            }
+            // The re-rank must not fetch FACE.BIN rows while the gallery's
+            // have moved and the file's have not.
+            Bridge::holdFaceRecords();
+            int slot = faceGallery.remove(name);
+            Bridge::patchFaceGalleryAfterRemove(faceGallery, slot, myFilePath);
+            if (slot >= 0) Serial.printf("[DB] Deleted user '%s'\n", name);
+            Events::publish("changed", "{\"what\":\"users\"}");
         }
     }
     set_cors_headers(req);
@@ -445,6 +820,7 @@ static esp_err_t api_enroll_mode_handler(httpd_req_t *req) {
                 recognition_enabled  = 0;
                 is_enrolling         = 0;
                 memset(&enrollCtx, 0, sizeof(enrollCtx));
+                enroll_changed();
                 Serial.println("[ENROLL] Enrol mode OFF");
             }
         }
@@ -485,6 +861,7 @@ static esp_err_t api_enroll_capture_handler(httpd_req_t *req) {
             // The volatile qualifier ensures the compiler doesn't reorder this.
             enroll_samples_left = ENROLL_CONFIRM_TIMES;
             is_enrolling = 1;
+            enroll_changed();
             Serial.printf("[ENROLL] Capturing for '%s' (id=%s, %d shots needed)\n",
                           enrollCtx.name, enrollCtx.id, ENROLL_CONFIRM_TIMES);
             set_cors_headers(req);
@@ -494,18 +871,46 @@ static esp_err_t api_enroll_capture_handler(httpd_req_t *req) {
     return httpd_resp_send_500(req);
 }
 
-// GET /api/enroll_status
-// Returns current enrollment progress so the browser can poll and show
-// a progress bar without requiring the user to click 5 times.
+// GET /api/enroll_status[?wait=N[&timeout=ms]]
+// Current enrollment progress for the portal's progress bar.
 // Response JSON: {"enrolling":0|1,"left":N,"total":N,"name":"..."}
+// With `wait` (the `left` the portal last saw) the answer is held until
+// enroll_samples_left differs from it or enrolment ends, for up to
+// `timeout` ms (LONGPOLL_DEFAULT_MS): one request per capture instead of
+// one every 400 ms.  The socket is parked with LongPoll so the server
+// stays free meanwhile; with every slot taken it answers at once.
+static bool enroll_moved(uint32_t seen) {
+    return !is_enrolling || enroll_samples_left != (int8_t)seen;
+}
+
+static void enroll_wait_closed(void *ctx) {
+    LongPoll::cancel((int)(intptr_t)ctx - 1);
+}
+
+// An answer could not be written: the connection is gone or wedged.
+static void enroll_wait_failed(int fd) {
+    httpd_sess_trigger_close(camera_httpd, fd);
+}
+
 static esp_err_t api_enroll_status_handler(httpd_req_t *req) {
-    char j[192];
-    snprintf(j, sizeof(j),
-        "{\"enrolling\":%d,\"left\":%d,\"total\":%d,\"name\":\"%s\"}",
-        (int)is_enrolling,
-        (int)enroll_samples_left,
-        ENROLL_CONFIRM_TIMES,
-        enrollCtx.name);
+    char query[48], val[12];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "wait", val, sizeof(val)) == ESP_OK) {
+        uint32_t seen    = (uint32_t)atoi(val);
+        uint32_t timeout = LONGPOLL_DEFAULT_MS;
+        if (httpd_query_key_value(query, "timeout", val, sizeof(val)) == ESP_OK)
+            timeout = (uint32_t)atoi(val);
+        if (!enroll_moved(seen)) {
+            int id = LongPoll::park(httpd_req_to_sockfd(req), seen, timeout);
+            if (id >= 0) {
+                req->sess_ctx = (void *)(intptr_t)(id + 1);
+                req->free_ctx = enroll_wait_closed;
+                return ESP_OK;
+            }
+        }
+    }
+    char j[LONGPOLL_BODY_MAX];
+    enroll_status_json(j, sizeof(j));
     return send_json(req, String(j));
 }
 
@@ -513,7 +918,14 @@ static esp_err_t api_enroll_status_handler(httpd_req_t *req) {
 //  ATTENDANCE API
 // ══════════════════════════════════════════════════════════════════════════════
 
+// Bridge::ChunkSink onto a chunked response.
+static bool send_chunk(void *ctx, const char *data, size_t len) {
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, data, (ssize_t)len) == ESP_OK;
+}
+
 // GET /api/logs?date=YYYY-MM-DD&dept=X&status=X&search=X
+// Streamed: rows go out as they are read, through a 1 KB buffer, so a busy
+// day costs no more heap than a quiet one and is never cut short.
 static esp_err_t api_logs_handler(httpd_req_t *req) {
     char buf[256] = {0};
     String date="", dept="", status="", search="";
@@ -525,7 +937,13 @@ static esp_err_t api_logs_handler(httpd_req_t *req) {
         if (httpd_query_key_value(buf, "search", tmp, sizeof(tmp)) == ESP_OK) search = urlDecode(tmp);
     }
     esp_task_wdt_reset();
-    return send_json(req, Bridge::getLogsJSON(date, dept, status, search));
+    set_cors_headers(req);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    httpd_resp_set_type(req, "application/json");
+    if (!Bridge::streamLogsJSON(date.c_str(), dept.c_str(), status.c_str(), search.c_str(),
+                                send_chunk, req))
+        return ESP_FAIL;    // client went away mid-stream; httpd closes the socket
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
 // GET /api/logs_range?days=N
@@ -569,27 +987,98 @@ static esp_err_t api_manual_handler(httpd_req_t *req) {
     }
     esp_task_wdt_reset();
     bool ok = Bridge::manualAttendance(rec);
+    if (ok) Events::publish("changed", "{\"what\":\"logs\"}");
     set_cors_headers(req);
     return httpd_resp_send(req, ok ? "OK" : "FAIL: write error", HTTPD_RESP_USE_STRLEN);
 }
 
+// "bytes=a-b", "bytes=a-" or "bytes=-n" against a body of `total` bytes.
+// 1: a satisfiable range in [first, last]; 0: none, or one we do not
+// handle (several ranges) – send it all; -1: unsatisfiable (416).
+static int parse_range(const char *hdr, uint32_t total, uint32_t &first, uint32_t &last) {
+    if (strncmp(hdr, "bytes=", 6) != 0 || strchr(hdr, ',')) return 0;
+    const char *p = hdr + 6;
+    char *end;
+    if (*p == '-') {                                   // suffix: the last n bytes
+        unsigned long n = strtoul(p + 1, &end, 10);
+        if (end == p + 1 || *end) return 0;
+        if (n == 0 || total == 0) return -1;
+        first = n < total ? total - (uint32_t)n : 0;
+        last  = total - 1;
+        return 1;
+    }
+    unsigned long a = strtoul(p, &end, 10);
+    if (end == p || *end != '-') return 0;
+    p = end + 1;
+    unsigned long b = total ? total - 1 : 0;
+    if (*p) {
+        b = strtoul(p, &end, 10);
+        if (*end || b < a) return 0;
+        if (b >= total) b = total - 1;
+    }
+    if (a >= total) return -1;
+    first = (uint32_t)a;
+    last  = (uint32_t)b;
+    return 1;
+}
+
 // GET /api/download_csv?date=YYYY-MM-DD
+//     /api/download_csv?from=YYYY-MM-DD&to=YYYY-MM-DD   (days concatenated)
+// Streamed from the card; honours a single Range so an interrupted
+// download can resume.
 static esp_err_t api_download_csv_handler(httpd_req_t *req) {
-    char buf[64] = {0};
-    String date = "";
+    char buf[96] = {0};
+    char from[12] = "", to[12] = "";
     if (httpd_req_get_url_query_str(req, buf, sizeof(buf)) == ESP_OK) {
-        char tmp[32];
-        if (httpd_query_key_value(buf, "date", tmp, sizeof(tmp)) == ESP_OK)
-            date = String(tmp);
+        if (httpd_query_key_value(buf, "date", from, sizeof(from)) == ESP_OK)
+            strcpy(to, from);
+        httpd_query_key_value(buf, "from", from, sizeof(from));
+        httpd_query_key_value(buf, "to",   to,   sizeof(to));
     }
+    String today = Bridge::getCurrentDateStr();
+    if (!from[0] && !to[0]) snprintf(from, sizeof(from), "%s", today.c_str());
+    if (!to[0])   snprintf(to,   sizeof(to),   "%s", strcmp(from, today.c_str()) > 0
+                                                     ? from : today.c_str());
+    if (!from[0]) snprintf(from, sizeof(from), "%s", to);
+
     esp_task_wdt_reset();
-    String csv = Bridge::downloadAttendanceCSV(date);
     set_cors_headers(req);
+    int32_t total = Bridge::csvExportSize(from, to);
+    if (total < 0) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        return httpd_resp_send(req, "FAIL: bad date range", HTTPD_RESP_USE_STRLEN);
+    }
+
+    char disp[80], range[48], hdr[48];
+    if (strcmp(from, to) == 0)
+        snprintf(disp, sizeof(disp), "attachment; filename=attendance_%s.csv", from);
+    else
+        snprintf(disp, sizeof(disp), "attachment; filename=attendance_%s_to_%s.csv", from, to);
+    httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+
+    uint32_t first = 0, last = (uint32_t)total - 1;
+    int      ranged = 0;
+    if (httpd_req_get_hdr_value_str(req, "Range", hdr, sizeof(hdr)) == ESP_OK)
+        ranged = parse_range(hdr, (uint32_t)total, first, last);
+    if (ranged < 0) {
+        snprintf(range, sizeof(range), "bytes */%u", (unsigned)total);
+        httpd_resp_set_status(req, "416 Range Not Satisfiable");
+        httpd_resp_set_hdr(req, "Content-Range", range);
+        return httpd_resp_send(req, NULL, 0);
+    }
+    if (ranged) {
+        snprintf(range, sizeof(range), "bytes %u-%u/%u", (unsigned)first, (unsigned)last,
+                 (unsigned)total);
+        httpd_resp_set_status(req, "206 Partial Content");
+        httpd_resp_set_hdr(req, "Content-Range", range);
+    }
     httpd_resp_set_type(req, "text/csv");
-    String fname = "attachment; filename=attendance_"
-                 + (date.length() ? date : Bridge::getCurrentDateStr()) + ".csv";
-    httpd_resp_set_hdr(req, "Content-Disposition", fname.c_str());
-    return httpd_resp_send(req, csv.c_str(), (ssize_t)csv.length());
+    httpd_resp_set_hdr(req, "Content-Disposition", disp);
+    if (!Bridge::streamCSVExport(from, to, first, last - first + 1, send_chunk, req)) {
+        Serial.printf("[HTTP] CSV export %s..%s aborted\n", from, to);
+        return ESP_FAIL;        // the client sees a broken chunked body, not a short file
+    }
+    return send_chunk(req, NULL, 0) ? ESP_OK : ESP_FAIL;
 }
 
 // GET /api/clear_logs?date=YYYY-MM-DD
@@ -602,6 +1091,7 @@ static esp_err_t api_clear_logs_handler(httpd_req_t *req) {
             date = String(tmp);
     }
     bool ok = Bridge::clearAttendanceLogs(date);
+    if (ok) Events::publish("changed", "{\"what\":\"logs\"}");
     set_cors_headers(req);
     return httpd_resp_send(req, ok ? "OK" : "FAIL", HTTPD_RESP_USE_STRLEN);
 }
@@ -613,7 +1103,9 @@ static esp_err_t api_clear_logs_handler(httpd_req_t *req) {
 static esp_err_t api_factory_reset_handler(httpd_req_t *req) {
     Serial.println("[RESET] Factory reset requested via portal");
 
-    // 1. Wipe SD (logs, FACE.BIN, users.txt, settings.json)
+    // 1. Wipe SD (logs, FACE.BIN, users.txt, settings.json).  Queued check-ins
+    //    are flushed first so none land in the fresh /atd after the wipe.
+    Journal::flush();
     bool ok = Bridge::factoryReset();
     if (!ok) {
         Serial.println("[RESET] SD wipe failed");
@@ -621,20 +1113,10 @@ static esp_err_t api_factory_reset_handler(httpd_req_t *req) {
         return httpd_resp_send(req, "FAIL: SD wipe error", HTTPD_RESP_USE_STRLEN);
     }
 
-    // 2. Clear in-memory face list so recognition stops immediately
+    // 2. Clear in-memory faces so recognition stops immediately
     //    (no stale faces matched against a now-empty database)
-    if (id_list.head) {
-        face_id_node *p = id_list.head;
-        while (p) {
-            face_id_node *next = p->next;
-            if (p->id_vec) dl_matrix3d_free(p->id_vec);
-            dl_lib_free(p);
-            p = next;
-        }
-    }
-    id_list.head    = nullptr;
-    id_list.tail    = nullptr;
-    id_list.count   = 0;
+    faceGallery.clear();
+    clear_face_id_list(&id_list);
 
     // 3. Reset all enrol/detection flags in case they were active
     is_enrolling        = 0;
@@ -642,10 +1124,12 @@ static esp_err_t api_factory_reset_handler(httpd_req_t *req) {
     detection_enabled   = 0;
     recognition_enabled = 0;
     memset(&enrollCtx, 0, sizeof(enrollCtx));
+    enroll_changed();
 
     // 4. Reload default settings into gSettings
     setDefaultSettings(gSettings);
 
+    Events::publish("changed", "{\"what\":\"all\"}");
     Serial.println("[RESET] Done. Device ready for fresh enrolment.");
     set_cors_headers(req);
     return httpd_resp_send(req, "OK", 2);
@@ -662,14 +1146,18 @@ static esp_err_t api_settings_get_handler(httpd_req_t *req) {
         "{\"startTime\":\"%s\",\"endTime\":\"%s\","
         "\"lateTime\":\"%s\",\"absentTime\":\"%s\","
         "\"confidence\":%d,\"buzzerEnabled\":%s,\"autoMode\":%s,"
-        "\"gmtOffsetSec\":%ld,\"ntpServer\":\"%s\"}",
+        "\"gmtOffsetSec\":%ld,\"ntpServer\":\"%s\",\"galleryInt8\":%s,\"maxFaces\":%d,"
+        "\"presenceGate\":%s}",
         gSettings.startTime, gSettings.endTime,
         gSettings.lateTime,  gSettings.absentTime,
         gSettings.confidence,
         gSettings.buzzerEnabled ? "true" : "false",
         gSettings.autoMode      ? "true" : "false",
         gSettings.gmtOffsetSec,
-        gSettings.ntpServer);
+        gSettings.ntpServer,
+        gSettings.galleryInt8   ? "true" : "false",
+        maxFacesPerFrame(),
+        gSettings.presenceGate  ? "true" : "false");
     return send_json(req, String(j));
 }
 
@@ -694,6 +1182,11 @@ static esp_err_t api_settings_post_handler(httpd_req_t *req) {
     s = getFormField(body, "confidence");   if (s.length()) gSettings.confidence   = s.toInt();
     s = getFormField(body, "buzzerEnabled"); gSettings.buzzerEnabled = (s == "1");
     s = getFormField(body, "autoMode");      gSettings.autoMode      = (s == "1");
+    s = getFormField(body, "galleryInt8");   if (s.length()) gSettings.galleryInt8 = (s == "1");
+    s = getFormField(body, "maxFaces");      if (s.length()) gSettings.maxFaces    = s.toInt();
+    s = getFormField(body, "presenceGate");  if (s.length()) gSettings.presenceGate = (s == "1");
+    // O-net keeps as many boxes as the attendance task will embed.
+    mtmn_config.o_threshold.candidate_number = maxFacesPerFrame();
 
     Bridge::saveSettings(gSettings);
     Serial.println("[CFG] Settings updated via portal");
@@ -707,8 +1200,8 @@ static esp_err_t api_settings_post_handler(httpd_req_t *req) {
 void startCameraServer() {
     // ── NOTE: mtmn_config and id_list are initialised in initFaceRecognition()
     //    (main.cpp) before this function is called.  Do NOT re-init them here —
-    //    double-init resets the face list that was just loaded from SD.
-    //    read_face_id_name_list_sdcard is called there too.
+    //    double-init resets the enrolment list.  The face gallery is loaded
+    //    from SD there too (Bridge::loadFaceGallery).
 
     // Suppress "httpd_sock_err: error in recv : 104" (ECONNRESET) warnings —
     // these fire every time a browser closes a tab or aborts a fetch, which is
@@ -719,7 +1212,6 @@ void startCameraServer() {
     esp_log_level_set("httpd_uri",  ESP_LOG_ERROR);
 
     httpd_config_t cfg  = HTTPD_DEFAULT_CONFIG();
-    cfg.max_uri_handlers  = 27;  // bumped for /api/factory_reset and /api/server_date
     cfg.stack_size        = 8192;
     // Shorter socket timeouts: prevent a stalled client from holding a httpd
     // worker thread for the full default 60-second period, which blocks other
@@ -731,11 +1223,15 @@ void startCameraServer() {
         {"/",                     HTTP_GET,  index_handler,              NULL},
         {"/login",                HTTP_POST, login_post_handler,         NULL},
         {"/logout",               HTTP_GET,  logout_handler,             NULL},
+        {"/capture",              HTTP_GET,  capture_handler,            NULL},
         // Dashboard
         {"/api/stats",            HTTP_GET,  api_stats_handler,          NULL},
         {"/api/status",           HTTP_GET,  api_status_handler,         NULL},
         {"/api/storage",          HTTP_GET,  api_storage_handler,        NULL},
         {"/api/sync_ntp",         HTTP_GET,  api_sync_ntp_handler,       NULL},
+        {"/api/match_stats",      HTTP_GET,  api_match_stats_handler,    NULL},
+        {"/api/perf",             HTTP_GET,  api_perf_handler,           NULL},
+        {"/api/events",           HTTP_GET,  events_handler,             NULL},
         // Users
         {"/api/users",            HTTP_GET,  api_users_handler,          NULL},
         {"/api/delete_user",      HTTP_GET,  api_delete_handler,         NULL},
@@ -757,7 +1253,16 @@ void startCameraServer() {
         // Server date (used by portal to sync attendance tab filter with firmware date)
         {"/api/server_date",      HTTP_GET,  api_server_date_handler,    NULL},
     };
-
+    // One handler slot per route above, so adding a route can't
+    // silently fail to register.
+    cfg.max_uri_handlers = sizeof(uris) / sizeof(uris[0]);
+
+    Snapshot::begin();
+    Events::setStallHandler(events_stalled);
+    Events::setStatusSource(events_status);
+    Events::begin();
+    Bridge::setCheckinHook(publish_checkin);
+    LongPoll::begin(enroll_moved, enroll_status_json, enroll_wait_failed);
     if (httpd_start(&camera_httpd, &cfg) == ESP_OK) {
         for (auto &u : uris)
             httpd_register_uri_handler(camera_httpd, &u);
@@ -766,7 +1271,10 @@ void startCameraServer() {
         Serial.println("[HTTP] Failed to start main server!");
     }
 
-    // Stream server on port 81
+    // Stream server on port 81.  Handlers return at once (the broadcaster
+    // owns the sockets), so one server task serves every viewer.
+    Broadcast::setStallHandler(stream_stalled);
+    Broadcast::begin(stream_render, 1);
     cfg.server_port += 1;
     cfg.ctrl_port   += 1;
     httpd_uri_t stream_uri = {"/stream", HTTP_GET, stream_handler, NULL};
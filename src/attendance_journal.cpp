@@ -0,0 +1,153 @@
+// attendance_journal.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Write-behind attendance journal: lock-free record queue + SD writer task.
+
+#include "attendance_journal.h"
+
+#include <Arduino.h>
+#include <atomic>
+#include "bounded_queue.h"
+#include "os_port.h"
+#include "sd_card.h"
+
+#if !defined(FACEGUARD_HOST)
+#include "esp_system.h"   // esp_register_shutdown_handler
+#endif
+
+static_assert(JOURNAL_BATCH_MAX <= JOURNAL_CAPACITY, "batch cannot exceed the queue");
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Module-level state
+// ═══════════════════════════════════════════════════════════════════════════════
+static BoundedQueue<AttendanceRecord, JOURNAL_CAPACITY> _queue;
+
+static OsSignal *_wake       = nullptr;   // batch full / flush requested
+static uint32_t  _maxFlushMs = JOURNAL_MAX_FLUSH_MS;
+
+// posted counts records accepted into the queue, done counts records the
+// writer has finished with (written, duplicate or dropped).  flush() waits
+// for done to catch up with the posted value it saw on entry.
+static std::atomic<uint32_t> _posted{0};
+static std::atomic<uint32_t> _done{0};
+
+static std::atomic<uint32_t> _written{0};
+static std::atomic<uint32_t> _duplicates{0};
+static std::atomic<uint32_t> _batches{0};
+static std::atomic<uint32_t> _syncFallback{0};
+static std::atomic<uint32_t> _maxDepth{0};
+static std::atomic<uint32_t> _maxBatchMs{0};
+
+static void _raiseMax(std::atomic<uint32_t> &m, uint32_t v) {
+    uint32_t cur = m.load();
+    while (v > cur && !m.compare_exchange_weak(cur, v)) {}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Writer task
+// ═══════════════════════════════════════════════════════════════════════════════
+// Drains the whole queue, JOURNAL_CAPACITY records per logAttendanceBatch.
+// The batch buffer is static: only the writer task touches it, and 4 KB is
+// too much to put on a task stack.
+static void _drain() {
+    static AttendanceRecord batch[JOURNAL_CAPACITY];
+    for (;;) {
+        int n = 0;
+        while (n < JOURNAL_CAPACITY && _queue.pop(batch[n])) n++;
+        if (n == 0) return;
+
+        unsigned long t0  = millis();
+        int           dup = 0;
+        int           w   = Bridge::logAttendanceBatch(batch, n, &dup);
+        _raiseMax(_maxBatchMs, (uint32_t)(millis() - t0));
+        _batches++;
+        _written    += (uint32_t)w;
+        _duplicates += (uint32_t)dup;
+        if (w + dup < n)
+            Serial.printf("[JRN] %d record(s) could not be written\n", n - w - dup);
+        _done += (uint32_t)n;
+    }
+}
+
+static void _writerTask(void *) {
+    for (;;) {
+        // Wakes early when post() fills a batch or flush() asks; otherwise
+        // every maxFlushMs, which bounds how long a record can sit queued.
+        _wake->take(_maxFlushMs);
+        _drain();
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Public API
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace Journal {
+
+bool begin(uint32_t maxFlushMs) {
+    if (_wake) return true;
+    _maxFlushMs = maxFlushMs ? maxFlushMs : JOURNAL_MAX_FLUSH_MS;
+    _wake       = new OsSignal();
+    // Low priority, no core affinity: the writer only runs when the
+    // recognition and HTTP tasks leave the CPU idle.
+    if (!osTaskStart(_writerTask, "atd_jrn", 6144, nullptr, 1, -1)) {
+        Serial.println("[JRN] Writer task failed to start – logging synchronously");
+        delete _wake;
+        _wake = nullptr;
+        return false;
+    }
+#if !defined(FACEGUARD_HOST)
+    // esp_restart() runs shutdown handlers first: give queued check-ins a
+    // chance to reach the card before the reboot.
+    esp_register_shutdown_handler([]() { Journal::flush(1000); });
+#endif
+    Serial.printf("[JRN] Write-behind journal: %d slots, batch %d, max delay %lu ms\n",
+                  JOURNAL_CAPACITY, JOURNAL_BATCH_MAX, (unsigned long)_maxFlushMs);
+    return true;
+}
+
+void post(const AttendanceRecord &rec) {
+    AttendanceRecord r = rec;
+    strncpy(r.date, Bridge::getCurrentDateStr().c_str(), sizeof(r.date) - 1);
+    strncpy(r.time, Bridge::getCurrentHHMM().c_str(),    sizeof(r.time) - 1);
+    r.status[0] = '\0';   // derived from time by the writer
+
+    if (!_wake || !_queue.push(r)) {
+        // Not started, or the card has fallen so far behind that the queue is
+        // full: write in the caller rather than drop a check-in.
+        if (_wake) _syncFallback++;
+        Bridge::logAttendanceBatch(&r, 1);
+        return;
+    }
+    _posted++;
+    uint32_t depth = (uint32_t)_queue.size();
+    _raiseMax(_maxDepth, depth);
+    if (depth >= JOURNAL_BATCH_MAX) _wake->give();
+}
+
+bool flush(uint32_t timeoutMs) {
+    if (!_wake) return true;
+    uint32_t      target = _posted.load();
+    unsigned long t0     = millis();
+    _wake->give();
+    while ((int32_t)(_done.load() - target) < 0) {
+        if (millis() - t0 >= timeoutMs) {
+            Serial.printf("[JRN] Flush timed out with %u record(s) pending\n",
+                          (unsigned)(target - _done.load()));
+            return false;
+        }
+        osDelayMs(5);
+    }
+    return true;
+}
+
+Stats stats() {
+    Stats s;
+    s.posted       = _posted.load();
+    s.written      = _written.load();
+    s.duplicates   = _duplicates.load();
+    s.batches      = _batches.load();
+    s.syncFallback = _syncFallback.load();
+    s.maxDepth     = _maxDepth.load();
+    s.maxBatchMs   = _maxBatchMs.load();
+    return s;
+}
+
+} // namespace Journal
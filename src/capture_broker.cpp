@@ -0,0 +1,229 @@
+// capture_broker.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Single camera owner: grab once, copy out of DMA, fan out by reference.
+
+#include "capture_broker.h"
+
+#include <Arduino.h>
+#include <string.h>
+#include <new>
+#include "os_port.h"
+
+namespace Capture {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Module-level state
+// ═══════════════════════════════════════════════════════════════════════════════
+struct Subscriber {
+    bool                  used;
+    uint32_t              lastSeq;     // newest frame handed to this subscriber
+    OsSignal             *sig;         // given on every publish
+    std::atomic<uint32_t> delivered;
+    std::atomic<uint32_t> skipped;
+};
+
+static FrameSource *_src      = nullptr;
+static OsMutex     *_mtx      = nullptr;   // _latest, _subs[].used/lastSeq, _subCount
+static OsSignal    *_wake     = nullptr;   // first subscriber arrived
+static FrameRef     _latest;
+static uint32_t     _seq      = 0;
+static uint32_t     _subCount = 0;
+static Subscriber   _subs[CAPTURE_MAX_SUBSCRIBERS];
+
+static std::atomic<uint32_t> _captured{0};
+static std::atomic<uint32_t> _grabFailed{0};
+static std::atomic<uint32_t> _allocFailed{0};
+static std::atomic<uint32_t> _maxCopyUs{0};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Frames
+// ═══════════════════════════════════════════════════════════════════════════════
+// Header and pixel data share one PSRAM-first block.
+static Frame *_copyFrame(const FrameSource::Grab &g) {
+    void *p = osAllocLarge(sizeof(Frame) + g.len, 16);
+    if (!p) return nullptr;
+    Frame *f  = new (p) Frame();
+    f->buf    = (uint8_t *)p + sizeof(Frame);
+    f->len    = g.len;
+    f->width  = g.width;
+    f->height = g.height;
+    f->format = g.format;
+    f->refs   = 1;
+    memcpy(f->buf, g.buf, g.len);
+    return f;
+}
+
+void FrameRef::reset() {
+    if (_f && --_f->refs == 0) {
+        _f->~Frame();
+        osFreeLarge(_f);
+    }
+    _f = nullptr;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Broker task
+// ═══════════════════════════════════════════════════════════════════════════════
+static void _brokerTask(void *) {
+    for (;;) {
+        if (_subCount == 0) {
+            // Nobody is watching: leave the camera alone until subscribe().
+            _wake->take(CAPTURE_IDLE_POLL_MS);
+            continue;
+        }
+
+        FrameSource::Grab g = {};
+        if (!_src->grab(g)) {
+            _grabFailed++;
+            osDelayMs(20);
+            continue;
+        }
+        uint32_t ms = millis();
+        struct timeval ts;
+        gettimeofday(&ts, NULL);
+
+        unsigned long t0 = micros();
+        Frame *f = _copyFrame(g);
+        _src->release(g);           // DMA buffer back to the driver right away
+        if (!f) {
+            _allocFailed++;
+            osDelayMs(20);
+            continue;
+        }
+        uint32_t us = (uint32_t)(micros() - t0);
+        if (us > _maxCopyUs) _maxCopyUs = us;
+
+        f->ms = ms;
+        f->ts = ts;
+        FrameRef incoming(f), previous;
+        {
+            OsLock l(*_mtx);
+            f->seq   = ++_seq;
+            previous = _latest;
+            _latest  = incoming;
+            for (auto &s : _subs)
+                if (s.used) s.sig->give();
+        }
+        _captured++;
+        // previous (and incoming) drop their references here, outside the lock.
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Public API
+// ═══════════════════════════════════════════════════════════════════════════════
+bool begin(FrameSource *src, int core) {
+    if (_src) return true;
+    if (!src) return false;
+    _mtx  = new OsMutex();
+    _wake = new OsSignal();
+    for (auto &s : _subs) s.sig = new OsSignal();
+    _src = src;
+    // Above the attendance task so a frame is always ready when it asks; the
+    // task itself mostly blocks in the driver waiting for the next VSYNC.
+    if (!osTaskStart(_brokerTask, "capture", 4096, nullptr, 3, core)) {
+        Serial.println("[CAP] Broker task failed to start");
+        _src = nullptr;
+        return false;
+    }
+    Serial.printf("[CAP] Capture broker started (%d subscriber slots)\n",
+                  CAPTURE_MAX_SUBSCRIBERS);
+    return true;
+}
+
+int subscribe() {
+    if (!_mtx) return -1;
+    OsLock l(*_mtx);
+    for (int i = 0; i < CAPTURE_MAX_SUBSCRIBERS; i++) {
+        Subscriber &s = _subs[i];
+        if (s.used) continue;
+        s.used      = true;
+        s.lastSeq   = _seq;          // wait for a fresh frame, not a stale one
+        s.delivered = 0;
+        s.skipped   = 0;
+        if (_subCount++ == 0) _wake->give();
+        return i;
+    }
+    return -1;
+}
+
+void unsubscribe(int sub) {
+    if (!_mtx || sub < 0 || sub >= CAPTURE_MAX_SUBSCRIBERS) return;
+    OsLock l(*_mtx);
+    if (!_subs[sub].used) return;
+    _subs[sub].used = false;
+    _subCount--;
+}
+
+FrameRef next(int sub, uint32_t timeoutMs) {
+    if (!_mtx || sub < 0 || sub >= CAPTURE_MAX_SUBSCRIBERS) return FrameRef();
+    Subscriber   &s     = _subs[sub];
+    unsigned long start = millis();
+    for (;;) {
+        {
+            OsLock l(*_mtx);
+            if (_latest && _latest->seq != s.lastSeq) {
+                s.skipped  += _latest->seq - s.lastSeq - 1;
+                s.lastSeq   = _latest->seq;
+                s.delivered++;
+                return _latest;
+            }
+        }
+        // The signal may be left over from a frame already taken: re-check.
+        unsigned long waited = millis() - start;
+        if (waited >= timeoutMs) return FrameRef();
+        s.sig->take(timeoutMs - (uint32_t)waited);
+    }
+}
+
+FrameRef latest() {
+    if (!_mtx) return FrameRef();
+    OsLock l(*_mtx);
+    return _latest;
+}
+
+Stats stats() {
+    Stats st = {};
+    st.captured    = _captured;
+    st.grabFailed  = _grabFailed;
+    st.allocFailed = _allocFailed;
+    st.maxCopyUs   = _maxCopyUs;
+    if (_mtx) {
+        OsLock l(*_mtx);
+        st.subscribers = _subCount;
+    }
+    for (int i = 0; i < CAPTURE_MAX_SUBSCRIBERS; i++) {
+        st.delivered[i] = _subs[i].delivered;
+        st.skipped[i]   = _subs[i].skipped;
+    }
+    return st;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Camera source (device)
+// ═══════════════════════════════════════════════════════════════════════════════
+#if !defined(FACEGUARD_HOST)
+class CameraSource : public FrameSource {
+public:
+    bool grab(Grab &g) override {
+        camera_fb_t *fb = esp_camera_fb_get();
+        if (!fb) return false;
+        g.buf    = fb->buf;
+        g.len    = fb->len;
+        g.width  = (uint16_t)fb->width;
+        g.height = (uint16_t)fb->height;
+        g.format = (uint8_t)fb->format;
+        g.handle = fb;
+        return true;
+    }
+    void release(Grab &g) override {
+        esp_camera_fb_return((camera_fb_t *)g.handle);
+    }
+};
+
+FrameSource *cameraSource() {
+    static CameraSource cam;
+    return &cam;
+}
+#endif
+
+} // namespace Capture
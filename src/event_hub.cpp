@@ -0,0 +1,311 @@
+// event_hub.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Server-Sent Events: a RAM ring of recent events, and one task that feeds
+// every client socket from it without blocking (see event_hub.h).
+
+#include "event_hub.h"
+
+#include <errno.h>
+#include <stdarg.h>
+#include <string.h>
+#include <atomic>
+#include <sys/socket.h>
+#include "os_port.h"
+
+#if defined(FACEGUARD_HOST)
+  #include <time.h>
+#else
+  #include "esp_system.h"       // esp_random()
+#endif
+
+#ifndef MSG_NOSIGNAL
+  #define MSG_NOSIGNAL 0        // lwip never raises SIGPIPE
+#endif
+
+namespace Events {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Module-level state
+// ═══════════════════════════════════════════════════════════════════════════════
+struct Event {
+    uint32_t id;
+    char     type[16];
+    char     data[EVENTS_DATA_MAX];
+};
+
+struct Client {
+    bool     used;
+    uint8_t  gen;               // bumped per addClient(), part of the id
+    int      fd;
+    uint32_t next;              // id of the next event to queue
+    char     buf[EVENTS_CLIENT_BUF];
+    size_t   len, off;          // buf[off, len) not yet accepted by the socket
+    uint32_t progressMs;        // millis() of the last accepted byte, or of
+                                // the moment buf last went from empty to not
+    uint32_t activeMs;          // millis() of the last thing queued (ping timer)
+    std::atomic<uint32_t> sent, resyncs, bytes;
+};
+
+static OsMutex  *_mtx   = nullptr;      // _ring, _newest, _clients[]
+static OsSignal *_wake  = nullptr;      // sender: new event or new client
+static Event    *_ring  = nullptr;      // EVENTS_RING_LEN, PSRAM
+static uint32_t  _newest = 0;           // id of the newest event in the ring
+static uint32_t  _count  = 0;           // events in the ring
+static int       _clientCount = 0;
+static Client    _clients[EVENTS_MAX_CLIENTS];
+static void    (*_onStall)(int fd) = nullptr;
+static void    (*_status)(char *out, size_t len) = nullptr;
+
+static std::atomic<uint32_t> _published{0}, _truncated{0}, _stalled{0};
+
+// Ids are unsigned and wrap; compare through the signed difference.
+static int32_t _diff(uint32_t a, uint32_t b) { return (int32_t)(a - b); }
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Sender task
+// ═══════════════════════════════════════════════════════════════════════════════
+// Appends to c.buf if it fits whole.  False (nothing written) if not.
+static bool _append(Client &c, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+static bool _append(Client &c, const char *fmt, ...) {
+    size_t room = sizeof(c.buf) - c.len;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(c.buf + c.len, room, fmt, ap);
+    va_end(ap);
+    if (n < 0 || (size_t)n >= room) return false;
+    if (c.len == c.off) c.progressMs = millis();    // the stall clock starts now
+    c.len += (size_t)n;
+    return true;
+}
+
+// Moves whatever c can take from the ring into its buffer.
+static void _fill(Client &c, uint32_t now) {
+    if (c.off) {
+        memmove(c.buf, c.buf + c.off, c.len - c.off);
+        c.len -= c.off;
+        c.off  = 0;
+    }
+    uint32_t oldest = _newest - _count + 1;
+    if (_diff(c.next, oldest) < 0 && _count) {
+        // The ring has moved past this client: tell it to reload, then go on
+        // from the newest event.
+        if (!_append(c, "id: %u\nevent: resync\ndata: {}\n\n", (unsigned)_newest)) return;
+        c.next = _newest + 1;
+        c.resyncs++;
+        c.activeMs = now;
+    }
+    while (_count && _diff(c.next, _newest) <= 0) {
+        const Event &e = _ring[c.next & (EVENTS_RING_LEN - 1)];
+        if (!_append(c, "id: %u\nevent: %s\ndata: %s\n\n", (unsigned)e.id, e.type, e.data)) break;
+        c.next++;
+        c.sent++;
+        c.activeMs = now;
+    }
+    // Keeps idle connections (and anything in between) from timing out, and
+    // finds dead ones.
+    if (c.len == 0 && now - c.activeMs >= EVENTS_PING_MS && _append(c, ": ping\n\n"))
+        c.activeMs = now;
+}
+
+// Writes what the socket takes without blocking.  False on a socket error.
+static bool _write(Client &c, uint32_t now) {
+    while (c.off < c.len) {
+        ssize_t r = send(c.fd, c.buf + c.off, c.len - c.off, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (r < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        if (r == 0) return true;
+        c.off       += (size_t)r;
+        c.bytes     += (uint32_t)r;
+        c.progressMs = now;
+    }
+    return true;
+}
+
+static void _drop(Client &c) {
+    c.used = false;
+    _clientCount--;
+}
+
+static void _senderTask(void *) {
+    uint32_t lastStatus = 0;
+    for (;;) {
+        bool backlog = false;
+        bool statusDue;
+        {
+            OsLock   l(*_mtx);
+            uint32_t now = millis();
+            statusDue = _status && _clientCount && now - lastStatus >= EVENTS_STATUS_MS;
+            for (auto &c : _clients) {
+                if (!c.used) continue;
+                _fill(c, now);
+                if (c.off == c.len) continue;
+                if (!_write(c, now)) {
+                    // Broken socket: httpd sees it too and closes the session.
+                    Serial.printf("[EVT] Client on socket %d gone (errno %d)\n", c.fd, errno);
+                    _drop(c);
+                } else if (c.off < c.len) {
+                    if (now - c.progressMs >= EVENTS_STALL_MS) {
+                        Serial.printf("[EVT] Client on socket %d stalled – dropped\n", c.fd);
+                        _stalled++;
+                        if (_onStall) _onStall(c.fd);
+                        _drop(c);
+                    } else {
+                        backlog = true;
+                    }
+                }
+            }
+        }
+        if (statusDue) {
+            // Built outside the lock: the source may take the SD mutex.
+            char buf[EVENTS_DATA_MAX];
+            buf[0] = '\0';
+            _status(buf, sizeof(buf));
+            if (buf[0]) publish("status", "%s", buf);
+            lastStatus = millis();
+            continue;
+        }
+        // Sleep until an event or a client arrives.  While a socket is full,
+        // retry it every EVENTS_POLL_MS (waiting in select() instead would
+        // hold new events back from everyone else); otherwise wake for the
+        // next ping / status check.
+        _wake->take(backlog ? EVENTS_POLL_MS : 1000);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Public API
+// ═══════════════════════════════════════════════════════════════════════════════
+bool begin(int core) {
+    if (_mtx) return true;
+    _ring = (Event *)osAllocLarge(sizeof(Event) * EVENTS_RING_LEN, 4);
+    if (!_ring) {
+        Serial.println("[EVT] No memory for the event ring");
+        return false;
+    }
+    _mtx  = new OsMutex();
+    _wake = new OsSignal();
+    // Ids start somewhere new each boot, so a browser reconnecting with a
+    // Last-Event-ID from before a reboot is resynced, not replayed.
+#if defined(FACEGUARD_HOST)
+    _newest = (uint32_t)time(nullptr) << 8;
+#else
+    _newest = esp_random() & 0x3fffffff;
+#endif
+    if (!osTaskStart(_senderTask, "evt_send", 3072, nullptr, 1, core)) {
+        Serial.println("[EVT] Sender task failed to start");
+        return false;
+    }
+    Serial.printf("[EVT] Event hub started (%d clients)\n", EVENTS_MAX_CLIENTS);
+    return true;
+}
+
+void setStallHandler(void (*fn)(int fd))               { _onStall = fn; }
+void setStatusSource(void (*fn)(char *out, size_t len)) { _status = fn; }
+
+uint32_t publish(const char *type, const char *fmt, ...) {
+    if (!_mtx) return 0;
+    uint32_t id;
+    {
+        OsLock l(*_mtx);
+        id = ++_newest;
+        Event &e = _ring[id & (EVENTS_RING_LEN - 1)];
+        e.id = id;
+        snprintf(e.type, sizeof(e.type), "%s", type);
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(e.data, sizeof(e.data), fmt, ap);
+        va_end(ap);
+        if (n < 0 || (size_t)n >= sizeof(e.data)) {
+            // Cut JSON is worse than none.
+            snprintf(e.data, sizeof(e.data), "{\"truncated\":true}");
+            _truncated++;
+        }
+        if (_count < EVENTS_RING_LEN) _count++;
+    }
+    _published++;
+    _wake->give();
+    return id;
+}
+
+int addClient(int fd, const char *prologue, uint32_t lastId) {
+    if (!_mtx || fd < 0) return -1;
+    int id = -1;
+    {
+        OsLock   l(*_mtx);
+        uint32_t now = millis();
+        for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+            Client &c = _clients[i];
+            if (c.used) continue;
+            c.used = true;
+            c.gen++;
+            c.fd   = fd;
+            c.len  = c.off = 0;
+            c.sent = c.resyncs = c.bytes = 0;
+            c.activeMs = now;
+            _append(c, "%s", prologue ? prologue : "");
+            // Replay from Last-Event-ID if it is one of ours; _fill() resyncs
+            // the client if the ring no longer reaches back that far.
+            bool ours = lastId && _diff(lastId, _newest) <= 0 &&
+                        _diff(_newest, lastId) < (int32_t)0x10000;
+            c.next = ours ? lastId + 1 : _newest + 1;
+            if (lastId && !ours) {
+                _append(c, "id: %u\nevent: resync\ndata: {}\n\n", (unsigned)_newest);
+                c.resyncs++;
+            }
+            _clientCount++;
+            id = i | (c.gen << 8);
+            break;
+        }
+    }
+    if (id >= 0) _wake->give();
+    return id;
+}
+
+void removeClient(int id) {
+    if (!_mtx || id < 0) return;
+    int slot = id & 0xff;
+    if (slot >= EVENTS_MAX_CLIENTS) return;
+    OsLock l(*_mtx);
+    Client &c = _clients[slot];
+    if (c.used && c.gen == (uint8_t)(id >> 8)) _drop(c);
+}
+
+Stats stats() {
+    Stats st = {};
+    st.published = _published;
+    st.truncated = _truncated;
+    st.stalled   = _stalled;
+    if (!_mtx) return st;
+    OsLock l(*_mtx);
+    st.clients = (uint32_t)_clientCount;
+    for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+        const Client &c = _clients[i];
+        st.client[i].used    = c.used;
+        st.client[i].sent    = c.sent;
+        st.client[i].resyncs = c.resyncs;
+        st.client[i].kbytes  = c.bytes / 1024;
+    }
+    return st;
+}
+
+String toJSON() {
+    Stats st = stats();
+    String out;
+    out.reserve(96 + EVENTS_MAX_CLIENTS * 64);
+    char buf[128];
+    snprintf(buf, sizeof(buf),
+        "{\"clients\":%u,\"published\":%u,\"truncated\":%u,\"stalled\":%u,\"streams\":[",
+        (unsigned)st.clients, (unsigned)st.published, (unsigned)st.truncated,
+        (unsigned)st.stalled);
+    out = buf;
+    bool first = true;
+    for (const auto &c : st.client) {
+        if (!c.used) continue;
+        snprintf(buf, sizeof(buf), "%s{\"sent\":%u,\"resyncs\":%u,\"kbytes\":%u}",
+                 first ? "" : ",", (unsigned)c.sent, (unsigned)c.resyncs, (unsigned)c.kbytes);
+        out += buf;
+        first = false;
+    }
+    out += "]}";
+    return out;
+}
+
+} // namespace Events
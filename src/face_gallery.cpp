@@ -0,0 +1,378 @@
+// face_gallery.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Contiguous embedding gallery + dot-product scan kernels (see face_gallery.h).
+
+#include "face_gallery.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static_assert(FACE_ID_SIZE % 8 == 0, "faceDot() processes 8 floats per step");
+
+#define FACE_GALLERY_TOPK_MAX 16
+
+float faceDot(const float *__restrict a, const float *__restrict b, int n) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+    for (int i = 0; i < n; i += 8) {
+        s0 += a[i]     * b[i];
+        s1 += a[i + 1] * b[i + 1];
+        s2 += a[i + 2] * b[i + 2];
+        s3 += a[i + 3] * b[i + 3];
+        s4 += a[i + 4] * b[i + 4];
+        s5 += a[i + 5] * b[i + 5];
+        s6 += a[i + 6] * b[i + 6];
+        s7 += a[i + 7] * b[i + 7];
+    }
+    return ((s0 + s1) + (s2 + s3)) + ((s4 + s5) + (s6 + s7));
+}
+
+// Integer adds have no FP-style latency chain to hide, and a single
+// accumulator is the shape GCC turns into pmaddwd on the host.
+int32_t faceDotQ8(const int8_t *__restrict a, const int8_t *__restrict b, int n) {
+    int32_t s = 0;
+    for (int i = 0; i < n; i++) s += (int16_t)a[i] * (int16_t)b[i];
+    return s;
+}
+
+static float _norm(const float *v) {
+    return sqrtf(faceDot(v, v, FACE_ID_SIZE));
+}
+
+// Symmetric per-vector quantisation of v·inv (the unit vector) into q.
+// Returns the scale: unit[k] ≈ scale · q[k].
+static float _quantize(const float *v, float inv, int8_t *q) {
+    float m = 0;
+    for (int k = 0; k < FACE_ID_SIZE; k++) m = fmaxf(m, fabsf(v[k]));
+    m *= inv;
+    if (m <= 0) { memset(q, 0, FACE_ID_SIZE); return 0; }
+    float scale = m / 127.0f;
+    float k2q   = inv / scale;
+    for (int k = 0; k < FACE_ID_SIZE; k++) {
+        long r = lrintf(v[k] * k2q);
+        q[k] = (int8_t)(r > 127 ? 127 : (r < -127 ? -127 : r));
+    }
+    return scale;
+}
+
+FaceGallery::~FaceGallery() {
+    osFreeLarge(_rows);
+    osFreeLarge(_qrows);
+    free(_qscale);
+    free(_norms);
+    free(_names);
+}
+
+// ─── Storage ─────────────────────────────────────────────────────────────────
+// The row block is the big one (2 KB per face, 512 B as int8) and goes through
+// osAllocLarge (PSRAM on the device); scales, norms and names stay in DRAM.
+bool FaceGallery::grow(uint32_t cap) {
+    if (cap <= _cap) return true;
+    bool    q8     = (_mode == INT8);
+    size_t  rowB   = q8 ? FACE_ID_SIZE : FACE_ID_SIZE * sizeof(float);
+    void   *rows   = osAllocLarge((size_t)cap * rowB, FACE_GALLERY_ALIGN);
+    float  *qscale = q8 ? (float*)malloc((size_t)cap * sizeof(float)) : nullptr;
+    float  *norms  = (float*)malloc((size_t)cap * sizeof(float));
+    char  (*names)[ENROLL_NAME_LEN] = (char(*)[ENROLL_NAME_LEN])malloc((size_t)cap * ENROLL_NAME_LEN);
+    if (!rows || (q8 && !qscale) || !norms || !names) {
+        osFreeLarge(rows); free(qscale); free(norms); free(names);
+        return false;
+    }
+    void *old = q8 ? (void*)_qrows : (void*)_rows;
+    if (_count) {
+        memcpy(rows,  old,    (size_t)_count * rowB);
+        memcpy(norms, _norms, (size_t)_count * sizeof(float));
+        memcpy(names, _names, (size_t)_count * ENROLL_NAME_LEN);
+        if (q8) memcpy(qscale, _qscale, (size_t)_count * sizeof(float));
+    }
+    osFreeLarge(old); free(_qscale); free(_norms); free(_names);
+    if (q8) _qrows = (int8_t*)rows; else _rows = (float*)rows;
+    _qscale = qscale;
+    _norms  = norms;
+    _names  = names;
+    _cap    = cap;
+    return true;
+}
+
+bool FaceGallery::setMode(Mode m, RowFetch fetch, int topK) {
+    OsLock g(_mtx);
+    if (_count) return false;
+    if (m != _mode) {
+        osFreeLarge(_rows);  _rows  = nullptr;
+        osFreeLarge(_qrows); _qrows = nullptr;
+        free(_qscale); _qscale = nullptr;
+        free(_norms);  _norms  = nullptr;
+        free(_names);  _names  = nullptr;
+        _cap  = 0;
+        _mode = m;
+    }
+    _fetch = fetch;
+    _topK  = topK < 1 ? 1 : (topK > FACE_GALLERY_TOPK_MAX ? FACE_GALLERY_TOPK_MAX : topK);
+    return true;
+}
+
+bool FaceGallery::reserve(uint32_t rows) {
+    OsLock g(_mtx);
+    return grow(rows);
+}
+
+void FaceGallery::clear() {
+    OsLock g(_mtx);
+    _count = 0;
+    _gen++;
+}
+
+uint32_t FaceGallery::count() const {
+    return _count;
+}
+
+size_t FaceGallery::bytesPerRow() const {
+    size_t meta = ENROLL_NAME_LEN + sizeof(float);
+    return (_mode == INT8) ? FACE_ID_SIZE + sizeof(float) + meta
+                           : FACE_ID_SIZE * sizeof(float) + meta;
+}
+
+// Claims the next row (mutex held) and fills its name and norm; the caller
+// writes the row data.
+int FaceGallery::appendRow(const char *name, float norm) {
+    if (_count == _cap && !grow(_cap ? _cap * 2 : FACE_GALLERY_INITIAL_CAP)) return -1;
+    _norms[_count] = norm;
+    strncpy(_names[_count], name, ENROLL_NAME_LEN - 1);
+    _names[_count][ENROLL_NAME_LEN - 1] = '\0';
+    return (int)_count++;
+}
+
+int FaceGallery::add(const char *name, const float *vec) {
+    float n   = _norm(vec);
+    float inv = (n > 0) ? 1.0f / n : 0.0f;
+
+    OsLock g(_mtx);
+    int i = appendRow(name, n);
+    if (i < 0) return -1;
+    if (_mode == INT8) {
+        _qscale[i] = _quantize(vec, inv, _qrows + (size_t)i * FACE_ID_SIZE);
+    } else {
+        float *row = _rows + (size_t)i * FACE_ID_SIZE;
+        for (int k = 0; k < FACE_ID_SIZE; k++) row[k] = vec[k] * inv;
+    }
+    return i;
+}
+
+int FaceGallery::addQuantized(const char *name, float scale, float norm, const int8_t *q) {
+    OsLock g(_mtx);
+    if (_mode != INT8) return -1;
+    int i = appendRow(name, norm);
+    if (i < 0) return -1;
+    _qscale[i] = scale;
+    memcpy(_qrows + (size_t)i * FACE_ID_SIZE, q, FACE_ID_SIZE);
+    return i;
+}
+
+int FaceGallery::remove(const char *name) {
+    OsLock g(_mtx);
+    for (uint32_t i = 0; i < _count; i++) {
+        if (strncmp(_names[i], name, ENROLL_NAME_LEN) != 0) continue;
+        uint32_t last = --_count;
+        if (i != last) {
+            if (_mode == INT8) {
+                memcpy(_qrows + (size_t)i * FACE_ID_SIZE, _qrows + (size_t)last * FACE_ID_SIZE,
+                       FACE_ID_SIZE);
+                _qscale[i] = _qscale[last];
+            } else {
+                memcpy(_rows + (size_t)i * FACE_ID_SIZE, _rows + (size_t)last * FACE_ID_SIZE,
+                       FACE_ID_SIZE * sizeof(float));
+            }
+            _norms[i] = _norms[last];
+            memcpy(_names[i], _names[last], ENROLL_NAME_LEN);
+        }
+        _gen++;
+        return (int)i;
+    }
+    return -1;
+}
+
+// ─── Matching ────────────────────────────────────────────────────────────────
+// Keeps the two highest scores seen.
+static inline void _top2(float sim, float &best, float &second) {
+    if (sim > best)        { second = best; best = sim; }
+    else if (sim > second) { second = sim; }
+}
+
+// Rows are unit vectors, so cos(q, row) = (q·row) / |q|: one dot product per
+// row, a straight walk through the block, no per-row norm or division.
+int FaceGallery::match(const float *query, float threshold, Match *out) {
+    Match m;
+    m.row = -1; m.best = -1.0f; m.second = -1.0f; m.name[0] = '\0';
+    float qn = _norm(query);
+    if (qn > 0 && _mode == INT8) {
+        matchQ8(query, threshold, m);
+    } else if (qn > 0) {
+        float inv = 1.0f / qn;
+        OsLock g(_mtx);
+        int   bestRow = -1;
+        const float *row = _rows;
+        for (uint32_t i = 0; i < _count; i++, row += FACE_ID_SIZE) {
+            float sim = faceDot(row, query, FACE_ID_SIZE) * inv;
+            if (sim > m.best) bestRow = (int)i;
+            _top2(sim, m.best, m.second);
+        }
+        if (bestRow >= 0 && m.best > threshold) {
+            m.row = bestRow;
+            memcpy(m.name, _names[bestRow], ENROLL_NAME_LEN);
+        }
+    }
+    if (out) *out = m;
+    return m.row;
+}
+
+int FaceGallery::matchBatch(const float *const *queries, int n, float threshold, Match *out) {
+    if (n > FACE_GALLERY_BATCH_MAX) n = FACE_GALLERY_BATCH_MAX;
+    int accepted = 0;
+    if (_mode == INT8) {
+        for (int j = 0; j < n; j++) accepted += (match(queries[j], threshold, &out[j]) >= 0);
+        return accepted;
+    }
+
+    float inv[FACE_GALLERY_BATCH_MAX];
+    int   bestRow[FACE_GALLERY_BATCH_MAX];
+    for (int j = 0; j < n; j++) {
+        float qn = _norm(queries[j]);
+        inv[j]     = (qn > 0) ? 1.0f / qn : 0.0f;
+        bestRow[j] = -1;
+        out[j].row = -1; out[j].best = -1.0f; out[j].second = -1.0f; out[j].name[0] = '\0';
+    }
+
+    OsLock g(_mtx);
+    const float *row = _rows;
+    for (uint32_t i = 0; i < _count; i++, row += FACE_ID_SIZE) {
+        for (int j = 0; j < n; j++) {
+            if (inv[j] == 0) continue;
+            float sim = faceDot(row, queries[j], FACE_ID_SIZE) * inv[j];
+            if (sim > out[j].best) bestRow[j] = (int)i;
+            _top2(sim, out[j].best, out[j].second);
+        }
+    }
+    for (int j = 0; j < n; j++) {
+        if (bestRow[j] < 0 || out[j].best <= threshold) continue;
+        out[j].row = bestRow[j];
+        memcpy(out[j].name, _names[bestRow[j]], ENROLL_NAME_LEN);
+        accepted++;
+    }
+    return accepted;
+}
+
+// INT8: integer scan keeps the _topK best rows scoring at least
+// threshold − FACE_GALLERY_Q8_MARGIN (quantisation error is well inside the
+// margin), then each candidate is re-scored from its exact float vector.
+// Strangers rarely reach the shortlist, so they cost no fetch at all.
+// Scores outside the shortlist are only tracked (top two) for best/second.
+void FaceGallery::matchQ8(const float *query, float threshold, Match &m) {
+    struct Cand { float sim; uint32_t row; };
+    Cand     top[FACE_GALLERY_TOPK_MAX];
+    int      nTop = 0;
+    float    rest1 = -1.0f, rest2 = -1.0f;
+    int8_t   q[FACE_ID_SIZE];
+    float    inv  = 1.0f / _norm(query);
+    float    qs   = _quantize(query, inv, q);
+    float    floorSim = threshold - FACE_GALLERY_Q8_MARGIN;
+    uint32_t gen;
+    RowFetch fetch = _fetch;            // fixed while rows exist (setMode)
+    // Shortlisted int8 rows, copied under the lock, then the fetched vector.
+    int8_t  *held  = fetch ? (int8_t*)malloc((size_t)_topK * FACE_ID_SIZE +
+                                             FACE_ID_SIZE * sizeof(float)) : nullptr;
+    {
+        OsLock g(_mtx);
+        gen   = _gen;
+        const int8_t *row = _qrows;
+        for (uint32_t i = 0; i < _count; i++, row += FACE_ID_SIZE) {
+            float sim = (float)faceDotQ8(row, q, FACE_ID_SIZE) * _qscale[i] * qs;
+            if (sim < floorSim || (nTop == _topK && sim <= top[nTop - 1].sim)) {
+                _top2(sim, rest1, rest2);
+                continue;
+            }
+            if (nTop == _topK) _top2(top[nTop - 1].sim, rest1, rest2);   // evicted
+            int j = (nTop < _topK) ? nTop++ : nTop - 1;
+            while (j > 0 && top[j - 1].sim < sim) { top[j] = top[j - 1]; j--; }
+            top[j] = {sim, i};
+        }
+        for (int c = 0; held && c < nTop; c++)
+            memcpy(held + (size_t)c * FACE_ID_SIZE, _qrows + (size_t)top[c].row * FACE_ID_SIZE,
+                   FACE_ID_SIZE);
+    }
+
+    // Re-score outside the lock: the fetch reads the card.  A fetched vector
+    // must be the one this int8 row was quantised from – a delete can move
+    // another face into the row before FACE.BIN and the row cache follow,
+    // and re-scoring from that face would match the wrong name.
+    if (held && nTop) {
+        float *vec = (float*)(held + (size_t)_topK * FACE_ID_SIZE);
+        for (int c = 0; c < nTop; c++) {
+            const int8_t *qr = held + (size_t)c * FACE_ID_SIZE;
+            if (!fetch(top[c].row, vec)) continue;   // keep the int8 score
+            float n = _norm(vec), vq = 0.0f;
+            for (int k = 0; k < FACE_ID_SIZE; k++) vq += vec[k] * (float)qr[k];
+            float qn = sqrtf((float)faceDotQ8(qr, qr, FACE_ID_SIZE));
+            if (n <= 0 || qn <= 0 || vq / (n * qn) < FACE_GALLERY_Q8_AGREE) continue;
+            top[c].sim = faceDot(vec, query, FACE_ID_SIZE) * inv / n;
+        }
+    }
+    free(held);
+    int best = -1;
+    for (int c = 0; c < nTop; c++) {
+        if (best < 0 || top[c].sim > top[best].sim) best = c;
+    }
+    m.best   = rest1;
+    m.second = rest2;
+    for (int c = 0; c < nTop; c++) _top2(top[c].sim, m.best, m.second);
+    if (best < 0 || top[best].sim <= threshold) return;
+
+    OsLock g(_mtx);
+    // A delete moved rows while we were fetching; the next frame will match.
+    if (_gen != gen) return;
+    m.row = (int)top[best].row;
+    memcpy(m.name, _names[top[best].row], ENROLL_NAME_LEN);
+}
+
+uint32_t FaceGallery::scoreAll(const float *query, float *sims) {
+    float qn  = _norm(query);
+    float inv = (qn > 0) ? 1.0f / qn : 0.0f;
+    if (_mode == INT8) {
+        int8_t q[FACE_ID_SIZE];
+        float  qs = _quantize(query, inv, q);
+        OsLock g(_mtx);
+        const int8_t *row = _qrows;
+        for (uint32_t i = 0; i < _count; i++, row += FACE_ID_SIZE)
+            sims[i] = (float)faceDotQ8(row, q, FACE_ID_SIZE) * _qscale[i] * qs;
+        return _count;
+    }
+    OsLock g(_mtx);
+    const float *row = _rows;
+    for (uint32_t i = 0; i < _count; i++, row += FACE_ID_SIZE)
+        sims[i] = faceDot(row, query, FACE_ID_SIZE) * inv;
+    return _count;
+}
+
+bool FaceGallery::exportRow(uint32_t i, char name[ENROLL_NAME_LEN], float *vec) {
+    OsLock g(_mtx);
+    if (i >= _count) return false;
+    memcpy(name, _names[i], ENROLL_NAME_LEN);
+    if (_mode == INT8) {
+        const int8_t *q = _qrows + (size_t)i * FACE_ID_SIZE;
+        float         s = _qscale[i] * _norms[i];
+        for (int k = 0; k < FACE_ID_SIZE; k++) vec[k] = q[k] * s;
+    } else {
+        const float *row = _rows + (size_t)i * FACE_ID_SIZE;
+        for (int k = 0; k < FACE_ID_SIZE; k++) vec[k] = row[k] * _norms[i];
+    }
+    return true;
+}
+
+bool FaceGallery::exportQuantized(uint32_t i, char name[ENROLL_NAME_LEN], float *scale,
+                                  float *norm, int8_t *q) {
+    OsLock g(_mtx);
+    if (_mode != INT8 || i >= _count) return false;
+    memcpy(name, _names[i], ENROLL_NAME_LEN);
+    *scale = _qscale[i];
+    *norm  = _norms[i];
+    memcpy(q, _qrows + (size_t)i * FACE_ID_SIZE, FACE_ID_SIZE);
+    return true;
+}
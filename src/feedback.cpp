@@ -0,0 +1,152 @@
+// feedback.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Non-blocking LED / buzzer patterns: pattern player, latest-wins sequencer
+// and the player task.
+
+#include "feedback.h"
+
+#include <Arduino.h>
+#include "os_port.h"
+
+namespace Feedback {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Patterns
+// ═══════════════════════════════════════════════════════════════════════════════
+// Each step sets every output at once and holds for holdMs; a pattern ends
+// with an all-off step whose hold is 0.
+enum : uint8_t { OUT_GREEN = 1, OUT_RED = 2, OUT_BUZZER = 4 };
+
+struct PatternPlayer::Step {
+    uint8_t  outputs;
+    uint16_t holdMs;
+};
+
+// Recognised: green LED solid for the whole pattern so it dominates
+// visually, two 120 ms beeps 120 ms apart, green held 200 ms after.
+static const PatternPlayer::Step kRecognised[] = {
+    { OUT_GREEN | OUT_BUZZER, 120 },
+    { OUT_GREEN,              120 },
+    { OUT_GREEN | OUT_BUZZER, 120 },
+    { OUT_GREEN,              200 },
+    { 0,                        0 },
+};
+
+// Not recognised: red LED + continuous buzz for 600 ms.
+static const PatternPlayer::Step kNotRecognised[] = {
+    { OUT_RED | OUT_BUZZER,   600 },
+    { 0,                        0 },
+};
+
+static const PatternPlayer::Step *const kPatterns[PATTERN_COUNT] = {
+    kRecognised,
+    kNotRecognised,
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  PatternPlayer
+// ═══════════════════════════════════════════════════════════════════════════════
+void PatternPlayer::apply(uint8_t outputs) {
+    uint8_t changed = outputs ^ _outputs;
+    if (changed & OUT_GREEN)  _write(_pins.green,  outputs & OUT_GREEN);
+    if (changed & OUT_RED)    _write(_pins.red,    outputs & OUT_RED);
+    if (changed & OUT_BUZZER) _write(_pins.buzzer, outputs & OUT_BUZZER);
+    _outputs = outputs;
+}
+
+void PatternPlayer::start(Pattern p, uint32_t now) {
+    if (p >= PATTERN_COUNT) return;
+    _step = kPatterns[p];
+    _due  = now;
+    tick(now);
+}
+
+uint32_t PatternPlayer::tick(uint32_t now) {
+    // Signed difference so the schedule survives millis() wrap-around.
+    while (_step && (int32_t)(now - _due) >= 0) {
+        apply(_step->outputs);
+        if (_step->holdMs == 0) { _step = nullptr; break; }
+        _due += _step->holdMs;   // from the schedule, not `now`: no drift
+        _step++;
+    }
+    return _step ? _due - now : FEEDBACK_IDLE;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Sequencer
+// ═══════════════════════════════════════════════════════════════════════════════
+bool Sequencer::post(Pattern p) {
+    if (p >= PATTERN_COUNT || _playing == p) return false;
+    _pending = p;
+    return true;
+}
+
+uint32_t Sequencer::tick(uint32_t now) {
+    for (;;) {
+        bool     was  = _player.busy();
+        uint32_t wait = _player.tick(now);
+        if (was && !_player.busy()) {
+            _last    = _playing;
+            _lastEnd = now;
+            _playing = PATTERN_COUNT;
+        }
+        if (_player.busy()) return wait;
+
+        uint8_t p = _pending;
+        if (p == PATTERN_COUNT) return FEEDBACK_IDLE;
+        if (p == _last) {
+            int32_t gap = (int32_t)(_lastEnd + FEEDBACK_REPEAT_GAP_MS - now);
+            if (gap > 0) return (uint32_t)gap;
+        }
+        if (!_pending.compare_exchange_strong(p, PATTERN_COUNT)) continue;  // replaced
+        _playing = p;
+        _player.start((Pattern)p, now);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Player task
+// ═══════════════════════════════════════════════════════════════════════════════
+static OsSignal  *_wake  = nullptr;
+static Sequencer *_seq   = nullptr;
+static Clock      _clock = nullptr;
+
+static uint32_t _millis() { return (uint32_t)millis(); }
+
+#if !defined(FACEGUARD_HOST)
+static void _digitalWrite(uint8_t pin, bool level) { digitalWrite(pin, level ? HIGH : LOW); }
+#endif
+
+static void _playerTask(void *) {
+    for (;;) {
+        uint32_t wait = _seq->tick(_clock());
+        // Sleeps until the next step or repeat gap is due, or until post()
+        // wakes an idle player.  A wake-up during a pattern just re-ticks
+        // early.
+        _wake->take(wait == FEEDBACK_IDLE ? 1000 : wait);
+    }
+}
+
+bool begin(const Pins &pins, PinWrite write, Clock clock) {
+    if (_seq) return true;
+#if !defined(FACEGUARD_HOST)
+    if (!write) write = _digitalWrite;
+#endif
+    if (!write) return false;
+    _clock = clock ? clock : _millis;
+    _wake  = new OsSignal();
+    _seq   = new Sequencer(write, pins);
+    if (!osTaskStart(_playerTask, "feedback", 2048, nullptr, 2, -1)) {
+        Serial.println("[FBK] Player task failed to start");
+        return false;
+    }
+    Serial.println("[FBK] Feedback player started");
+    return true;
+}
+
+bool post(Pattern p) {
+    if (!_seq || !_seq->post(p)) return false;
+    _wake->give();
+    return true;
+}
+
+} // namespace Feedback
@@ -0,0 +1,195 @@
+// frame_decode.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Scaled and region-only JPEG decoding for detection and alignment.
+
+#include "frame_decode.h"
+
+#include <string.h>
+#include "esp_jpg_decode.h"
+#include "os_port.h"
+
+namespace FrameDecode {
+
+// esp32-camera's esp_jpg_decode() keeps its work area in a static buffer,
+// so decodes from different tasks (pipeline stages) must not overlap.
+static OsMutex &_decoder() {
+    static OsMutex m;
+    return m;
+}
+
+// esp_jpg_decode() calls the writer once with data == NULL and x == y == 0
+// (output size in w × h), then once per decoded block of RGB pixels, then
+// once more with data == NULL to finish.  Returning false aborts decoding.
+struct Sink {
+    const uint8_t  *jpg;
+    FrameArena     *arena;    // null → heap
+    dl_matrix3du_t *out;
+    int             x0, y0;   // region origin in output coordinates
+    int             w, h;     // region size; 0 → whole image
+    int             outW;     // decoded (scaled) frame width
+    bool            done;     // region's last row written
+};
+
+static size_t _read(void *arg, size_t index, uint8_t *buf, size_t len) {
+    Sink *s = (Sink *)arg;
+    if (buf) memcpy(buf, s->jpg + index, len);
+    return len;
+}
+
+static bool _write(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data) {
+    Sink *s = (Sink *)arg;
+    if (!data) {
+        if (x == 0 && y == 0 && !s->out) {
+            // Start: w × h is the (scaled) output size.
+            s->outW = w;
+            if (s->w == 0) { s->w = w; s->h = h; }
+            if (s->x0 + s->w > w || s->y0 + s->h > h) return false;
+            s->out = s->arena ? s->arena->matrix(s->w, s->h, 3)
+                              : dl_matrix3du_alloc(1, s->w, s->h, 3);
+            return s->out != nullptr;
+        }
+        return true;
+    }
+
+    // Intersect the block with the region.
+    int bx0 = x > s->x0 ? x : s->x0;
+    int by0 = y > s->y0 ? y : s->y0;
+    int bx1 = (x + w < s->x0 + s->w) ? x + w : s->x0 + s->w;
+    int by1 = (y + h < s->y0 + s->h) ? y + h : s->y0 + s->h;
+    for (int row = by0; row < by1; row++) {
+        const uint8_t *src = data + ((size_t)(row - y) * w + (bx0 - x)) * 3;
+        uint8_t       *dst = s->out->item + ((size_t)(row - s->y0) * s->w + (bx0 - s->x0)) * 3;
+        for (int col = bx0; col < bx1; col++, src += 3, dst += 3) {
+            dst[0] = src[2];   // RGB → BGR, as fmt2rgb888()
+            dst[1] = src[1];
+            dst[2] = src[0];
+        }
+    }
+    // Blocks arrive left to right, top to bottom: after the last block of
+    // the row band that holds the region's bottom edge the region is
+    // complete and the rest of the frame need not be decoded.
+    if (y + h >= s->y0 + s->h && x + w >= s->outW) { s->done = true; return false; }
+    return true;
+}
+
+static dl_matrix3du_t *_decode(const uint8_t *jpg, size_t len, int shift, Sink &s) {
+    s.jpg  = jpg;
+    s.out  = nullptr;
+    s.done = false;
+    esp_err_t err;
+    {
+        OsLock l(_decoder());
+        err = esp_jpg_decode(len, (jpg_scale_t)shift, _read, _write, &s);
+    }
+    if (err != ESP_OK && !s.done) {
+        if (s.out && !s.arena) dl_matrix3du_free(s.out);   // arena memory goes on reset
+        return nullptr;
+    }
+    return s.out;
+}
+
+dl_matrix3du_t *decodeScaled(const uint8_t *jpg, size_t len, int shift, FrameArena *arena) {
+    if (!jpg || shift < 0 || shift > 3) return nullptr;
+    Sink s = {};
+    s.arena = arena;
+    return _decode(jpg, len, shift, s);
+}
+
+dl_matrix3du_t *decodeRegion(const uint8_t *jpg, size_t len, int x, int y, int w, int h,
+                             FrameArena *arena) {
+    if (!jpg || x < 0 || y < 0 || w <= 0 || h <= 0) return nullptr;
+    Sink s = {};
+    s.arena = arena;
+    s.x0 = x; s.y0 = y; s.w = w; s.h = h;
+    return _decode(jpg, len, 0, s);
+}
+
+// ─── Luma thumbnail ──────────────────────────────────────────────────────────
+struct LumaSink {
+    const uint8_t *jpg;
+    uint8_t       *out;
+    int            maxW, maxH;
+    int            step;       // keep every step-th pixel / row
+    int            w, h;       // thumbnail size
+};
+
+static size_t _lumaRead(void *arg, size_t index, uint8_t *buf, size_t len) {
+    LumaSink *s = (LumaSink *)arg;
+    if (buf) memcpy(buf, s->jpg + index, len);
+    return len;
+}
+
+static bool _lumaWrite(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data) {
+    LumaSink *s = (LumaSink *)arg;
+    if (!data) {
+        if (x == 0 && y == 0 && s->w == 0) {
+            s->step = 1;
+            while ((w + s->step - 1) / s->step > s->maxW || (h + s->step - 1) / s->step > s->maxH)
+                s->step++;
+            s->w = (w + s->step - 1) / s->step;
+            s->h = (h + s->step - 1) / s->step;
+        }
+        return true;
+    }
+    for (int row = y; row < y + h; row++) {
+        if (row % s->step) continue;
+        const uint8_t *src = data + (size_t)(row - y) * w * 3;
+        uint8_t       *dst = s->out + (size_t)(row / s->step) * s->w;
+        for (int col = x; col < x + w; col++) {
+            if (col % s->step) continue;
+            const uint8_t *p = src + (col - x) * 3;
+            // BT.601 luma, integer weights summing to 256
+            dst[col / s->step] = (uint8_t)((77 * p[0] + 150 * p[1] + 29 * p[2]) >> 8);
+        }
+    }
+    return true;
+}
+
+bool decodeLuma(const uint8_t *jpg, size_t len, int shift, uint8_t *out,
+                int maxW, int maxH, int *w, int *h) {
+    if (!jpg || !out || shift < 0 || shift > 3 || maxW <= 0 || maxH <= 0) return false;
+    LumaSink s = { jpg, out, maxW, maxH, 1, 0, 0 };
+    OsLock l(_decoder());
+    if (esp_jpg_decode(len, (jpg_scale_t)shift, _lumaRead, _lumaWrite, &s) != ESP_OK) return false;
+    *w = s.w;
+    *h = s.h;
+    return s.w > 0;
+}
+
+// ─── Box mapping ─────────────────────────────────────────────────────────────
+void mapBoxes(box_array_t *b, int n, float scale, float dx, float dy) {
+    for (int i = 0; i < n; i++) {
+        fptp_t *p = b->box[i].box_p;                    // x1, y1, x2, y2
+        p[0] = p[0] * scale + dx;  p[1] = p[1] * scale + dy;
+        p[2] = p[2] * scale + dx;  p[3] = p[3] * scale + dy;
+        fptp_t *l = b->landmark[i].landmark_p;          // x, y pairs
+        for (int k = 0; k < 10; k += 2) {
+            l[k]     = l[k]     * scale + dx;
+            l[k + 1] = l[k + 1] * scale + dy;
+        }
+    }
+}
+
+bool faceRegion(const box_array_t *b, int n, int imgW, int imgH,
+                int *x, int *y, int *w, int *h) {
+    if (n <= 0) return false;
+    float x0 = b->box[0].box_p[0], y0 = b->box[0].box_p[1];
+    float x1 = b->box[0].box_p[2], y1 = b->box[0].box_p[3];
+    for (int i = 0; i < n; i++) {
+        const fptp_t *p = b->box[i].box_p;
+        float mx = (p[2] - p[0]) * FRAME_REGION_MARGIN;
+        float my = (p[3] - p[1]) * FRAME_REGION_MARGIN;
+        if (p[0] - mx < x0) x0 = p[0] - mx;
+        if (p[1] - my < y0) y0 = p[1] - my;
+        if (p[2] + mx > x1) x1 = p[2] + mx;
+        if (p[3] + my > y1) y1 = p[3] + my;
+    }
+    int ix0 = x0 < 0 ? 0 : (int)x0;
+    int iy0 = y0 < 0 ? 0 : (int)y0;
+    int ix1 = x1 > imgW ? imgW : (int)(x1 + 0.999f);
+    int iy1 = y1 > imgH ? imgH : (int)(y1 + 0.999f);
+    if (ix1 <= ix0 || iy1 <= iy0) return false;
+    *x = ix0; *y = iy0; *w = ix1 - ix0; *h = iy1 - iy0;
+    return true;
+}
+
+} // namespace FrameDecode
@@ -0,0 +1,141 @@
+// frame_pool.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// PSRAM slot pool and per-frame bump arenas (see frame_pool.h).
+
+#include "frame_pool.h"
+
+#include <atomic>
+#include "bounded_queue.h"
+#include "os_port.h"
+
+#define FRAME_POOL_MAX_SLOTS  8      // free-list capacity (power of two)
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Module-level state
+// ═══════════════════════════════════════════════════════════════════════════════
+static uint8_t *_slotMem[FRAME_POOL_MAX_SLOTS];
+static size_t   _slotBytes = 0;
+static int      _slots     = 0;
+static BoundedQueue<int8_t, FRAME_POOL_MAX_SLOTS> _freeSlots;
+
+static std::atomic<uint32_t> _inUse{0}, _peakInUse{0}, _peakBytes{0};
+static std::atomic<uint32_t> _acquired{0}, _exhausted{0};
+static std::atomic<uint32_t> _fallbacks{0}, _fallbackBytes{0};
+
+static void _max(std::atomic<uint32_t> &m, uint32_t v) {
+    uint32_t cur = m.load();
+    while (v > cur && !m.compare_exchange_weak(cur, v)) {}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  FrameArena
+// ═══════════════════════════════════════════════════════════════════════════════
+static size_t _align16(size_t n) { return (n + 15) & ~(size_t)15; }
+
+dl_matrix3du_t *FrameArena::matrix(int w, int h, int c) {
+    if (w <= 0 || h <= 0 || c <= 0) return nullptr;
+    if (!_base && !_bound) FramePool::acquire(*this);   // first matrix of the frame
+    size_t bytes = (size_t)w * h * c;
+    size_t need  = _align16(sizeof(dl_matrix3du_t)) + _align16(bytes);
+
+    if (_base && _used + need <= _cap) {
+        dl_matrix3du_t *m = (dl_matrix3du_t *)(_base + _used);
+        m->w      = w;
+        m->h      = h;
+        m->c      = c;
+        m->n      = 1;
+        m->stride = w * c;
+        m->item   = (uc_t *)(_base + _used + _align16(sizeof(dl_matrix3du_t)));
+        _used += need;
+        return m;
+    }
+
+    // No slot, or this frame outgrew it (larger framesize): heap, as before.
+    if (_heapCount >= FRAME_ARENA_HEAP_MAX) return nullptr;
+    dl_matrix3du_t *m = dl_matrix3du_alloc(1, w, h, c);
+    if (!m) return nullptr;
+    _heap[_heapCount++] = m;
+    _fallbacks++;
+    _max(_fallbackBytes, (uint32_t)bytes);
+    return m;
+}
+
+void FrameArena::reset() {
+    _max(_peakBytes, (uint32_t)_used);
+    _used = 0;
+    for (int i = 0; i < _heapCount; i++) dl_matrix3du_free(_heap[i]);
+    _heapCount = 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Public API
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace FramePool {
+
+int begin(int slots, size_t slotBytes) {
+    if (_slots) return _slots;
+    if (slots > FRAME_POOL_MAX_SLOTS) slots = FRAME_POOL_MAX_SLOTS;
+    _slotBytes = _align16(slotBytes);
+    for (int i = 0; i < slots; i++) {
+        _slotMem[i] = (uint8_t *)osAllocLarge(_slotBytes, 16);
+        if (!_slotMem[i]) break;
+        _freeSlots.push((int8_t)i);
+        _slots++;
+    }
+    Serial.printf("[POOL] %d frame slot(s) of %u KB\n", _slots, (unsigned)(_slotBytes / 1024));
+    return _slots;
+}
+
+void acquire(FrameArena &a) {
+    if (a._bound) return;                // already tried for this frame
+    a._bound = true;
+    _acquired++;
+    int8_t slot;
+    if (!_freeSlots.pop(slot)) {
+        _exhausted++;
+        return;
+    }
+    a._slot = slot;
+    a._base = _slotMem[slot];
+    a._cap  = _slotBytes;
+    a._used = 0;
+    _max(_peakInUse, ++_inUse);
+}
+
+void release(FrameArena &a) {
+    a.reset();
+    a._bound = false;
+    if (!a._base) return;
+    _freeSlots.push((int8_t)a._slot);
+    a._base = nullptr;
+    a._cap  = 0;
+    a._slot = -1;
+    _inUse--;
+}
+
+Stats stats() {
+    Stats s;
+    s.slots         = (uint32_t)_slots;
+    s.slotBytes     = (uint32_t)_slotBytes;
+    s.inUse         = _inUse;
+    s.peakInUse     = _peakInUse;
+    s.peakBytes     = _peakBytes;
+    s.acquired      = _acquired;
+    s.exhausted     = _exhausted;
+    s.fallbacks     = _fallbacks;
+    s.fallbackBytes = _fallbackBytes;
+    return s;
+}
+
+String toJSON() {
+    Stats s = stats();
+    char buf[256];
+    snprintf(buf, sizeof(buf),
+        "{\"slots\":%u,\"slotBytes\":%u,\"inUse\":%u,\"peakInUse\":%u,\"peakBytes\":%u,"
+        "\"acquired\":%u,\"exhausted\":%u,\"fallbacks\":%u,\"fallbackBytes\":%u}",
+        (unsigned)s.slots, (unsigned)s.slotBytes, (unsigned)s.inUse, (unsigned)s.peakInUse,
+        (unsigned)s.peakBytes, (unsigned)s.acquired, (unsigned)s.exhausted,
+        (unsigned)s.fallbacks, (unsigned)s.fallbackBytes);
+    return String(buf);
+}
+
+} // namespace FramePool
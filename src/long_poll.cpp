@@ -0,0 +1,172 @@
+// long_poll.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Parked /api/enroll_status?wait= requests, answered by one task when the
+// watched value changes or their deadline passes (see long_poll.h).
+
+#include "long_poll.h"
+
+#include <errno.h>
+#include <string.h>
+#include <atomic>
+#include <sys/socket.h>
+#include "os_port.h"
+
+#ifndef MSG_NOSIGNAL
+  #define MSG_NOSIGNAL 0        // lwip never raises SIGPIPE
+#endif
+
+namespace LongPoll {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Module-level state
+// ═══════════════════════════════════════════════════════════════════════════════
+struct Waiter {
+    bool     used;
+    uint8_t  gen;               // bumped per park(), part of the id
+    int      fd;
+    uint32_t seen;
+    uint32_t deadline;          // millis()
+};
+
+static OsMutex  *_mtx  = nullptr;
+static OsSignal *_wake = nullptr;
+static Waiter    _waiters[LONGPOLL_MAX_WAITERS];
+static bool    (*_ready)(uint32_t seen)          = nullptr;
+static void    (*_body)(char *out, size_t len)   = nullptr;
+static void    (*_onError)(int fd)               = nullptr;
+
+static std::atomic<uint32_t> _parked{0}, _changed{0}, _timedOut{0}, _full{0}, _failed{0};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Answering task
+// ═══════════════════════════════════════════════════════════════════════════════
+// One short response; the socket buffer is empty (the browser is waiting),
+// so a non-blocking send takes it whole or the connection is broken.
+static void _answer(Waiter &w) {
+    char body[LONGPOLL_BODY_MAX];
+    body[0] = '\0';
+    _body(body, sizeof(body));
+    char   out[LONGPOLL_BODY_MAX + 224];
+    int    n = snprintf(out, sizeof(out),
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: %u\r\n"
+        "Access-Control-Allow-Origin: *\r\n"
+        "Cache-Control: no-store\r\n"
+        "Connection: keep-alive\r\n"
+        "\r\n%s", (unsigned)strlen(body), body);
+    ssize_t r = send(w.fd, out, (size_t)n, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (r != n) {
+        Serial.printf("[POLL] Answer to socket %d failed (errno %d)\n", w.fd, errno);
+        _failed++;
+        if (_onError) _onError(w.fd);
+    }
+    w.used = false;
+}
+
+static void _task(void *) {
+    for (;;) {
+        uint32_t sleepMs = 1000;
+        {
+            OsLock   l(*_mtx);
+            uint32_t now = millis();
+            for (auto &w : _waiters) {
+                if (!w.used) continue;
+                int32_t left = (int32_t)(w.deadline - now);
+                if (_ready(w.seen)) {
+                    _changed++;
+                    _answer(w);
+                } else if (left <= 0) {
+                    _timedOut++;
+                    _answer(w);
+                } else if ((uint32_t)left < sleepMs) {
+                    sleepMs = (uint32_t)left;
+                }
+            }
+        }
+        _wake->take(sleepMs);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Public API
+// ═══════════════════════════════════════════════════════════════════════════════
+bool begin(bool (*ready)(uint32_t seen), void (*body)(char *out, size_t len),
+           void (*onError)(int fd), int core) {
+    if (_mtx) return true;
+    _ready   = ready;
+    _body    = body;
+    _onError = onError;
+    _mtx     = new OsMutex();
+    _wake    = new OsSignal();
+    if (!osTaskStart(_task, "long_poll", 3072, nullptr, 1, core)) {
+        Serial.println("[POLL] Task failed to start");
+        return false;
+    }
+    return true;
+}
+
+int park(int fd, uint32_t seen, uint32_t timeoutMs) {
+    if (!_mtx || fd < 0) return -1;
+    if (timeoutMs > LONGPOLL_MAX_MS) timeoutMs = LONGPOLL_MAX_MS;
+    int id = -1;
+    {
+        OsLock l(*_mtx);
+        for (int i = 0; i < LONGPOLL_MAX_WAITERS; i++) {
+            Waiter &w = _waiters[i];
+            if (w.used) continue;
+            w.used     = true;
+            w.gen++;
+            w.fd       = fd;
+            w.seen     = seen;
+            w.deadline = millis() + timeoutMs;
+            id = i | (w.gen << 8);
+            break;
+        }
+    }
+    if (id < 0) {
+        _full++;
+        return -1;
+    }
+    _parked++;
+    _wake->give();      // the value may have moved before we were parked
+    return id;
+}
+
+void cancel(int id) {
+    if (!_mtx || id < 0) return;
+    int slot = id & 0xff;
+    if (slot >= LONGPOLL_MAX_WAITERS) return;
+    OsLock l(*_mtx);
+    Waiter &w = _waiters[slot];
+    if (w.used && w.gen == (uint8_t)(id >> 8)) w.used = false;
+}
+
+void notify() {
+    if (_wake) _wake->give();
+}
+
+Stats stats() {
+    Stats st = {};
+    st.parked   = _parked;
+    st.changed  = _changed;
+    st.timedOut = _timedOut;
+    st.full     = _full;
+    st.failed   = _failed;
+    if (!_mtx) return st;
+    OsLock l(*_mtx);
+    for (const auto &w : _waiters)
+        if (w.used) st.waiting++;
+    return st;
+}
+
+String toJSON() {
+    Stats st = stats();
+    char buf[128];
+    snprintf(buf, sizeof(buf),
+        "{\"waiting\":%u,\"parked\":%u,\"changed\":%u,\"timedOut\":%u,\"full\":%u,\"failed\":%u}",
+        (unsigned)st.waiting, (unsigned)st.parked, (unsigned)st.changed,
+        (unsigned)st.timedOut, (unsigned)st.full, (unsigned)st.failed);
+    return String(buf);
+}
+
+} // namespace LongPoll
@@ -7,14 +7,26 @@
 //   core as httpd.  face_detect() blocks for 300–800 ms, starving httpd and
 //   the CPU 1 IDLE task past the 5-second WDT window.
 //   Fix: attendanceTask() is now pinned to CPU 0 via xTaskCreatePinnedToCore,
-//   completely off the HTTP core.
+//   completely off the HTTP core.  (It has since become a three-stage
+//   pipeline, recognition_pipeline.h: face_detect() stays alone on CPU 0;
+//   decode and embedding run on CPU 1 below httpd's priority, in bursts of
+//   one frame / one face, blocking between them.)
 //
 // Problem 2 – "Face not recognised" spam / CPU thrash:
-//   lastRecognitionTime was only updated on a successful match.  On a no-match
-//   the loop re-ran immediately (only 100 ms gap), hammering face_detect().
-//   Fix: lastRecognitionTime is stamped at the START of every detection
-//   attempt, enforcing the full RECOGNITION_COOLDOWN between runs regardless
-//   of outcome.
+//   On a no-match the loop re-ran immediately (only 100 ms gap), hammering
+//   face_detect().
+//   Fix: lastAttemptTime is stamped at the START of every detection attempt,
+//   enforcing ATTEMPT_COOLDOWN between runs regardless of outcome.  The 5 s
+//   RECOGNITION_COOLDOWN applies per person (CooldownTable), so the next
+//   person in line is not held back by the previous check-in.  The empty-
+//   scene case is now handled by the presence gate, and the pipeline's own
+//   back-pressure sets the pace, so ATTEMPT_COOLDOWN is down to 200 ms.
+//   That is safe for feedback only because Feedback coalesces (feedback.h):
+//   a stranger posts NOT_RECOGNISED every frame, faster than the 600 ms
+//   pattern plays, and a queue of them would buzz without a break and hold
+//   back the next RECOGNISED.  The sequencer drops repeats and waits
+//   FEEDBACK_REPEAT_GAP_MS between them, so what the user hears no longer
+//   depends on this pacing.
 //
 // Problem 3 – "JPG Decompression Failed":
 //   fb_count=1 meant one shared DMA buffer.  Under heavy CPU load the camera
@@ -22,7 +34,9 @@
 //   encoded it.
 //   Fix: fb_count raised to 2 when PSRAM is present so the camera can fill one
 //   buffer while the previous is in use.  A free-heap guard prevents matrix
-//   allocation when memory is too low.
+//   allocation when memory is too low.  The capture broker (capture_broker.h)
+//   now copies each frame out and returns the DMA buffer immediately, so no
+//   consumer can hold one while the camera needs it.
 // ─────────────────────────────────────────────────────────────────────────────
 
 #include <stdio.h>
@@ -32,6 +46,14 @@
 #include <Arduino.h>
 #include "esp_camera.h"
 #include "sd_card.h"
+#include "attendance_journal.h"
+#include "match_stats.h"
+#include "cooldown_table.h"
+#include "feedback.h"
+#include "capture_broker.h"
+#include "frame_decode.h"
+#include "recognition_pipeline.h"
+#include "frame_pool.h"
 #include <WiFi.h>
 #include <ESPmDNS.h>
 #include "fd_forward.h"
@@ -54,24 +76,29 @@ const char* password = "Asdf1234";
 
 // ─── Global definitions (declared extern in global.h) ────────────────────────
 bool                isAttendanceMode     = true;
-unsigned long       lastRecognitionTime  = 0;  // set only on a successful match
 unsigned long       lastAttemptTime      = 0;  // set on every detection attempt
-const unsigned long RECOGNITION_COOLDOWN = 5000;  // ms – prevents double-logging same person
-const unsigned long ATTEMPT_COOLDOWN     = 500;   // ms – retry gap when no face found
+const unsigned long RECOGNITION_COOLDOWN = 5000;  // ms – per person, prevents double-logging
+const unsigned long ATTEMPT_COOLDOWN     = 200;   // ms – min gap between frames entering the pipeline (Problem 2)
 bool                ntpSynced            = false;
 AttendanceSettings  gSettings;
+PresenceGate        presenceGate;
 
 // ─── Minimum free heap before attempting matrix allocation ────────────────────
 // face_detect() + aligned matrix need ~80 KB; guard at 100 KB to be safe.
 // Heap guard: skip face_detect when free heap falls below this threshold.
-// Raised to 130 KB (was 100 KB) so httpd DynamicJsonDocument allocations
-// (up to 16 KB each for /api/logs) always have room even under load.
-#define MIN_FREE_HEAP_BYTES  (130 * 1024)
+// On top of that, room for the largest httpd DynamicJsonDocument still
+// allocated per request: 8 KB (users DB edits, manual attendance).  httpd
+// runs one handler at a time, and /api/logs streams through a fixed 1 KB
+// buffer now, so its old 16 KB document no longer counts.
+#define MIN_FREE_HEAP_BYTES  (108 * 1024)
 
 // ─── Forward declarations ────────────────────────────────────────────────────
 void startCameraServer();
 void initFaceRecognition();
-static void attendanceTask(void *pvParameters);
+static bool stageDecode(Pipeline::Job &job);       // recognition pipeline stages,
+static bool stageDetect(Pipeline::Job &job);       // defined after setup()
+static void stageRecognise(Pipeline::Job &job);
+static void stageRelease(Pipeline::Job &job);
 
 // ─── Camera initialisation ────────────────────────────────────────────────────
 static bool initCamera() {
@@ -183,6 +210,7 @@ void setup() {
     pinMode(RED_LED_GPIO,    OUTPUT); digitalWrite(RED_LED_GPIO,    LOW);
     pinMode(BUZZER_GPIO_NUM, OUTPUT); digitalWrite(BUZZER_GPIO_NUM, LOW);
     Serial.println("[HW]  GPIOs initialised (LEDs + buzzer all OFF)");
+    Feedback::begin({ GREEN_LED_GPIO, RED_LED_GPIO, BUZZER_GPIO_NUM });
 
     // 1) SD card — must succeed before proceeding.
     //    initSD() retries up to 4 times with SPI bus reset between attempts.
@@ -200,6 +228,7 @@ void setup() {
     }
     Bridge::loadSettings(gSettings);
     Bridge::listDir("/", 1);
+    Journal::begin();   // write-behind attendance log (SD writer task)
 
     // 2) Camera — also fatal if it fails (no point running attendance without it)
     if (!initCamera()) {
@@ -209,6 +238,13 @@ void setup() {
             digitalWrite(RED_LED_GPIO, LOW);  delay(500);
         }
     }
+    // The broker is the only caller of esp_camera_fb_get(); attendance and
+    // every /stream viewer share its frames.
+    Capture::begin(Capture::cameraSource(), 1);
+    // Per-frame image matrices (attendance pipeline, stream detection) come
+    // from fixed PSRAM slots instead of the heap.  Without PSRAM they stay
+    // on the heap as before.
+    if (psramFound()) FramePool::begin();
 
     // 3) WiFi — plain DHCP, works on any network (hotspot, router, office)
     strncpy(gSettings.ssid, ssid, sizeof(gSettings.ssid) - 1);
@@ -239,10 +275,13 @@ void setup() {
     // 5) HTTP server
     startCameraServer();
 
-    // 6) Attendance task pinned to CPU 0 (HTTP + stream run on CPU 1)
-    xTaskCreatePinnedToCore(
-        attendanceTask, "atd", 8192, NULL, 1, NULL, 0
-    );
+    // 6) Attendance pipeline: detection has CPU 0 to itself; decode and
+    //    recognition share CPU 1 with HTTP + stream, which mostly idle.
+    static const Pipeline::Stages stages = {
+        stageDecode, stageDetect, stageRecognise, stageRelease
+    };
+    static const int cores[Pipeline::STAGE_COUNT] = { 1, 0, 1 };
+    Pipeline::begin(stages, cores);
 
     // 7) NTP sync in a background task — never blocks setup()
     if (WiFi.status() == WL_CONNECTED) {
@@ -285,7 +324,7 @@ void setup() {
     Serial.printf("[READY] Stream:        http://%s:81/stream\n",
                   WiFi.localIP().toString().c_str());
     Serial.println("[READY] Login: admin / 1234");
-    Serial.println("[READY] Attendance task running on CPU 0.");
+    Serial.println("[READY] Attendance pipeline running (detect on CPU 0).");
 }
 
 // ─── initFaceRecognition() ───────────────────────────────────────────────────
@@ -314,191 +353,255 @@ void initFaceRecognition() {
     // O-net: output (landmark) network — keep strict to avoid false matches.
     mtmn_config.o_threshold.score            = 0.7f;
     mtmn_config.o_threshold.nms              = 0.7f;
-    mtmn_config.o_threshold.candidate_number = 1;
+    mtmn_config.o_threshold.candidate_number = maxFacesPerFrame();  // settings "maxFaces"
 
+    // id_list only accumulates an enrolment in progress; enrolled faces live
+    // in faceGallery, which has no fixed cap (PSRAM-backed).
     face_id_name_init(&id_list, 10, ENROLL_CONFIRM_TIMES);
-    Bridge::read_face_id_name_list_sdcard(&id_list, "/FACE.BIN");
-    Serial.printf("[FACE] Loaded %d enrolled face(s) | P-score=0.55 (low-light)\n",
-                  id_list.count);
+    if (gSettings.galleryInt8) {
+        // int8 rows in RAM; the top candidates are re-scored from FACE.BIN.
+        faceGallery.setMode(FaceGallery::INT8, [](uint32_t row, float *vec) {
+            return Bridge::readFaceRecord("/FACE.BIN", row, vec);
+        });
+    }
+    Bridge::loadFaceGallery(faceGallery, "/FACE.BIN");
+    Serial.printf("[FACE] Loaded %u enrolled face(s) | P-score=0.55 (low-light)\n",
+                  (unsigned)faceGallery.count());
 }
 
-// ─── Feedback helpers ─────────────────────────────────────────────────────────
-// Both functions use vTaskDelay so they yield the CPU while waiting —
-// safe to call from inside attendanceTask (pinned to CPU 0).
-
-// Called when a face is matched and attendance is logged.
-// Pattern: green LED on solid + two short buzzer beeps.
-static void feedbackRecognised() {
-    // Green LED stays on for the full duration so it dominates visually.
-    Serial.println("green led on");
-    digitalWrite(GREEN_LED_GPIO, HIGH);
-
-    // Beep 1
-    digitalWrite(BUZZER_GPIO_NUM, HIGH);
-    vTaskDelay(pdMS_TO_TICKS(120));
-    digitalWrite(BUZZER_GPIO_NUM, LOW);
-
-    // Gap between beeps
-    vTaskDelay(pdMS_TO_TICKS(120));
-
-    // Beep 2
-    digitalWrite(BUZZER_GPIO_NUM, HIGH);
-    vTaskDelay(pdMS_TO_TICKS(120));
-    digitalWrite(BUZZER_GPIO_NUM, LOW);
-
-    // Hold green briefly so it registers visually, then off.
-    vTaskDelay(pdMS_TO_TICKS(200));
-    digitalWrite(GREEN_LED_GPIO, LOW);
+// ─── Recognition helpers ──────────────────────────────────────────────────────
+
+// Queues one attendance record for an accepted gallery match.
+static void postMatch(const FaceGallery::Match &m) {
+    const char *matchName = m.name;
+    Serial.printf("[ATD] Recognised: %s (%.2f, next %.2f)\n",
+                  matchName, m.best, m.second);
+
+    UserRecord user;
+    bool found = Bridge::getUserByName(matchName, user);
+
+    AttendanceRecord rec = {};
+    if (found) {
+        strncpy(rec.uid,  user.id,   sizeof(rec.uid)  - 1);
+        strncpy(rec.name, user.name, sizeof(rec.name) - 1);
+        strncpy(rec.dept, user.dept, sizeof(rec.dept) - 1);
+    } else {
+        // Not in DB – use the enrolled name as fallback
+        strncpy(rec.uid,  matchName, sizeof(rec.uid)  - 1);
+        strncpy(rec.name, matchName, sizeof(rec.name) - 1);
+    }
+    rec.setConfidence(m.best);
+
+    Journal::post(rec);   // queued – SD append happens on the writer task
 }
 
-// Called when a face is detected but not in the enrolled database.
-// Pattern: red LED + long continuous buzz for 600 ms.
-static void feedbackNotRecognised() {
-    Serial.println("red led on");
-    digitalWrite(RED_LED_GPIO,    HIGH);  // red LED on
-    digitalWrite(BUZZER_GPIO_NUM, HIGH);  // buzzer on  (GPIO 1 – independent)
-    vTaskDelay(pdMS_TO_TICKS(600));
-    digitalWrite(RED_LED_GPIO,    LOW);
-    digitalWrite(BUZZER_GPIO_NUM, LOW);
+// Last time each person was logged – only that person waits out the cooldown.
+static CooldownTable<32> recentMatches(RECOGNITION_COOLDOWN);
+
+// Embeds up to maxFacesPerFrame() of the O-net boxes and matches them against
+// the gallery in one batch.  align_face() only looks at the first box of a
+// box_array_t, so each face is aligned through a one-box view of `boxes`
+// into the same aligned buffer (from the frame's arena).  Every distinct person matched is logged.
+// People still inside their RECOGNITION_COOLDOWN are matched but not logged;
+// *waiting counts them.  Returns the number of people logged, or -1 if no
+// face could be embedded.
+static int recogniseFaces(dl_matrix3du_t *im, box_array_t *boxes, FrameArena &arena,
+                          int *waiting) {
+    int n = boxes->len < maxFacesPerFrame() ? boxes->len : maxFacesPerFrame();
+
+    dl_matrix3du_t *aligned = arena.matrix(FACE_WIDTH, FACE_HEIGHT, 3);
+    if (!aligned) return -1;
+
+    dl_matrix3d_t *fids[FACE_GALLERY_BATCH_MAX];
+    const float   *queries[FACE_GALLERY_BATCH_MAX];
+    int faces = 0;
+    for (int i = 0; i < n; i++) {
+        box_array_t one = { &boxes->score[i], &boxes->box[i], &boxes->landmark[i], 1 };
+        if (align_face(&one, im, aligned) != ESP_OK) continue;
+        dl_matrix3d_t *fid = get_face_id(aligned);
+        if (!fid) break;            // OOM inside get_face_id – match what we have
+        fids[faces]    = fid;
+        queries[faces] = fid->item;
+        faces++;
+        esp_task_wdt_reset();       // ~150 ms of inference per face
+    }
+    if (faces == 0) return -1;
+
+    FaceGallery::Match m[FACE_GALLERY_BATCH_MAX];
+    faceGallery.matchBatch(queries, faces, matchThreshold(), m);
+
+    int logged = 0;
+    *waiting = 0;
+    uint32_t now = millis();
+    for (int j = 0; j < faces; j++) {
+        dl_matrix3d_free(fids[j]);
+        MatchStats::record(m[j].best, m[j].second, m[j].row >= 0);
+        if (m[j].row < 0) {
+            Serial.printf("[ATD] Face detected but not recognised (best %.2f)\n", m[j].best);
+            continue;
+        }
+        // Same person twice in one frame (reflection, photo on a badge):
+        // the journal would drop the second record anyway.
+        bool dup = false;
+        for (int k = 0; k < j && !dup; k++)
+            dup = m[k].row >= 0 && strncmp(m[k].name, m[j].name, ENROLL_NAME_LEN) == 0;
+        if (dup) continue;
+        uint32_t key = recentMatches.keyOf(m[j].name, ENROLL_NAME_LEN);
+        if (recentMatches.active(key, now)) { (*waiting)++; continue; }
+        recentMatches.stamp(key, now);
+        postMatch(m[j]);
+        logged++;
+    }
+    return logged;
 }
 
-// ─── attendanceTask() – FreeRTOS task pinned to CPU 0 ────────────────────────
-static void attendanceTask(void *pvParameters) {
-    Serial.println("[ATD] Task started on CPU 0");
+// ─── Recognition pipeline stages (recognition_pipeline.h) ───────────────────
+// The old attendanceTask loop, split at its two natural hand-off points.
+
+// Capture-broker subscription, held only while attendance is running so
+// the camera can idle when nobody needs frames.
+static int atdSub = -1;
+
+// DECODE: gates, newest frame, presence check, detection image.
+static bool stageDecode(Pipeline::Job &job) {
+    esp_task_wdt_reset();
 
     // Brief startup delay: let camera settle its AEC/AGC after init before
     // the first recognition attempt so the first frame isn't overexposed.
-    vTaskDelay(pdMS_TO_TICKS(2000));
-
-    while (true) {
-        esp_task_wdt_reset();  // feed WDT at the top of every iteration
+    static bool settled = false;
+    if (!settled) { vTaskDelay(pdMS_TO_TICKS(2000)); settled = true; }
 
-        // ── Gate: admin mode or auto-mode disabled ────────────────────────────
-        if (!isAttendanceMode || !gSettings.autoMode) {
-            vTaskDelay(pdMS_TO_TICKS(200));
-            continue;
-        }
+    // ── Gate: admin mode or auto-mode disabled ────────────────────────────────
+    if (!isAttendanceMode || !gSettings.autoMode) {
+        if (atdSub >= 0) { Capture::unsubscribe(atdSub); atdSub = -1; }
+        vTaskDelay(pdMS_TO_TICKS(200));
+        return false;
+    }
 
-        // ── Gate: enrollment in progress ─────────────────────────────────────
-        // While the stream handler is collecting confirmation frames for a new
-        // enrolment, attendanceTask must not compete for the camera framebuffer
-        // or call face_detect() concurrently.  This avoids DMA corruption and
-        // ensures the enrolment accumulator isn't confused by a parallel match.
-        if (is_enrolling == 1) {
-            vTaskDelay(pdMS_TO_TICKS(100));
-            continue;
-        }
+    // ── Gate: enrollment in progress ─────────────────────────────────────────
+    // While the stream handler is collecting confirmation frames for a new
+    // enrolment, the pipeline must not call face_detect() concurrently or
+    // log the person being enrolled.  (Frames themselves are shared by the
+    // capture broker, so there is no framebuffer contention.)
+    if (is_enrolling == 1) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+        return false;
+    }
 
-        unsigned long now = millis();
+    unsigned long now = millis();
 
-        // ── Cooldown throttles ────────────────────────────────────────────────
-        if (now - lastAttemptTime    < (unsigned long)ATTEMPT_COOLDOWN) {
-            vTaskDelay(pdMS_TO_TICKS(50));
-            continue;
-        }
-        if (now - lastRecognitionTime < (unsigned long)RECOGNITION_COOLDOWN) {
-            vTaskDelay(pdMS_TO_TICKS(50));
-            continue;
-        }
-        lastAttemptTime = now;
+    // ── Attempt pacing (per-person cooldown is in recogniseFaces) ─────────────
+    if (now - lastAttemptTime < (unsigned long)ATTEMPT_COOLDOWN) {
+        vTaskDelay(pdMS_TO_TICKS(50));
+        return false;
+    }
+    lastAttemptTime = now;
 
-        // ── Heap guard ────────────────────────────────────────────────────────
-        if (heap_caps_get_free_size(MALLOC_CAP_8BIT) < MIN_FREE_HEAP_BYTES) {
-            Serial.printf("[ATD] Low heap (%u B) – skipping\n",
-                          (unsigned)heap_caps_get_free_size(MALLOC_CAP_8BIT));
-            vTaskDelay(pdMS_TO_TICKS(500));
-            continue;
-        }
+    // ── Heap guard ────────────────────────────────────────────────────────────
+    if (heap_caps_get_free_size(MALLOC_CAP_8BIT) < MIN_FREE_HEAP_BYTES) {
+        Serial.printf("[ATD] Low heap (%u B) – skipping\n",
+                      (unsigned)heap_caps_get_free_size(MALLOC_CAP_8BIT));
+        vTaskDelay(pdMS_TO_TICKS(500));
+        return false;
+    }
 
-        // ── Grab frame ────────────────────────────────────────────────────────
-        camera_fb_t *fb = esp_camera_fb_get();
+    // ── Newest frame from the capture broker ──────────────────────────────────
+    if (atdSub < 0) atdSub = Capture::subscribe();
+    Capture::FrameRef frame = atdSub >= 0 ? Capture::next(atdSub, 1000) : Capture::FrameRef();
+    if (!frame) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+        return false;
+    }
 
-        if (!fb) {
-            vTaskDelay(pdMS_TO_TICKS(100));
-            continue;
+    // ── Presence gate ─────────────────────────────────────────────────────────
+    // A 1/8-scale luma thumbnail (JPEG DC coefficients only) is compared
+    // with the background; an empty, unchanged scene skips detection.
+    if (gSettings.presenceGate && frame->format == CAPTURE_FORMAT_JPEG) {
+        static uint8_t luma[PRESENCE_MAX_W * PRESENCE_MAX_H];
+        int lw, lh;
+        if (FrameDecode::decodeLuma(frame->buf, frame->len, 3, luma,
+                                    PRESENCE_MAX_W, PRESENCE_MAX_H, &lw, &lh)
+            && !presenceGate.update(luma, lw, lh, (uint32_t)millis())) {
+            vTaskDelay(pdMS_TO_TICKS(50));
+            return false;
         }
+    }
 
-        // ── Convert to RGB888 ─────────────────────────────────────────────────
-        dl_matrix3du_t *im = dl_matrix3du_alloc(1, fb->width, fb->height, 3);
-        if (!im) {
-            esp_camera_fb_return(fb);
-            vTaskDelay(pdMS_TO_TICKS(200));
-            continue;
-        }
+    // ── Detection image ───────────────────────────────────────────────────────
+    // JPEG frames are decoded straight to 1/2 size (DCT-domain scaling):
+    // MTMN's first pyramid level would shrink a full-size image anyway.
+    int shift = frame->format == CAPTURE_FORMAT_JPEG ? FRAME_DETECT_SHIFT : 0;
+    // Matrices come from the job's FramePool arena and are reclaimed with
+    // it, so nothing below frees them.
+    dl_matrix3du_t *im = shift
+        ? FrameDecode::decodeScaled(frame->buf, frame->len, shift, &job.arena)
+        : job.arena.matrix(frame->width, frame->height, 3);
+    if (!im) {
+        vTaskDelay(pdMS_TO_TICKS(200));
+        return false;
+    }
+    if (!shift && !fmt2rgb888(frame->buf, frame->len, (pixformat_t)frame->format, im->item)) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+        return false;
+    }
 
-        bool converted = fmt2rgb888(fb->buf, fb->len, fb->format, im->item);
-        esp_camera_fb_return(fb);
-        fb = nullptr;
+    job.im    = im;
+    job.shift = shift;
+    if (shift) job.frame = frame;   // DETECT decodes the face region from it
+    return true;
+}
 
-        if (!converted) {
-            dl_matrix3du_free(im);
-            vTaskDelay(pdMS_TO_TICKS(100));
-            continue;
-        }
+// DETECT: MTMN cascade, then the face area only at full resolution.
+static bool stageDetect(Pipeline::Job &job) {
+    esp_task_wdt_reset();
+    if (is_enrolling == 1) return false;   // enrolment started since DECODE
 
-        // ── Face detection ────────────────────────────────────────────────────
-        box_array_t *boxes = face_detect(im, &mtmn_config);
-
-        if (boxes) {
-            dl_matrix3du_t *aligned = dl_matrix3du_alloc(1, FACE_WIDTH, FACE_HEIGHT, 3);
-
-            if (aligned && align_face(boxes, im, aligned) == ESP_OK) {
-                dl_matrix3d_t *fid = get_face_id(aligned);
-                if (!fid) {
-                    // OOM inside get_face_id -- skip this frame, nothing to free
-                    if (aligned) dl_matrix3du_free(aligned);
-                    if (boxes->score)    dl_lib_free(boxes->score);
-                    if (boxes->box)      dl_lib_free(boxes->box);
-                    if (boxes->landmark) dl_lib_free(boxes->landmark);
-                    dl_lib_free(boxes);
-                    dl_matrix3du_free(im);
-                    vTaskDelay(pdMS_TO_TICKS(200));
-                    continue;
-                }
-                face_id_node  *match = recognize_face_with_name(&id_list, fid);
-
-                if (match) {
-                    Serial.printf("[ATD] Recognised: %s\n", match->id_name);
-
-                    UserRecord user;
-                    bool found = Bridge::getUserByName(match->id_name, user);
-
-                    AttendanceRecord rec = {};
-                    if (found) {
-                        strncpy(rec.uid,  user.id,   sizeof(rec.uid)  - 1);
-                        strncpy(rec.name, user.name, sizeof(rec.name) - 1);
-                        strncpy(rec.dept, user.dept, sizeof(rec.dept) - 1);
-                    } else {
-                        // Not in DB – use the enrolled name as fallback
-                        strncpy(rec.uid,  match->id_name, sizeof(rec.uid)  - 1);
-                        strncpy(rec.name, match->id_name, sizeof(rec.name) - 1);
-                    }
-
-                    Bridge::logAttendance(rec);
-                    lastRecognitionTime = now;
-
-                    if (gSettings.buzzerEnabled) {
-                        feedbackRecognised();
-                    }
-                } else {
-                    Serial.println("[ATD] Face detected but not recognised");
-                    if (gSettings.buzzerEnabled) {
-                        feedbackNotRecognised();
-                    }
-                }
-                dl_matrix3d_free(fid);
-            }
+    mtmn_config_t detCfg = mtmn_config;
+    detCfg.min_face = mtmn_config.min_face >> job.shift;   // same faces, smaller image
+    job.boxes = face_detect(job.im, &detCfg);
+    if (!job.boxes) return false;
 
-            if (aligned) dl_matrix3du_free(aligned);
-            // Free all box sub-arrays defensively
-            if (boxes->score)    dl_lib_free(boxes->score);
-            if (boxes->box)      dl_lib_free(boxes->box);
-            if (boxes->landmark) dl_lib_free(boxes->landmark);
-            dl_lib_free(boxes);
-        }
+    if (!job.shift) {
+        job.faceIm = job.im;            // full-size frame already
+        job.im     = nullptr;
+        return true;
+    }
+    int n = job.boxes->len < maxFacesPerFrame() ? job.boxes->len : maxFacesPerFrame();
+    job.boxes->len = n;                 // only these are mapped below
+    int x, y, w, h;
+    FrameDecode::mapBoxes(job.boxes, n, (float)(1 << job.shift), 0, 0);
+    if (FrameDecode::faceRegion(job.boxes, n, job.frame->width, job.frame->height, &x, &y, &w, &h))
+        job.faceIm = FrameDecode::decodeRegion(job.frame->buf, job.frame->len, x, y, w, h,
+                                               &job.arena);
+    if (job.faceIm) FrameDecode::mapBoxes(job.boxes, n, 1.0f, (float)-x, (float)-y);
+
+    // The JPEG is done with; drop the broker reference before RECOGNISE.
+    job.frame.reset();
+    return job.faceIm != nullptr;
+}
+
+// RECOGNISE: align, embed, match, log, feedback.
+static void stageRecognise(Pipeline::Job &job) {
+    esp_task_wdt_reset();
+    if (is_enrolling == 1) return;
+
+    int waiting = 0;
+    int matched = recogniseFaces(job.faceIm, job.boxes, job.arena, &waiting);
+    if (matched > 0) {
+        if (gSettings.buzzerEnabled) Feedback::post(Feedback::RECOGNISED);
+    } else if (matched == 0 && waiting == 0) {
+        if (gSettings.buzzerEnabled) Feedback::post(Feedback::NOT_RECOGNISED);
+    }
+}
 
-        dl_matrix3du_free(im);
-        vTaskDelay(pdMS_TO_TICKS(50));  // yield between inference cycles
+// Image matrices live in job.arena; only esp-face's box arrays are left.
+static void stageRelease(Pipeline::Job &job) {
+    if (job.boxes) {
+        // Free all box sub-arrays defensively
+        if (job.boxes->score)    dl_lib_free(job.boxes->score);
+        if (job.boxes->box)      dl_lib_free(job.boxes->box);
+        if (job.boxes->landmark) dl_lib_free(job.boxes->landmark);
+        dl_lib_free(job.boxes);
     }
 }
 
@@ -507,4 +610,6 @@ static void attendanceTask(void *pvParameters) {
 // httpd gets clean scheduling and the CPU 1 IDLE task always feeds the WDT.
 void loop() {
     vTaskDelay(pdMS_TO_TICKS(1000));
+    // A FACE.BIN patch that found the card busy is written here.
+    Bridge::syncFaceGallery(faceGallery, "/FACE.BIN");
 }
@@ -0,0 +1,75 @@
+// match_stats.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Recognition score histogram (see match_stats.h).
+
+#include "match_stats.h"
+
+#include <atomic>
+#include "global.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Module-level state
+// ═══════════════════════════════════════════════════════════════════════════════
+static std::atomic<uint32_t> _accepted[MATCH_STATS_BINS];
+static std::atomic<uint32_t> _rejected[MATCH_STATS_BINS];
+static std::atomic<uint32_t> _margin[MATCH_STATS_MARGIN_BINS];
+static std::atomic<uint32_t> _sinceMs{0};
+
+static int _bin(float v, int bins) {
+    int b = (int)(v * MATCH_STATS_BINS);
+    return b < 0 ? 0 : (b >= bins ? bins - 1 : b);
+}
+
+static void _appendArray(String &out, const char *key, std::atomic<uint32_t> *v, int n) {
+    out += ",\"";
+    out += key;
+    out += "\":[";
+    for (int i = 0; i < n; i++) {
+        if (i) out += ',';
+        out += String((unsigned long)v[i].load());
+    }
+    out += ']';
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Public API
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace MatchStats {
+
+void record(float best, float second, bool accepted) {
+    if (best < 0) return;   // empty gallery – nothing was scored
+    (accepted ? _accepted : _rejected)[_bin(best, MATCH_STATS_BINS)]++;
+    if (second >= 0) _margin[_bin(best - second, MATCH_STATS_MARGIN_BINS)]++;
+}
+
+void reset() {
+    for (auto &c : _accepted) c = 0;
+    for (auto &c : _rejected) c = 0;
+    for (auto &c : _margin)   c = 0;
+    _sinceMs = (uint32_t)millis();
+}
+
+String toJSON() {
+    uint32_t acc = 0, rej = 0;
+    for (auto &c : _accepted) acc += c.load();
+    for (auto &c : _rejected) rej += c.load();
+
+    String out;
+    out.reserve(512);
+    out  = "{\"threshold\":";
+    out += String(matchThreshold(), 2);
+    out += ",\"binWidth\":";
+    out += String(1.0f / MATCH_STATS_BINS, 2);
+    out += ",\"accepted\":";
+    out += String((unsigned long)acc);
+    out += ",\"rejected\":";
+    out += String((unsigned long)rej);
+    out += ",\"seconds\":";
+    out += String((unsigned long)((millis() - _sinceMs.load()) / 1000));
+    _appendArray(out, "acceptedBins", _accepted, MATCH_STATS_BINS);
+    _appendArray(out, "rejectedBins", _rejected, MATCH_STATS_BINS);
+    _appendArray(out, "marginBins",   _margin,   MATCH_STATS_MARGIN_BINS);
+    out += '}';
+    return out;
+}
+
+} // namespace MatchStats
@@ -0,0 +1,72 @@
+// mjpeg_part.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// MJPEG part header and single-call gather write (see mjpeg_part.h).
+
+#include "mjpeg_part.h"
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#ifdef FACEGUARD_HOST
+  #include <sys/uio.h>
+#endif
+
+namespace Mjpeg {
+
+size_t formatHead(char *out, size_t cap, size_t bodyLen, const struct timeval &ts,
+                  const char *extra, ...) {
+    if (!cap) return 0;
+    int n = snprintf(out, cap,
+        "\r\n--" MJPEG_BOUNDARY "\r\n"
+        "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n",
+        (unsigned)bodyLen, (int)ts.tv_sec, (int)ts.tv_usec);
+    if (n < 0) n = 0;
+    if (extra && (size_t)n < cap) {
+        va_list ap;
+        va_start(ap, extra);
+        int e = vsnprintf(out + n, cap - n, extra, ap);
+        va_end(ap);
+        if (e > 0) n += e;
+    }
+    if ((size_t)n < cap) n += snprintf(out + n, cap - n, "\r\n");
+    return (size_t)n < cap ? (size_t)n : cap - 1;
+}
+
+ssize_t write(int fd, Wire &w, int flags) {
+    // lwip before 2.1 has no TCP sendmsg(); fall back to one send() per
+    // segment the first time it says so.
+    static bool noGather = false;
+
+    if (w.done()) return 0;
+    struct iovec iov[2];
+    int cnt = 0;
+    if (w.off < w.headLen) {
+        iov[cnt].iov_base = (void *)(w.head + w.off);
+        iov[cnt].iov_len  = w.headLen - w.off;
+        cnt++;
+    }
+    if (w.body && w.bodyLen) {
+        size_t at = w.off > w.headLen ? w.off - w.headLen : 0;
+        iov[cnt].iov_base = (void *)(w.body + at);
+        iov[cnt].iov_len  = w.bodyLen - at;
+        cnt++;
+    }
+
+    ssize_t r = -1;
+    if (!noGather) {
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov    = iov;
+        msg.msg_iovlen = cnt;
+        r = sendmsg(fd, &msg, flags);
+        if (r < 0 && (errno == EOPNOTSUPP || errno == ENOSYS)) noGather = true;
+    }
+    if (noGather) r = send(fd, iov[0].iov_base, iov[0].iov_len, flags);
+
+    if (r < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? 0 : -1;
+    w.off += (size_t)r;
+    return r;
+}
+
+} // namespace Mjpeg
@@ -0,0 +1,127 @@
+// presence_gate.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Luma frame differencing against an adaptive background (see presence_gate.h).
+
+#include "presence_gate.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Gate
+// ═══════════════════════════════════════════════════════════════════════════════
+void PresenceGate::reset() {
+    _w = _h = 0;
+}
+
+// Mean of a - b over n pixels: the global brightness shift between them.
+static int32_t _meanDiff(const uint8_t *a, const uint8_t *b, const uint16_t *b16, int n) {
+    int32_t sum = 0;
+    for (int i = 0; i < n; i++) sum += (int32_t)a[i] - (b ? b[i] : b16[i] >> 8);
+    return sum / n;
+}
+
+bool PresenceGate::update(const uint8_t *luma, int w, int h, uint32_t nowMs) {
+    uint32_t t0 = (uint32_t)micros();
+    _frames++;
+
+    int n = w * h;
+    if (!luma || w <= 0 || h <= 0 || w > PRESENCE_MAX_W || h > PRESENCE_MAX_H) return true;
+
+    // New geometry (first frame, framesize change): adopt the frame as the
+    // background and run the pipeline on it.
+    if (w != _w || h != _h) {
+        for (int i = 0; i < n; i++) _bg[i] = (uint16_t)(luma[i] << 8);
+        memcpy(_prev, luma, n);
+        _w = w; _h = h;
+        _lastChangeMs = _lastMotionMs = nowMs;
+        _changed++;
+        return true;
+    }
+
+    int32_t bgMean   = _meanDiff(luma, nullptr, _bg, n);
+    int32_t prevMean = _meanDiff(luma, _prev, nullptr, n);
+
+    int fg = 0, moved = 0;
+    for (int i = 0; i < n; i++) {
+        int32_t d   = (int32_t)luma[i] - (_bg[i] >> 8) - bgMean;
+        bool    hot = abs(d) > PRESENCE_PIXEL_DELTA;
+        fg    += hot;
+        moved += abs((int32_t)luma[i] - _prev[i] - prevMean) > PRESENCE_PIXEL_DELTA;
+        // Foreground learns slowly so a person is not absorbed while they
+        // stand at the camera; background (and lighting drift) learns fast.
+        int32_t bg = _bg[i];
+        bg += (((int32_t)luma[i] << 8) - bg) >> (hot ? PRESENCE_LEARN_BUSY : PRESENCE_LEARN_IDLE);
+        _bg[i] = (uint16_t)bg;
+    }
+    memcpy(_prev, luma, n);
+
+    int   area    = (int)(n * PRESENCE_AREA_PCT / 100.0f + 0.5f);
+    bool  motion  = moved >= area;
+    bool  present = fg >= area;
+    _lastChangeMilli = (uint32_t)(fg * 100000.0f / n);
+
+    if (motion) _lastMotionMs = nowMs;
+    if (present && !motion && nowMs - _lastMotionMs >= PRESENCE_STILL_MS) {
+        for (int i = 0; i < n; i++) _bg[i] = (uint16_t)(luma[i] << 8);
+        _absorbed++;
+        present = false;
+    }
+
+    bool run;
+    if (motion || present) {
+        _lastChangeMs = nowMs;
+        _changed++;
+        run = true;
+    } else if (nowMs - _lastChangeMs < PRESENCE_HOLD_MS) {
+        _held++;
+        run = true;
+    } else {
+        _skipped++;
+        run = false;
+    }
+
+    uint32_t us = (uint32_t)micros() - t0;
+    if (us > _maxUs) _maxUs = us;
+    return run;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Statistics
+// ═══════════════════════════════════════════════════════════════════════════════
+PresenceGate::Stats PresenceGate::stats() const {
+    Stats s;
+    s.frames        = _frames;
+    s.changed       = _changed;
+    s.held          = _held;
+    s.skipped       = _skipped;
+    s.absorbed      = _absorbed;
+    s.lastChangePct = _lastChangeMilli / 1000.0f;
+    s.maxUs         = _maxUs;
+    return s;
+}
+
+String PresenceGate::toJSON() const {
+    Stats s = stats();
+    // hitRate: share of frames that went on to face_detect.
+    float hit = s.frames ? (s.frames - s.skipped) * 100.0f / s.frames : 0.0f;
+    String out;
+    out.reserve(192);
+    out  = "{\"frames\":";
+    out += String((unsigned long)s.frames);
+    out += ",\"changed\":";
+    out += String((unsigned long)s.changed);
+    out += ",\"held\":";
+    out += String((unsigned long)s.held);
+    out += ",\"skipped\":";
+    out += String((unsigned long)s.skipped);
+    out += ",\"hitRate\":";
+    out += String(hit, 1);
+    out += ",\"absorbed\":";
+    out += String((unsigned long)s.absorbed);
+    out += ",\"lastChangePct\":";
+    out += String(s.lastChangePct, 2);
+    out += ",\"maxUs\":";
+    out += String((unsigned long)s.maxUs);
+    out += '}';
+    return out;
+}
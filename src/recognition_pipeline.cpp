@@ -0,0 +1,209 @@
+// recognition_pipeline.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// Three-stage recognition pipeline: tasks, queues, Job slots, statistics.
+
+#include "recognition_pipeline.h"
+
+#include <atomic>
+#include "bounded_queue.h"
+#include "os_port.h"
+
+namespace Pipeline {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Module-level state
+// ═══════════════════════════════════════════════════════════════════════════════
+// Queue between two stages.  One producer and one consumer each, so a
+// binary OsSignal per direction is enough: `ready` wakes the consumer,
+// `room` wakes the producer.
+struct Link {
+    BoundedQueue<Job *, PIPELINE_QUEUE_LEN> q;
+    OsSignal                               *ready;
+    OsSignal                               *room;
+    std::atomic<uint32_t>                   maxDepth{0};
+};
+
+struct Counters {
+    std::atomic<uint32_t> done{0}, dropped{0}, avgUs{0}, maxUs{0};
+    std::atomic<uint32_t> busy{0};      // EWMA of body / (wait + body), × 10000
+};
+
+static Stages   _stages   = {};
+static bool     _started  = false;
+static Job      _jobs[PIPELINE_JOBS];
+static BoundedQueue<Job *, PIPELINE_JOBS> _free;
+static Link     _links[STAGE_COUNT - 1];    // DECODE→DETECT, DETECT→RECOGNISE
+static Counters _count[STAGE_COUNT];
+static std::atomic<uint32_t> _latencyAvgUs{0}, _latencyMaxUs{0};
+
+static const char *const kNames[STAGE_COUNT] = { "decode", "detect", "recognise" };
+
+// Single writer per value, so load / store is enough.
+static void _ewma(std::atomic<uint32_t> &avg, uint32_t v) {
+    uint32_t a = avg;
+    avg = a ? a - (a >> 3) + (v >> 3) : v;
+}
+
+static void _max(std::atomic<uint32_t> &m, uint32_t v) {
+    if (v > m) m = v;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Queues
+// ═══════════════════════════════════════════════════════════════════════════════
+static void _waitRoom(Link &l, size_t limit) {
+    while (l.q.size() >= limit) l.room->take(100);
+}
+
+static void _push(Link &l, Job *j) {
+    while (!l.q.push(j)) l.room->take(100);
+    _max(l.maxDepth, (uint32_t)l.q.size());
+    l.ready->give();
+}
+
+static Job *_pop(Link &l) {
+    Job *j;
+    while (!l.q.pop(j)) l.ready->take(100);
+    l.room->give();
+    return j;
+}
+
+// Job finished or dropped: free what it holds and return the slot.
+static void _recycle(Job *j) {
+    _stages.release(*j);
+    FramePool::release(j->arena);
+    j->frame.reset();
+    j->im = j->faceIm = nullptr;
+    j->boxes = nullptr;
+    _free.push(j);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Stage tasks
+// ═══════════════════════════════════════════════════════════════════════════════
+static void _stageTask(void *arg) {
+    Stage     s   = (Stage)(intptr_t)arg;
+    Link     *in  = s == DECODE    ? nullptr : &_links[s - 1];
+    Link     *out = s == RECOGNISE ? nullptr : &_links[s];
+    Counters &c   = _count[s];
+
+    uint32_t w0 = micros();     // end of the previous piece of work
+    for (;;) {
+        Job *j;
+        if (in) {
+            j = _pop(*in);
+        } else {
+            // Take a frame only once DETECT is about to want it, so it is
+            // the newest one rather than whatever was current a stage ago.
+            _waitRoom(*out, PIPELINE_DECODE_AHEAD);
+            if (!_free.pop(j)) { osDelayMs(10); continue; }
+            j->startUs = micros();
+        }
+
+        uint32_t t0 = micros();
+        bool pass;
+        switch (s) {
+            case DECODE:    pass = _stages.decode(*j);              break;
+            case DETECT:    pass = _stages.detect(*j);              break;
+            default:        _stages.recognise(*j); pass = false;    break;
+        }
+        uint32_t t1 = micros(), us = t1 - t0;
+
+        // DECODE returning false means "nothing to do" (attendance off,
+        // presence gate closed); it paces itself, so that counts as waiting.
+        if (s == DECODE && !pass) { _recycle(j); continue; }
+
+        _ewma(c.avgUs, us);
+        _max(c.maxUs, us);
+        uint32_t span = t1 - w0;
+        _ewma(c.busy, span ? (uint32_t)((uint64_t)us * 10000 / span) : 10000);
+
+        if (s == RECOGNISE) {
+            uint32_t lat = t1 - j->startUs;
+            _ewma(_latencyAvgUs, lat);
+            _max(_latencyMaxUs, lat);
+            c.done++;
+            _recycle(j);
+        } else if (pass) {
+            c.done++;
+            _push(*out, j);
+        } else {
+            c.dropped++;
+            _recycle(j);
+        }
+        w0 = micros();          // time blocked on a full queue is not waiting for input
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Public API
+// ═══════════════════════════════════════════════════════════════════════════════
+bool begin(const Stages &stages, const int cores[STAGE_COUNT]) {
+    if (_started) return true;
+    if (!stages.decode || !stages.detect || !stages.recognise || !stages.release) return false;
+    _stages = stages;
+    for (auto &l : _links) {
+        l.ready = new OsSignal();
+        l.room  = new OsSignal();
+    }
+    for (auto &j : _jobs) _free.push(&j);
+
+    // face_detect() and get_face_id() need the deep stacks the old single
+    // attendance task had; DECODE only runs the JPEG decoder.
+    static const uint32_t kStack[STAGE_COUNT] = { 6144, 8192, 8192 };
+    static const char    *kTask[STAGE_COUNT]  = { "atd_dec", "atd_det", "atd_rec" };
+    for (int s = 0; s < STAGE_COUNT; s++) {
+        if (!osTaskStart(_stageTask, kTask[s], kStack[s], (void *)(intptr_t)s, 1, cores[s])) {
+            Serial.printf("[PIPE] %s task failed to start\n", kTask[s]);
+            return false;
+        }
+    }
+    _started = true;
+    Serial.printf("[PIPE] Recognition pipeline started (decode CPU %d, detect CPU %d, "
+                  "recognise CPU %d)\n", cores[DECODE], cores[DETECT], cores[RECOGNISE]);
+    return true;
+}
+
+Stats stats() {
+    Stats st = {};
+    for (int s = 0; s < STAGE_COUNT; s++) {
+        StageStats &o = st.stage[s];
+        o.done    = _count[s].done;
+        o.dropped = _count[s].dropped;
+        o.avgUs   = _count[s].avgUs;
+        o.maxUs   = _count[s].maxUs;
+        o.busyPct = (_count[s].busy + 50) / 100;
+        if (s > DECODE) {
+            o.queued    = (uint32_t)_links[s - 1].q.size();
+            o.queuedMax = _links[s - 1].maxDepth;
+        }
+    }
+    st.latencyAvgUs = _latencyAvgUs;
+    st.latencyMaxUs = _latencyMaxUs;
+    return st;
+}
+
+String toJSON() {
+    Stats st = stats();
+    String out;
+    out.reserve(480);
+    out = "{\"stages\":[";
+    for (int s = 0; s < STAGE_COUNT; s++) {
+        const StageStats &o = st.stage[s];
+        char buf[160];
+        snprintf(buf, sizeof(buf),
+            "%s{\"name\":\"%s\",\"done\":%u,\"dropped\":%u,\"avgUs\":%u,\"maxUs\":%u,"
+            "\"busyPct\":%u,\"queued\":%u,\"queuedMax\":%u}",
+            s ? "," : "", kNames[s], (unsigned)o.done, (unsigned)o.dropped,
+            (unsigned)o.avgUs, (unsigned)o.maxUs, (unsigned)o.busyPct,
+            (unsigned)o.queued, (unsigned)o.queuedMax);
+        out += buf;
+    }
+    out += "],\"latencyAvgUs\":";
+    out += String((unsigned long)st.latencyAvgUs);
+    out += ",\"latencyMaxUs\":";
+    out += String((unsigned long)st.latencyMaxUs);
+    out += '}';
+    return out;
+}
+
+} // namespace Pipeline
@@ -0,0 +1,107 @@
+// snapshot_cache.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// /capture snapshots served from the capture broker's latest frame, with one
+// shared refresh when it is too old (see snapshot_cache.h).
+
+#include "snapshot_cache.h"
+
+#include <string.h>
+#include <atomic>
+#include "os_port.h"
+
+#if defined(FACEGUARD_HOST)
+  #include <time.h>
+  #include <unistd.h>
+#else
+  #include "esp_system.h"       // esp_random()
+#endif
+
+namespace Snapshot {
+
+static OsMutex  *_refreshMtx = nullptr;     // one refresh at a time
+static uint32_t  _bootId     = 0;           // ETags from before a reboot never match
+static std::atomic<uint32_t> _cached{0}, _refreshed{0}, _shared{0}, _notModified{0}, _failed{0};
+
+static bool _fresh(const Capture::FrameRef &f, uint32_t maxAgeMs) {
+    return f && f->format == CAPTURE_FORMAT_JPEG && millis() - f->ms <= maxAgeMs;
+}
+
+void begin() {
+    if (_refreshMtx) return;
+    _refreshMtx = new OsMutex();
+#if defined(FACEGUARD_HOST)
+    _bootId = (uint32_t)time(nullptr) ^ ((uint32_t)getpid() << 16);
+#else
+    _bootId = esp_random();
+#endif
+}
+
+Capture::FrameRef get(uint32_t maxAgeMs) {
+    if (!_refreshMtx) return Capture::FrameRef();
+    Capture::FrameRef f = Capture::latest();
+    if (_fresh(f, maxAgeMs)) { _cached++; return f; }
+
+    // Too old.  Whoever holds the lock is already fetching a frame; once we
+    // get it, that frame is most likely fresh enough for us too.
+    OsLock l(*_refreshMtx);
+    f = Capture::latest();
+    if (_fresh(f, maxAgeMs)) { _shared++; return f; }
+
+    int sub = Capture::subscribe();
+    if (sub < 0) { _failed++; return Capture::FrameRef(); }
+    // With nobody else subscribed the camera was idle, and the frames the
+    // driver still holds were taken back then – skip them.
+    int skip = Capture::stats().subscribers == 1 ? SNAPSHOT_WARMUP_FRAMES : 0;
+    uint32_t start = millis();
+    f.reset();
+    for (;;) {
+        uint32_t waited = millis() - start;
+        if (waited >= SNAPSHOT_WAIT_MS) { f.reset(); break; }
+        f = Capture::next(sub, SNAPSHOT_WAIT_MS - waited);
+        if (!f) break;
+        if (skip-- > 0 || f->format != CAPTURE_FORMAT_JPEG) continue;
+        break;
+    }
+    Capture::unsubscribe(sub);
+    if (!f) { _failed++; return f; }
+    _refreshed++;
+    return f;
+}
+
+void etag(const Capture::Frame &f, char *out, size_t len) {
+    snprintf(out, len, "\"%08x-%x\"", (unsigned)_bootId, (unsigned)f.seq);
+}
+
+bool notModified(const char *ifNoneMatch, const char *tag) {
+    if (!ifNoneMatch || !tag || !tag[0]) return false;
+    // A list of tags ("a", "b"), W/ prefixes allowed, or *.
+    bool hit = strstr(ifNoneMatch, tag) != nullptr;
+    if (!hit) {
+        const char *p = ifNoneMatch;
+        while (*p == ' ') p++;
+        hit = p[0] == '*' && (p[1] == '\0' || p[1] == ' ');
+    }
+    if (hit) _notModified++;
+    return hit;
+}
+
+Stats stats() {
+    Stats st;
+    st.cached      = _cached;
+    st.refreshed   = _refreshed;
+    st.shared      = _shared;
+    st.notModified = _notModified;
+    st.failed      = _failed;
+    return st;
+}
+
+String toJSON() {
+    Stats st = stats();
+    char buf[128];
+    snprintf(buf, sizeof(buf),
+        "{\"cached\":%u,\"refreshed\":%u,\"shared\":%u,\"notModified\":%u,\"failed\":%u}",
+        (unsigned)st.cached, (unsigned)st.refreshed, (unsigned)st.shared,
+        (unsigned)st.notModified, (unsigned)st.failed);
+    return String(buf);
+}
+
+} // namespace Snapshot
@@ -0,0 +1,433 @@
+// stream_broadcast.cpp  –  FaceGuard Pro  (ESP32-CAM)
+// MJPEG fan-out: one producer renders each frame once, one sender writes the
+// newest part to every viewer socket without blocking (see stream_broadcast.h).
+
+#include "stream_broadcast.h"
+
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+#include <new>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include "mjpeg_part.h"
+#include "os_port.h"
+
+#ifndef MSG_NOSIGNAL
+  #define MSG_NOSIGNAL 0        // lwip never raises SIGPIPE
+#endif
+
+namespace Broadcast {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Parts
+// ═══════════════════════════════════════════════════════════════════════════════
+// Shared ownership of a Part, as Capture::FrameRef is for frames.
+class PartRef {
+public:
+    PartRef() {}
+    explicit PartRef(Part *p) : _p(p) {}
+    PartRef(const PartRef &o) : _p(o._p) { if (_p) _p->refs++; }
+    PartRef &operator=(PartRef o) { Part *t = _p; _p = o._p; o._p = t; return *this; }
+    ~PartRef() { reset(); }
+
+    void reset() {
+        if (_p && --_p->refs == 0) {
+            if (_p->encoded) free(_p->encoded);
+            _p->~Part();
+            osFreeLarge(_p);
+        }
+        _p = nullptr;
+    }
+    Part *get() const { return _p; }
+    Part *operator->() const { return _p; }
+    explicit operator bool() const { return _p != nullptr; }
+
+private:
+    Part *_p = nullptr;
+};
+
+static Part *_newPart(const Capture::FrameRef &fr) {
+    void *mem = osAllocLarge(sizeof(Part), 16);
+    if (!mem) return nullptr;
+    Part *p     = new (mem) Part();
+    p->frame    = fr;
+    p->plain    = p->clean    = fr->buf;
+    p->plainLen = p->cleanLen = fr->len;
+    p->encoded  = nullptr;
+    p->quality  = 0;
+    p->faces[0] = '\0';
+    p->refs     = 1;
+    return p;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Module-level state
+// ═══════════════════════════════════════════════════════════════════════════════
+struct Viewer {
+    bool           used;
+    uint8_t        gen;             // bumped per addViewer(), part of the id
+    Kind           kind;
+    int            fd;
+    uint32_t       lastSeq;         // newest part taken
+    PartRef        part;            // being written
+    char           head[BROADCAST_HEAD_MAX];
+    Mjpeg::Wire    wire;            // head + part body; headLen 0 when idle
+    uint32_t       progressMs;      // millis() of the last accepted byte
+    std::atomic<uint32_t> sent, skipped, bytes, writes;
+    // Controller (sender task only; stats() reads them racily)
+    uint32_t       targetMs;        // send-time target, 0 = off
+    uint32_t       intervalMs;      // minimum spacing between parts
+    uint8_t        qLevel;          // index into kQuality
+    uint32_t       loadMs;          // millis() the current part was taken
+    uint32_t       dueMs;           // earliest millis() for the next part
+    uint32_t       latMs, sendMs, kbps;   // EWMAs
+};
+
+static const uint8_t kQuality[BROADCAST_QUALITY_LEVELS] = { 90, 75, 60, 45, 30 };
+
+static Render    _render   = nullptr;
+static OsMutex  *_mtx      = nullptr;   // _latest, _viewers[], _viewerCount
+static OsSignal *_wake     = nullptr;   // producer: first viewer arrived
+static OsSignal *_ready    = nullptr;   // sender: new part or new viewer
+static PartRef   _latest;
+static uint32_t  _seq      = 0;
+static int       _viewerCount = 0;
+static Viewer    _viewers[BROADCAST_MAX_VIEWERS];
+static void    (*_onStall)(int fd) = nullptr;
+
+static std::atomic<uint32_t> _produced{0}, _renderFailed{0}, _stalled{0};
+static std::atomic<uint32_t> _avgRenderUs{0}, _maxRenderUs{0};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Producer task
+// ═══════════════════════════════════════════════════════════════════════════════
+static void _producerTask(void *) {
+    int sub = -1;
+    for (;;) {
+        Want     want = { false, false, kQuality[0] };
+        int32_t  wait = INT32_MAX;      // ms until some viewer is due a part
+        uint8_t  dueQuality = 0;        // lowest quality a due plain viewer asked for
+        {
+            OsLock   l(*_mtx);
+            uint32_t now = millis();
+            for (auto &v : _viewers) {
+                if (!v.used) continue;
+                uint8_t q = kQuality[v.qLevel];
+                if (v.kind == PLAIN) {
+                    want.plain   = true;
+                    want.quality = std::min(want.quality, q);
+                } else {
+                    want.overlay = true;
+                }
+                // Busy viewers take the newest part when they finish; only
+                // an idle one needs a fresh render.
+                if (v.wire.headLen) continue;
+                int32_t due = (int32_t)(v.dueMs - now);
+                wait = std::min(wait, due);
+                if (due <= 0 && v.kind == PLAIN && (!dueQuality || q < dueQuality)) dueQuality = q;
+            }
+            if (!_viewerCount) _latest.reset();
+        }
+        // Plain viewers share one encode.  Render at the quality of whoever
+        // this frame is for, so a viewer on a good link is not held to a
+        // congested one's quality for every frame.
+        if (dueQuality) want.quality = dueQuality;
+        if (!want.plain && !want.overlay) {
+            // Nobody is watching: give the camera subscription back.
+            if (sub >= 0) { Capture::unsubscribe(sub); sub = -1; }
+            _wake->take(CAPTURE_IDLE_POLL_MS);
+            continue;
+        }
+        if (wait > 0) {
+            // Every viewer is sending or spacing its frames out: render
+            // nothing until one is due.
+            _wake->take(std::min(wait, (int32_t)BROADCAST_POLL_MS));
+            continue;
+        }
+        if (sub < 0 && (sub = Capture::subscribe()) < 0) { osDelayMs(CAPTURE_IDLE_POLL_MS); continue; }
+
+        Capture::FrameRef fr = Capture::next(sub, 1000);
+        if (!fr) continue;
+        PartRef p(_newPart(fr));
+        if (!p) { _renderFailed++; osDelayMs(20); continue; }
+
+        uint32_t t0 = micros();
+        bool ok = _render(*p.get(), want);
+        uint32_t us = micros() - t0;
+        if (!ok) { _renderFailed++; continue; }
+        uint32_t a = _avgRenderUs;
+        _avgRenderUs = a ? a - (a >> 3) + (us >> 3) : us;
+        if (us > _maxRenderUs) _maxRenderUs = us;
+
+        {
+            OsLock l(*_mtx);
+            p->seq  = ++_seq;
+            _latest = p;
+        }
+        _produced++;
+        _ready->give();
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Sender task
+// ═══════════════════════════════════════════════════════════════════════════════
+static void _load(Viewer &v, const PartRef &p, uint32_t now) {
+    if (v.lastSeq) v.skipped += p->seq - v.lastSeq - 1;
+    v.lastSeq = p->seq;
+    v.part    = p;
+    v.loadMs  = now;
+    v.dueMs   = now + v.intervalMs;
+    bool faces   = v.kind == OVERLAY && p->faces[0];
+    int  quality = v.kind == PLAIN ? p->quality : 0;
+    v.wire.body    = v.kind == OVERLAY ? p->clean    : p->plain;
+    v.wire.bodyLen = v.kind == OVERLAY ? p->cleanLen : p->plainLen;
+    // X-Stream: this viewer's operating point, as the controller last set it.
+    char q[8] = "camera";
+    if (quality) snprintf(q, sizeof(q), "%d", quality);
+    v.wire.head    = v.head;
+    v.wire.headLen = Mjpeg::formatHead(v.head, sizeof(v.head), v.wire.bodyLen, p->frame->ts,
+        "X-Stream: quality=%s;interval=%u;send=%u;target=%u;latency=%u;kbps=%u\r\n%s%s%s",
+        q, (unsigned)v.intervalMs, (unsigned)v.sendMs, (unsigned)v.targetMs,
+        (unsigned)v.latMs, (unsigned)v.kbps,
+        faces ? "X-Faces: " : "", faces ? p->faces : "", faces ? "\r\n" : "");
+    v.wire.off     = 0;
+}
+
+static uint32_t _ewma4(uint32_t avg, uint32_t v) { return avg ? (avg * 3 + v) / 4 : v; }
+
+// A part has gone out: update v's measurements and operating point.  The
+// send time is what the viewer's link controls; end-to-end latency also
+// includes render time and is only reported.
+static void _adapt(Viewer &v, uint32_t now) {
+    uint32_t spent = now - v.loadMs;
+    v.latMs  = _ewma4(v.latMs, now - v.part->frame->ms);
+    v.sendMs = _ewma4(v.sendMs, spent);
+    if (spent) v.kbps = _ewma4(v.kbps, (uint32_t)(v.wire.total() * 1000 / 1024 / spent));
+    if (!v.targetMs) return;
+
+    if (v.sendMs > v.targetMs) {
+        // Behind: fewer frames (frees the link at no CPU cost) and smaller
+        // ones where the firmware re-encodes anyway.
+        v.intervalMs = std::min(std::max(v.intervalMs * 3 / 2, (uint32_t)100),
+                                (uint32_t)BROADCAST_MAX_INTERVAL_MS);
+        if (v.qLevel < BROADCAST_QUALITY_LEVELS - 1) v.qLevel++;
+    } else if (v.sendMs < v.targetMs / 2) {
+        // Headroom: frame rate back first, then quality.
+        if (v.intervalMs)  v.intervalMs = v.intervalMs * 3 / 4 < 50 ? 0 : v.intervalMs * 3 / 4;
+        else if (v.qLevel) v.qLevel--;
+    }
+}
+
+// Writes what the socket takes without blocking – head and body in one
+// call (mjpeg_part.h), usually one call per part.  False on a socket error.
+static bool _write(Viewer &v, uint32_t now) {
+    while (!v.wire.done()) {
+        ssize_t r = Mjpeg::write(v.fd, v.wire, MSG_DONTWAIT | MSG_NOSIGNAL);
+        v.writes++;
+        if (r < 0) return false;
+        if (r == 0) return true;
+        v.bytes     += (uint32_t)r;
+        v.progressMs = now;
+    }
+    if (v.wire.body) {          // not for the prologue
+        v.sent++;
+        _adapt(v, now);
+        _wake->give();          // idle again: the producer may owe it a part
+    }
+    v.part.reset();
+    v.wire = Mjpeg::Wire();
+    return true;
+}
+
+static void _drop(Viewer &v) {
+    v.used = false;
+    v.part.reset();
+    _viewerCount--;
+}
+
+static void _senderTask(void *) {
+    for (;;) {
+        fd_set  wfds;
+        FD_ZERO(&wfds);
+        int     maxFd = -1;
+        int32_t wait  = 1000;       // until the next viewer is due, when all are idle
+        {
+            OsLock   l(*_mtx);
+            uint32_t now = millis();
+            for (auto &v : _viewers) {
+                if (!v.used) continue;
+                if (!v.wire.headLen) {
+                    int32_t due = (int32_t)(v.dueMs - now);
+                    if (due > 0) { wait = std::min(wait, due); continue; }
+                    // A plain viewer whose controller asked for a lower
+                    // quality waits for a part encoded at it (the producer
+                    // renders one now that the viewer is due).
+                    if (_latest && _latest->seq != v.lastSeq &&
+                        (v.kind != PLAIN || !_latest->quality ||
+                         _latest->quality <= kQuality[v.qLevel])) {
+                        _load(v, _latest, now);
+                        v.progressMs = now;     // the stall clock runs per part
+                    }
+                }
+                if (!v.wire.headLen) continue;
+                if (!_write(v, now)) {
+                    // Broken socket: httpd sees it too and closes the session.
+                    Serial.printf("[STREAM] Viewer on socket %d gone (errno %d)\n", v.fd, errno);
+                    _drop(v);
+                } else if (v.wire.headLen) {
+                    if (now - v.progressMs >= BROADCAST_STALL_MS) {
+                        Serial.printf("[STREAM] Viewer on socket %d stalled – dropped\n", v.fd);
+                        _stalled++;
+                        if (_onStall) _onStall(v.fd);
+                        _drop(v);
+                    } else {
+                        FD_SET(v.fd, &wfds);
+                        if (v.fd > maxFd) maxFd = v.fd;
+                    }
+                }
+            }
+        }
+        if (maxFd >= 0) {
+            // Someone's socket is full: wait for room, and look for newer
+            // parts every BROADCAST_POLL_MS meanwhile.
+            struct timeval tv = { 0, BROADCAST_POLL_MS * 1000 };
+            select(maxFd + 1, nullptr, &wfds, nullptr, &tv);
+        } else {
+            _ready->take((uint32_t)wait);
+        }
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//  Public API
+// ═══════════════════════════════════════════════════════════════════════════════
+bool begin(Render render, int core) {
+    if (_render) return true;
+    if (!render) return false;
+    _mtx   = new OsMutex();
+    _wake  = new OsSignal();
+    _ready = new OsSignal();
+    _render = render;
+    // The producer does the codec work, so it runs at the recognition
+    // stages' priority rather than httpd's; the sender only copies bytes.
+    if (!osTaskStart(_producerTask, "mjpeg_prod", 8192, nullptr, 1, core) ||
+        !osTaskStart(_senderTask,   "mjpeg_send", 3072, nullptr, 2, core)) {
+        Serial.println("[STREAM] Broadcaster tasks failed to start");
+        _render = nullptr;
+        return false;
+    }
+    Serial.printf("[STREAM] Broadcaster started (%d viewers)\n", BROADCAST_MAX_VIEWERS);
+    return true;
+}
+
+void setStallHandler(void (*fn)(int fd)) { _onStall = fn; }
+
+int addViewer(int fd, Kind kind, const char *prologue, uint32_t targetMs) {
+    if (!_mtx || fd < 0) return -1;
+    int id = -1;
+    {
+        OsLock l(*_mtx);
+        for (int i = 0; i < BROADCAST_MAX_VIEWERS; i++) {
+            Viewer &v = _viewers[i];
+            if (v.used) continue;
+            v.used       = true;
+            v.gen++;
+            v.kind       = kind;
+            v.fd         = fd;
+            v.lastSeq    = 0;
+            v.part.reset();
+            int n        = snprintf(v.head, sizeof(v.head), "%s", prologue ? prologue : "");
+            v.wire       = Mjpeg::Wire();
+            v.wire.head  = v.head;
+            v.wire.headLen = n < (int)sizeof(v.head) ? (size_t)n : sizeof(v.head) - 1;
+            v.progressMs = millis();
+            v.sent = v.skipped = v.bytes = v.writes = 0;
+            v.targetMs   = targetMs;
+            v.intervalMs = 0;
+            v.qLevel     = 0;
+            v.dueMs      = millis();
+            v.latMs = v.sendMs = v.kbps = 0;
+            _viewerCount++;
+            id = i | (v.gen << 8);
+            break;
+        }
+    }
+    if (id >= 0) { _wake->give(); _ready->give(); }
+    return id;
+}
+
+void removeViewer(int id) {
+    if (!_mtx || id < 0) return;
+    int slot = id & 0xff;
+    if (slot >= BROADCAST_MAX_VIEWERS) return;
+    OsLock l(*_mtx);
+    Viewer &v = _viewers[slot];
+    if (v.used && v.gen == (uint8_t)(id >> 8)) _drop(v);
+}
+
+int viewers() {
+    if (!_mtx) return 0;
+    OsLock l(*_mtx);
+    return _viewerCount;
+}
+
+Stats stats() {
+    Stats st = {};
+    st.produced     = _produced;
+    st.renderFailed = _renderFailed;
+    st.avgRenderUs  = _avgRenderUs;
+    st.maxRenderUs  = _maxRenderUs;
+    st.stalled      = _stalled;
+    if (!_mtx) return st;
+    OsLock l(*_mtx);
+    st.viewers = (uint32_t)_viewerCount;
+    for (int i = 0; i < BROADCAST_MAX_VIEWERS; i++) {
+        const Viewer &v = _viewers[i];
+        st.viewer[i].used    = v.used;
+        st.viewer[i].kind    = v.kind;
+        st.viewer[i].sent    = v.sent;
+        st.viewer[i].skipped = v.skipped;
+        st.viewer[i].kbytes     = v.bytes / 1024;
+        st.viewer[i].writes     = v.writes;
+        st.viewer[i].latencyMs  = v.latMs;
+        st.viewer[i].sendMs     = v.sendMs;
+        st.viewer[i].kbps       = v.kbps;
+        st.viewer[i].intervalMs = v.intervalMs;
+        st.viewer[i].quality    = kQuality[v.qLevel];
+        st.viewer[i].targetMs   = v.targetMs;
+    }
+    return st;
+}
+
+String toJSON() {
+    Stats st = stats();
+    String out;
+    out.reserve(160 + BROADCAST_MAX_VIEWERS * 200);
+    char buf[224];
+    snprintf(buf, sizeof(buf),
+        "{\"viewers\":%u,\"produced\":%u,\"renderFailed\":%u,\"avgRenderUs\":%u,"
+        "\"maxRenderUs\":%u,\"stalled\":%u,\"clients\":[",
+        (unsigned)st.viewers, (unsigned)st.produced, (unsigned)st.renderFailed,
+        (unsigned)st.avgRenderUs, (unsigned)st.maxRenderUs, (unsigned)st.stalled);
+    out = buf;
+    bool first = true;
+    for (const auto &v : st.viewer) {
+        if (!v.used) continue;
+        snprintf(buf, sizeof(buf),
+                 "%s{\"kind\":\"%s\",\"sent\":%u,\"skipped\":%u,\"kbytes\":%u,\"writes\":%u,"
+                 "\"latencyMs\":%u,\"sendMs\":%u,\"kbps\":%u,\"intervalMs\":%u,"
+                 "\"quality\":%u,\"targetMs\":%u}",
+                 first ? "" : ",", v.kind == OVERLAY ? "overlay" : "plain",
+                 (unsigned)v.sent, (unsigned)v.skipped, (unsigned)v.kbytes, (unsigned)v.writes,
+                 (unsigned)v.latencyMs, (unsigned)v.sendMs, (unsigned)v.kbps,
+                 (unsigned)v.intervalMs, (unsigned)v.quality, (unsigned)v.targetMs);
+        out += buf;
+        first = false;
+    }
+    out += "]}";
+    return out;
+}
+
+} // namespace Broadcast
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+# ─────────────────────────────────────────────────────────────────────────────
+#  FaceGuard Pro – tools/embed_web_assets.py
+#  Packs the portal (web/) into include/web_assets.h: each file gzip'd at
+#  build time into a PROGMEM byte array, with a strong ETag of the
+#  compressed bytes.  app_httpd.cpp serves them as-is with
+#  Content-Encoding: gzip.
+#
+#  In HTML, {{url:NAME}} becomes NAME's versioned URL (/NAME?v=<hash>), so
+#  files other than the pages can be cached for good and still change
+#  with a firmware update.
+#
+#    python3 tools/embed_web_assets.py           # regenerate if web/ changed
+#    python3 tools/embed_web_assets.py --check   # exit 1 if the header is stale
+#
+#  PlatformIO runs it before every build (extra_scripts in platformio.ini).
+#  The header is checked in, so builds without Python still work.
+# ─────────────────────────────────────────────────────────────────────────────
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+# (C name, file under web/, URL, Content-Type, immutable)
+ASSETS = [
+    ("web_login_html", "login.html", "/", "text/html; charset=utf-8", False),
+    ("web_index_html", "index.html", "/", "text/html; charset=utf-8", False),
+]
+
+HEADER = """\
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <pgmspace.h>
+
+// Generated by tools/embed_web_assets.py from web/ – do not edit.  After
+// changing anything under web/, run  python3 tools/embed_web_assets.py
+// (PlatformIO does it before each build).
+
+struct WebAsset {
+    const char    *path;        // URL it is served at
+    const char    *type;        // Content-Type
+    const uint8_t *gz;          // gzip'd body
+    size_t         gzLen;
+    size_t         rawLen;      // uncompressed size
+    const char    *etag;        // quoted strong ETag of the gzip'd body
+    bool           immutable;   // versioned URL: cacheable for a year
+};
+"""
+
+
+def build(root):
+    web = os.path.join(root, "web")
+    versions = {}
+    out = [HEADER]
+    for cname, fname, url, ctype, immutable in ASSETS:
+        with open(os.path.join(web, fname), "rb") as f:
+            raw = f.read()
+        if fname.endswith(".html"):
+            def url_of(m):
+                name = m.group(1).decode()
+                if name not in versions:
+                    sys.exit("embed_web_assets: %s: {{url:%s}} names no asset listed before it"
+                             % (fname, name))
+                return ("/%s?v=%s" % (name, versions[name])).encode()
+            raw = re.sub(rb"\{\{url:([\w.\-]+)\}\}", url_of, raw)
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        digest = hashlib.sha256(gz).hexdigest()
+        versions[fname] = digest[:8]
+
+        out.append("\n// %s: %d bytes, %d gzip'd\n" % (fname, len(raw), len(gz)))
+        out.append("static const uint8_t %s_gz[] PROGMEM = {\n" % cname)
+        for i in range(0, len(gz), 16):
+            out.append("    " + ",".join("0x%02x" % b for b in gz[i:i + 16]) + ",\n")
+        out.append("};\n")
+        out.append('static const WebAsset %s = {\n    "%s", "%s", %s_gz, sizeof(%s_gz), %d,\n'
+                   '    "\\"%s\\"", %s };\n'
+                   % (cname, url, ctype, cname, cname, len(raw), digest[:16],
+                      "true" if immutable else "false"))
+    return "".join(out)
+
+
+def main(argv, root=None):
+    root = root or os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    path = os.path.join(root, "include", "web_assets.h")
+    text = build(root)
+    try:
+        with open(path) as f:
+            current = f.read()
+    except OSError:
+        current = None
+    if "--check" in argv:
+        if current != text:
+            print("embed_web_assets: include/web_assets.h is out of date")
+            return 1
+        return 0
+    if current != text:
+        with open(path, "w") as f:
+            f.write(text)
+        print("embed_web_assets: wrote include/web_assets.h")
+    return 0
+
+
+try:
+    Import("env")                               # noqa: F821 – PlatformIO pre-script
+except NameError:
+    env = None
+
+if env is not None:
+    if main([], env.subst("$PROJECT_DIR")):     # noqa: F821
+        env.Exit(1)                             # noqa: F821
+elif __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))